@@ -0,0 +1,320 @@
+/*
+ * StringBuilder Project
+ *
+ *
+ * ByteTransform.cpp
+ *
+ * Date:        17/10/2026
+ *
+ * Author:      Mahmoud Yaman Seraj Alddin
+ *
+ * Purpose:     Implementation of the byte transforms,
+ *              described in ByteTransform.h
+ *
+ * List of global Functions:
+ *      void upperCaseBytes(char*, int)
+ *          Changes the ASCII letters of the given characters to upper case.
+ *
+ *      void lowerCaseBytes(char*, int)
+ *          Changes the ASCII letters of the given characters to lower case.
+ *
+ *      void swapCaseBytes(char*, int)
+ *          Swaps the case of the ASCII letters of the given characters.
+ *
+ *      void mapBytes(char*, int, const ByteTable&)
+ *          Replaces each of the given characters by its entry in the table.
+ *
+ *      ByteTable identityTable()
+ *          Returns the table mapping each character to itself.
+ *
+ * List of local Functions:
+ *      void flipScalar(char*, int, LetterRange, LetterRange)
+ *          Flips the case bit of the characters in the given ranges,
+ *          one character at a time.
+ *
+ *      void flipSse2(char*, int, LetterRange, LetterRange)
+ *          Flips the case bit of the characters in the given ranges,
+ *          16 characters at a time.
+ *
+ *      void flipAvx2(char*, int, LetterRange, LetterRange)
+ *          Flips the case bit of the characters in the given ranges,
+ *          32 characters at a time.
+ *
+ *      FlipKernel selectKernel()
+ *          Returns the fastest flip kernel the processor supports.
+ *
+ *      void flip(char*, int, LetterRange, LetterRange)
+ *          Flips the case bit of the characters in the given ranges,
+ *          using the selected kernel.
+ */
+
+#include "ByteTransform.h"
+
+/* SSE2 is part of x86-64, AVX2 is checked at runtime */
+#if defined(__x86_64__) and (defined(__GNUC__) or defined(__clang__))
+#define MYSTRINGBUILDER_X86_KERNELS
+#include <immintrin.h>
+#endif
+
+using namespace std;
+
+/*
+ * Range of ASCII letters of one case, first & last inclusive.
+ */
+struct LetterRange {
+    char first;
+    char last;
+};
+
+/* Lower case & upper case ASCII letters */
+static const LetterRange kLower{'a', 'z'};
+static const LetterRange kUpper{'A', 'Z'};
+
+/* Bit that differs between the two cases of an ASCII letter */
+static const char kCaseBit = 0x20;
+
+/*
+ * Type alias for a kernel flipping the case bit of the characters
+ * in either of two ranges.
+ */
+typedef void (*FlipKernel)(char*, int, LetterRange, LetterRange);
+
+/*
+ * Pre-Conditions:
+ *      Pointer to the characters to change & their count.
+ *      Two ranges of letters, may be the same.
+ *
+ * Post-Conditions:
+ *      The characters in either range have their case bit flipped.
+ *
+ * Used on processors without SIMD & for the tails of the SIMD kernels.
+ * Flips the case bit of the characters in the given ranges,
+ * one character at a time.
+ */
+static void flipScalar(char *data, int count, LetterRange a, LetterRange b) {
+    for (int i = 0; i < count; i++) {
+        const char c = data[i];
+
+        if ((a.first <= c and c <= a.last) or (b.first <= c and c <= b.last)) {
+            data[i] = (char) (c ^ kCaseBit);
+        }
+    }
+}
+
+#ifdef MYSTRINGBUILDER_X86_KERNELS
+/*
+ * Pre-Conditions:
+ *      Pointer to the characters to change & their count.
+ *      Two ranges of letters, may be the same.
+ *
+ * Post-Conditions:
+ *      The characters in either range have their case bit flipped.
+ *
+ * The ranges are checked with signed comparisons, so characters above
+ * 127 (negative) are never in a range.
+ * Flips the case bit of the characters in the given ranges,
+ * 16 characters at a time.
+ */
+static void flipSse2(char *data, int count, LetterRange a, LetterRange b) {
+    const __m128i aBelow = _mm_set1_epi8((char) (a.first - 1));
+    const __m128i aAbove = _mm_set1_epi8((char) (a.last + 1));
+    const __m128i bBelow = _mm_set1_epi8((char) (b.first - 1));
+    const __m128i bAbove = _mm_set1_epi8((char) (b.last + 1));
+    const __m128i bit = _mm_set1_epi8(kCaseBit);
+
+    int i = 0;
+
+    for (; i + 16 <= count; i += 16) {
+        auto block = reinterpret_cast<__m128i*>(data + i);
+        const __m128i c = _mm_loadu_si128(block);
+
+        const __m128i inA = _mm_and_si128(_mm_cmpgt_epi8(c, aBelow),
+                                          _mm_cmpgt_epi8(aAbove, c));
+        const __m128i inB = _mm_and_si128(_mm_cmpgt_epi8(c, bBelow),
+                                          _mm_cmpgt_epi8(bAbove, c));
+        const __m128i mask = _mm_and_si128(_mm_or_si128(inA, inB), bit);
+
+        _mm_storeu_si128(block, _mm_xor_si128(c, mask));
+    }
+
+    flipScalar(data + i, count - i, a, b);
+}
+
+/*
+ * Pre-Conditions:
+ *      Pointer to the characters to change & their count.
+ *      Two ranges of letters, may be the same.
+ *      The processor supports AVX2.
+ *
+ * Post-Conditions:
+ *      The characters in either range have their case bit flipped.
+ *
+ * Compiled for AVX2 regardless of the build flags,
+ * only called after the runtime check of selectKernel.
+ * Flips the case bit of the characters in the given ranges,
+ * 32 characters at a time.
+ */
+__attribute__((target("avx2")))
+static void flipAvx2(char *data, int count, LetterRange a, LetterRange b) {
+    const __m256i aBelow = _mm256_set1_epi8((char) (a.first - 1));
+    const __m256i aAbove = _mm256_set1_epi8((char) (a.last + 1));
+    const __m256i bBelow = _mm256_set1_epi8((char) (b.first - 1));
+    const __m256i bAbove = _mm256_set1_epi8((char) (b.last + 1));
+    const __m256i bit = _mm256_set1_epi8(kCaseBit);
+
+    int i = 0;
+
+    for (; i + 32 <= count; i += 32) {
+        auto block = reinterpret_cast<__m256i*>(data + i);
+        const __m256i c = _mm256_loadu_si256(block);
+
+        const __m256i inA = _mm256_and_si256(_mm256_cmpgt_epi8(c, aBelow),
+                                             _mm256_cmpgt_epi8(aAbove, c));
+        const __m256i inB = _mm256_and_si256(_mm256_cmpgt_epi8(c, bBelow),
+                                             _mm256_cmpgt_epi8(bAbove, c));
+        const __m256i mask = _mm256_and_si256(_mm256_or_si256(inA, inB),
+                                              bit);
+
+        _mm256_storeu_si256(block, _mm256_xor_si256(c, mask));
+    }
+
+    /* Calling the SSE2 kernel from AVX2 code costs a state transition */
+    flipScalar(data + i, count - i, a, b);
+}
+#endif /* MYSTRINGBUILDER_X86_KERNELS */
+
+/*
+ * Pre-Conditions:
+ *      No preconditions.
+ *
+ * Post-Conditions:
+ *      The widest kernel the processor supports is returned.
+ *
+ * Returns the fastest flip kernel the processor supports.
+ */
+static FlipKernel selectKernel() {
+#ifdef MYSTRINGBUILDER_X86_KERNELS
+    if (__builtin_cpu_supports("avx2")) {
+        return flipAvx2;
+    }
+
+    return flipSse2;
+#else
+    return flipScalar;
+#endif
+}
+
+/*
+ * Pre-Conditions:
+ *      Pointer to the characters to change & their count.
+ *      Two ranges of letters, may be the same.
+ *
+ * Post-Conditions:
+ *      The characters in either range have their case bit flipped.
+ *
+ * The kernel is selected once, on the first call.
+ * Flips the case bit of the characters in the given ranges,
+ * using the selected kernel.
+ */
+static void flip(char *data, int count, LetterRange a, LetterRange b) {
+    static const FlipKernel kernel = selectKernel();
+
+    kernel(data, count, a, b);
+}
+
+/*
+ * Pre-Conditions:
+ *      Pointer to the characters to change & their count.
+ *
+ * Post-Conditions:
+ *      'a' to 'z' are changed to 'A' to 'Z',
+ *      other characters are unchanged.
+ *
+ * Same result as toupper in the "C" locale.
+ * Changes the ASCII letters of the given characters to upper case.
+ */
+void upperCaseBytes(char *data, int count) {
+    flip(data, count, kLower, kLower);
+}
+
+/*
+ * Pre-Conditions:
+ *      Pointer to the characters to change & their count.
+ *
+ * Post-Conditions:
+ *      'A' to 'Z' are changed to 'a' to 'z',
+ *      other characters are unchanged.
+ *
+ * Same result as tolower in the "C" locale.
+ * Changes the ASCII letters of the given characters to lower case.
+ */
+void lowerCaseBytes(char *data, int count) {
+    flip(data, count, kUpper, kUpper);
+}
+
+/*
+ * Pre-Conditions:
+ *      Pointer to the characters to change & their count.
+ *
+ * Post-Conditions:
+ *      ASCII letters are changed to the other case,
+ *      other characters are unchanged.
+ *
+ * Swaps the case of the ASCII letters of the given characters.
+ */
+void swapCaseBytes(char *data, int count) {
+    flip(data, count, kLower, kUpper);
+}
+
+/*
+ * Pre-Conditions:
+ *      Pointer to the characters to change & their count.
+ *      const reference to the table of replacements.
+ *
+ * Post-Conditions:
+ *      Each character c is replaced by table[(unsigned char) c].
+ *
+ * The 256 byte table stays in the L1 cache, the loop is unrolled so
+ * independent lookups overlap.
+ * Replaces each of the given characters by its entry in the table.
+ */
+void mapBytes(char *data, int count, const ByteTable& table) {
+    int i = 0;
+
+    for (; i + 4 <= count; i += 4) {
+        const char c0 = table[(unsigned char) data[i]];
+        const char c1 = table[(unsigned char) data[i + 1]];
+        const char c2 = table[(unsigned char) data[i + 2]];
+        const char c3 = table[(unsigned char) data[i + 3]];
+
+        data[i] = c0;
+        data[i + 1] = c1;
+        data[i + 2] = c2;
+        data[i + 3] = c3;
+    }
+
+    for (; i < count; i++) {
+        data[i] = table[(unsigned char) data[i]];
+    }
+}
+
+/*
+ * Pre-Conditions:
+ *      No preconditions.
+ *
+ * Post-Conditions:
+ *      A table whose entry i is (char) i is returned.
+ *
+ * Starting point for custom tables, only the changed entries need
+ * to be assigned.
+ * Returns the table mapping each character to itself.
+ */
+ByteTable identityTable() {
+    ByteTable table{};
+
+    for (int i = 0; i < (int) table.size(); i++) {
+        table[i] = (char) i;
+    }
+
+    return table;
+}
@@ -0,0 +1,101 @@
+/*
+ * StringBuilder Project
+ *
+ *
+ * ByteTransform.h
+ *
+ * Date:        17/10/2026
+ *
+ * Author:      Mahmoud Yaman Seraj Alddin
+ *
+ * Purpose:     Header file for the byte transforms applied to the chunks
+ *              of MyStringBuilder, with SIMD kernels for case conversion.
+ *
+ * List of global Functions:
+ *      void upperCaseBytes(char*, int)
+ *          Changes the ASCII letters of the given characters to upper case.
+ *
+ *      void lowerCaseBytes(char*, int)
+ *          Changes the ASCII letters of the given characters to lower case.
+ *
+ *      void swapCaseBytes(char*, int)
+ *          Swaps the case of the ASCII letters of the given characters.
+ *
+ *      void mapBytes(char*, int, const ByteTable&)
+ *          Replaces each of the given characters by its entry in the table.
+ *
+ *      ByteTable identityTable()
+ *          Returns the table mapping each character to itself.
+ */
+
+#ifndef MYSTRINGBUILDER_BYTETRANSFORM_H
+#define MYSTRINGBUILDER_BYTETRANSFORM_H
+
+#include <array>
+
+/*
+ * Type alias for a table mapping each character, indexed as unsigned char,
+ * to its replacement.
+ */
+typedef std::array<char, 256> ByteTable;
+
+/*
+ * Pre-Conditions:
+ *      Pointer to the characters to change & their count.
+ *
+ * Post-Conditions:
+ *      'a' to 'z' are changed to 'A' to 'Z',
+ *      other characters are unchanged.
+ *
+ * Changes the ASCII letters of the given characters to upper case.
+ */
+void upperCaseBytes(char*, int);
+
+/*
+ * Pre-Conditions:
+ *      Pointer to the characters to change & their count.
+ *
+ * Post-Conditions:
+ *      'A' to 'Z' are changed to 'a' to 'z',
+ *      other characters are unchanged.
+ *
+ * Changes the ASCII letters of the given characters to lower case.
+ */
+void lowerCaseBytes(char*, int);
+
+/*
+ * Pre-Conditions:
+ *      Pointer to the characters to change & their count.
+ *
+ * Post-Conditions:
+ *      ASCII letters are changed to the other case,
+ *      other characters are unchanged.
+ *
+ * Swaps the case of the ASCII letters of the given characters.
+ */
+void swapCaseBytes(char*, int);
+
+/*
+ * Pre-Conditions:
+ *      Pointer to the characters to change & their count.
+ *      const reference to the table of replacements.
+ *
+ * Post-Conditions:
+ *      Each character c is replaced by table[(unsigned char) c].
+ *
+ * Replaces each of the given characters by its entry in the table.
+ */
+void mapBytes(char*, int, const ByteTable&);
+
+/*
+ * Pre-Conditions:
+ *      No preconditions.
+ *
+ * Post-Conditions:
+ *      A table whose entry i is (char) i is returned.
+ *
+ * Returns the table mapping each character to itself.
+ */
+[[nodiscard]] ByteTable identityTable();
+
+#endif /* MYSTRINGBUILDER_BYTETRANSFORM_H */
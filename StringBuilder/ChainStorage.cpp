@@ -0,0 +1,865 @@
+/*
+ * StringBuilder Project
+ *
+ *
+ * ChainStorage.cpp
+ *
+ * Date:        17/10/2026
+ *
+ * Author:      Mahmoud Yaman Seraj Alddin
+ *
+ * Purpose:     Implementation of the ChainStorage class,
+ *              described in ChainStorage.h
+ *
+ * List of public Functions:
+ *      ChainStorage()
+ *          No-arg constructor of the ChainStorage class.
+ *
+ *      ChainStorage(const char*, int)
+ *          Parameterized constructor of the ChainStorage class.
+ *
+ *      ~ChainStorage()
+ *          Destructor for the ChainStorage class.
+ *
+ *      Storage* copy(int begin, int end) const
+ *          Returns a new ChainStorage holding a copy of the characters
+ *          between begin (inclusive) & end (exclusive).
+ *
+ *      int length() const
+ *          Returns the number of characters in the chain.
+ *
+ *      char charAt(int) const
+ *          Returns the character at the given position.
+ *
+ *      void insert(int, const char*, int)
+ *          Inserts a copy of the given characters at the given position.
+ *
+ *      void insert(int, const Storage&)
+ *          Inserts a copy of the characters of the given Storage at the
+ *          given position.
+ *
+ *      void splice(int, Storage&)
+ *          Moves the characters of the given Storage to the given position,
+ *          leaving the given Storage empty.
+ *
+ *      void erase(int begin, int end)
+ *          Removes the characters between begin (inclusive)
+ *          & end (exclusive).
+ *
+ *      bool forEachChunk(int begin, int end, const ChunkVisitor&) const
+ *          Visits the characters between begin & end as contiguous chunks.
+ *
+ *      void forEachMutableChunk(int begin, int end,
+ *                               const MutableChunkVisitor&)
+ *          Visits the characters between begin & end as writable
+ *          contiguous chunks.
+ *
+ *      const NodeArena::Counters& getCounters() const
+ *          Returns the allocation counters of the Nodes of the chain.
+ *
+ * List of private Functions:
+ *      void splice(int, NodePtr, NodePtr, int)
+ *          Connects the given Node chain at the given position.
+ *
+ *      NodePtr splitAt(int)
+ *          Makes the given position fall on a Node boundary,
+ *          returns the Node ending at it.
+ *
+ *      NodePtr locate(int&) const
+ *          Returns a pointer to the Node holding the given position.
+ *
+ *      NodePtr locate(int&, int&) const
+ *          Returns a pointer to the Node holding the given position
+ *          & its entry.
+ *
+ *      NodePtr seek(int&, int&)
+ *          Returns a pointer to the Node holding the given position
+ *          & its entry, for an edit.
+ *
+ *      bool holds(int) const
+ *          Returns whether the finger holds the given position.
+ *
+ *      void reindex(int begin, int end)
+ *          Updates the index after the characters between begin & end
+ *          were replaced.
+ *
+ *      void extendIndex(NodePtr)
+ *          Adds the Nodes from the given one up to last to the end of
+ *          the index.
+ *
+ *      void pack(std::pair<NodePtr, NodePtr>&, const char*, int)
+ *          Adds the given characters to the last Node of a chain until it
+ *          is full, then to new Nodes.
+ */
+
+#include <algorithm>
+
+#include "ChainStorage.h"
+
+using namespace std;
+
+/*
+ * Pre-Conditions:
+ *      No preconditions.
+ *
+ * Post-Conditions:
+ *      An empty ChainStorage instance is created.
+ *      first, last & finger are initialized to nullptr.
+ *      size is initialized to 0.
+ *
+ * No-arg constructor of the ChainStorage class.
+ */
+ChainStorage::ChainStorage(): first{nullptr}, last{nullptr}, size{0},
+                               index{}, finger{nullptr}, fingerEntry{0},
+                               fingerStart{0}, fingerCount{0} {}
+
+/*
+ * Pre-Conditions:
+ *      Pointer to the characters to copy & their count.
+ *
+ * Post-Conditions:
+ *      A ChainStorage instance holding the given characters is created.
+ *      size is initialized to the given count.
+ *
+ * Parameterized constructor of the ChainStorage class.
+ */
+ChainStorage::ChainStorage(const char *data, int count): ChainStorage() {
+    insert(0, data, count);
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` ChainStorage instance is not destroyed.
+ *
+ * Post-Conditions:
+ *      `this` ChainStorage instance & all its Nodes are destroyed.
+ *
+ * The Nodes are freed with the pages of the arena, O(pages),
+ * without walking the chain.
+ * Destructor for the ChainStorage class.
+ */
+ChainStorage::~ChainStorage() {
+    first = nullptr;
+    last = nullptr;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` ChainStorage instance is initialized.
+ *      begin & end are valid positions, begin <= end.
+ *
+ * Post-Conditions:
+ *      A heap allocated ChainStorage is returned.
+ *      No changes to `this`.
+ *
+ * Returns a new ChainStorage holding a copy of the characters
+ * between begin (inclusive) & end (exclusive).
+ */
+Storage* ChainStorage::copy(int begin, int end) const {
+    auto result = new ChainStorage();
+    pair<NodePtr, NodePtr> chain{nullptr, nullptr};
+
+    /* The blocks of the copy are packed full, in the arena of the copy */
+    forEachChunk(begin, end, [result, &chain](const char *data, int count) {
+        result->pack(chain, data, count);
+        return true;
+    });
+
+    result->first = chain.first;
+    result->last = chain.second;
+    result->size = end - begin;
+    result->extendIndex(result->first);
+
+    return result;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` ChainStorage instance is initialized.
+ *
+ * Post-Conditions:
+ *      Number of characters in the chain is returned.
+ *      No changes to `this`.
+ *
+ * Returns the number of characters in the chain.
+ */
+int ChainStorage::length() const {
+    return size;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` ChainStorage instance is initialized.
+ *      Given int position is valid, less than length().
+ *
+ * Post-Conditions:
+ *      Character at the given position is returned.
+ *      No changes to `this`.
+ *
+ * Returns the character at the given position.
+ */
+char ChainStorage::charAt(int position) const {
+    NodePtr current = locate(position);
+
+    return current->getData(position);
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` ChainStorage instance is initialized.
+ *      Given int position is valid.
+ *      Pointer to the characters to insert & their count.
+ *
+ * Post-Conditions:
+ *      The given characters are inserted at the given position.
+ *
+ * If the Node holding the position has room, the characters are
+ * inserted in its block, otherwise a new chain is spliced in.
+ * Appending packs the characters after the last Node, O(count).
+ * Inserts a copy of the given characters at the given position.
+ */
+void ChainStorage::insert(int position, const char *data, int count) {
+    if (count <= 0) {
+        return;
+    }
+
+    if (position == size) {
+        NodePtr previous = last;
+        pair<NodePtr, NodePtr> chain{first, last};
+        pack(chain, data, count);
+
+        first = chain.first;
+        last = chain.second;
+        size += count;
+
+        /* The old last is indexed once the append moves past it */
+        extendIndex(previous ? previous : first);
+
+        return;
+    }
+
+    if (first) {
+        int offset = position;
+        int entry = 0;
+        NodePtr current = seek(offset, entry);
+
+        if (count <= current->getRoom()) {
+            current->insert(offset, data, count);
+
+            if (current != last) {
+                index.setWeight(entry, current->getCount());
+            }
+
+            fingerCount = current->getCount();
+            size += count;
+
+            return;
+        }
+    }
+
+    pair<NodePtr, NodePtr> chain{nullptr, nullptr};
+    pack(chain, data, count);
+
+    splice(position, chain.first, chain.second, count);
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` ChainStorage instance is initialized.
+ *      Given int position is valid.
+ *      const reference to a Storage other than `this`.
+ *
+ * Post-Conditions:
+ *      The characters of the given Storage are inserted
+ *      at the given position.
+ *      No changes to the given Storage.
+ *
+ * The copy is built as a separate chain first, then spliced in a single
+ * step, so the position is only reached once.
+ * Appending packs the chunks after the last Node, O(source.length()).
+ * Inserts a copy of the characters of the given Storage at the
+ * given position.
+ */
+void ChainStorage::insert(int position, const Storage& source) {
+    if (position == size) {
+        source.forEachChunk(0, source.length(),
+                            [this](const char *data, int count) {
+            insert(size, data, count);
+            return true;
+        });
+
+        return;
+    }
+
+    pair<NodePtr, NodePtr> chain{nullptr, nullptr};
+
+    /* Pack the chunks of the source into full blocks */
+    source.forEachChunk(0, source.length(),
+                        [this, &chain](const char *data, int count) {
+        pack(chain, data, count);
+        return true;
+    });
+
+    splice(position, chain.first, chain.second, source.length());
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` ChainStorage instance is initialized.
+ *      Given int position is valid.
+ *      Reference to a Storage other than `this`.
+ *
+ * Post-Conditions:
+ *      The characters of the given Storage are inserted
+ *      at the given position.
+ *      The given Storage is empty.
+ *
+ * The Nodes of another ChainStorage are connected as they are,
+ * after their pages are adopted by the arena of `this`,
+ * other Storages are copied.
+ * Moves the characters of the given Storage to the given position,
+ * leaving the given Storage empty.
+ */
+void ChainStorage::splice(int position, Storage& source) {
+    auto chain = dynamic_cast<ChainStorage*>(&source);
+
+    if (not chain or not chain->first) {
+        Storage::splice(position, source);
+        return;
+    }
+
+    arena.adopt(chain->arena);
+    splice(position, chain->first, chain->last, chain->size);
+
+    chain->first = nullptr;
+    chain->last = nullptr;
+    chain->size = 0;
+    chain->index.clear();
+    chain->finger = nullptr;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` ChainStorage instance is initialized.
+ *      begin & end are valid positions, begin <= end.
+ *
+ * Post-Conditions:
+ *      The characters between begin & end are removed,
+ *      emptied Nodes are released to the arena.
+ *      If the chain is emptied, the pages of the arena are freed.
+ *
+ * The Node holding begin is found through the index.
+ * The Node left at the edit point absorbs its next Node if they fit
+ * together, keeping the blocks filled.
+ * A range inside one Node only reweighs its entry, O(log n), others
+ * cost O(log n) per Node of the range.
+ * Removes the characters between begin (inclusive) & end (exclusive).
+ */
+void ChainStorage::erase(int begin, int end) {
+    if (end <= begin) {
+        return;
+    }
+
+    int offset = begin;
+    int entry = 0;
+    NodePtr current = seek(offset, entry);
+    NodePtr touched = current;
+
+    /*
+     * Node before the current one, nullptr while current is first,
+     * looked up only if the Node holding begin is emptied
+     */
+    NodePtr before = nullptr;
+    bool released = false;
+
+    int remaining = end - begin;
+
+    /* Remove the range block by block */
+    while (0 < remaining) {
+        const int taken = min(current->getCount() - offset, remaining);
+
+        current->erase(offset, offset + taken);
+        remaining -= taken;
+        offset = 0;
+
+        if (current->getCount()) {
+            before = current;
+            current = current->getNext();
+            continue;
+        }
+
+        /* Release the emptied Node */
+        NodePtr next = current->getNext();
+
+        if (current == touched) {
+            before = entry ? index.at(entry - 1) : nullptr;
+        }
+
+        if (not before) {
+            /* Handle changing first NodePtr */
+            first = next;
+        } else {
+            before->chain(next);
+        }
+
+        arena.release(current);
+        released = true;
+
+        current = next;
+    }
+
+    /* The range reached the end of the chain */
+    if (not current) {
+        last = before;
+    }
+
+    const bool absorbed = before and before->absorb(arena);
+
+    if (absorbed and not before->getNext()) {
+        last = before;
+    }
+
+    size -= end - begin;
+
+    /* Only the Node holding begin shrank, the others are unchanged */
+    if (not released and not absorbed and before == touched) {
+        if (touched != last) {
+            index.setWeight(entry, touched->getCount());
+        }
+
+        fingerCount = touched->getCount();
+    } else {
+        reindex(begin, end);
+    }
+
+    if (not first) {
+        arena.reset();
+    }
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` ChainStorage instance is initialized.
+ *      begin & end are valid positions, begin <= end.
+ *      const reference to a ChunkVisitor.
+ *
+ * Post-Conditions:
+ *      The visitor is called for each Node block between begin & end,
+ *      until it returns false.
+ *      Returns false if the visitor stopped the visit.
+ *      No changes to `this`.
+ *
+ * Visits the characters between begin & end as contiguous chunks.
+ */
+bool ChainStorage::forEachChunk(int begin, int end,
+                                const ChunkVisitor& visitor) const {
+    if (end <= begin) {
+        return true;
+    }
+
+    int offset = begin;
+    NodePtr current = locate(offset);
+
+    /* Iterate over the blocks holding the characters from begin to end */
+    for (int remaining = end - begin; 0 < remaining;) {
+        const int taken = min(current->getCount() - offset, remaining);
+
+        if (not visitor(current->getBlock() + offset, taken)) {
+            return false;
+        }
+
+        remaining -= taken;
+        offset = 0;
+        current = current->getNext();
+    }
+
+    return true;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` ChainStorage instance is initialized.
+ *      begin & end are valid positions, begin <= end.
+ *      const reference to a MutableChunkVisitor.
+ *
+ * Post-Conditions:
+ *      The visitor is called for each Node block between begin & end.
+ *      Changes made by the visitor are stored in the Nodes.
+ *
+ * Visits the characters between begin & end as writable
+ * contiguous chunks.
+ */
+void ChainStorage::forEachMutableChunk(int begin, int end,
+                                       const MutableChunkVisitor& visitor) {
+    if (end <= begin) {
+        return;
+    }
+
+    int offset = begin;
+    NodePtr current = locate(offset);
+
+    /* Iterate over the blocks holding the characters from begin to end */
+    for (int remaining = end - begin; 0 < remaining;) {
+        const int taken = min(current->getCount() - offset, remaining);
+
+        visitor(current->getBlock() + offset, taken);
+
+        remaining -= taken;
+        offset = 0;
+        current = current->getNext();
+    }
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` ChainStorage instance is initialized.
+ *
+ * Post-Conditions:
+ *      const reference to the counters of the NodeArena is returned.
+ *      No changes to `this`.
+ *
+ * Compared with the number of Nodes made, the number of pages gives the
+ * heap allocations saved by the arena.
+ * Returns the allocation counters of the Nodes of the chain.
+ */
+const NodeArena::Counters& ChainStorage::getCounters() const {
+    return arena.getCounters();
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` ChainStorage instance is initialized.
+ *      Given int position is valid.
+ *      First & last Nodes of a chain made by the arena of `this`,
+ *      not connected to the chain of `this`.
+ *      int of the number of characters in the chain.
+ *
+ * Post-Conditions:
+ *      The chain is owned by `this`, starting at the given position.
+ *      size is increased by the given count.
+ *
+ * If the chain is empty, no changes occur.
+ * The blocks on both seams absorb their neighbours if they fit,
+ * last is moved to whichever Node ends the chain.
+ * Connects the given Node chain at the given position.
+ */
+void ChainStorage::splice(int position, NodePtr chain_start,
+                          NodePtr chain_end, int count) {
+    if (not chain_start) {
+        return;
+    }
+
+    NodePtr before = splitAt(position);
+
+    if (not before) {
+        /* Handle changing first NodePtr */
+        chain_end->chain(first);
+        first = chain_start;
+    } else {
+        /* Connect the new chain to the main chain */
+        chain_end->chain(before->getNext());
+        before->chain(chain_start);
+    }
+
+    size += count;
+
+    chain_end->absorb(arena);
+
+    if (not chain_end->getNext()) {
+        last = chain_end;
+    }
+
+    /* before may absorb chain_end, if the chain is a single Node */
+    if (before and before->absorb(arena) and not before->getNext()) {
+        last = before;
+    }
+
+    reindex(position, position);
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` ChainStorage instance is initialized.
+ *      Given int position is valid.
+ *
+ * Post-Conditions:
+ *      A Node ends exactly at the given position.
+ *      Returns that Node, nullptr if the position is 0.
+ *
+ * The Node holding the character before the position is split
+ * after that character, unless it already ends there.
+ * Makes the given position fall on a Node boundary,
+ * returns the Node ending at it.
+ */
+ChainStorage::NodePtr ChainStorage::splitAt(int position) {
+    if (not position) {
+        return nullptr;
+    }
+
+    int offset = position - 1;
+    int entry = 0;
+    NodePtr current = seek(offset, entry);
+
+    if (offset + 1 < current->getCount()) {
+        NodePtr tail = current->split(offset + 1, arena);
+
+        if (current == last) {
+            last = tail;
+        }
+    }
+
+    return current;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` ChainStorage instance is initialized & not empty.
+ *      Reference to a valid position.
+ *
+ * Post-Conditions:
+ *      A pointer to the Node holding the position is returned,
+ *      the position is changed to an index in that Node's block.
+ *      For the position length(), the last Node is returned
+ *      with an index equal to its count.
+ *
+ * Positions in the last Node are reached through last in O(1),
+ * others are searched in the index, O(log n).
+ * Sequential reads should use the chunks, e.g. through CharIterator,
+ * which reach each Node once.
+ * Returns a pointer to the Node holding the given position.
+ */
+ChainStorage::NodePtr ChainStorage::locate(int& position) const {
+    int entry = 0;
+
+    return locate(position, entry);
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` ChainStorage instance is initialized & not empty.
+ *      Reference to a valid position.
+ *      Reference to an int receiving the entry.
+ *
+ * Post-Conditions:
+ *      A pointer to the Node holding the position is returned,
+ *      its entry in the index is stored in the given int,
+ *      the position is changed to an index in that Node's block.
+ *      For the positions in last, the entry is the size of the index.
+ *      No changes to `this`.
+ *
+ * The index covers the characters before last, O(log n).
+ * Returns a pointer to the Node holding the given position & its entry.
+ */
+ChainStorage::NodePtr ChainStorage::locate(int& position, int& entry) const {
+    const int indexed = index.weight();
+
+    if (indexed <= position) {
+        position -= indexed;
+        entry = index.size();
+
+        return last;
+    }
+
+    return index.find(position, entry);
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` ChainStorage instance is initialized & not empty.
+ *      Reference to a valid position, less than length().
+ *      Reference to an int receiving the entry.
+ *
+ * Post-Conditions:
+ *      Same as locate.
+ *      The finger is moved to the returned Node.
+ *
+ * A position in the Node of the last edit is found in O(1), others
+ * through locate. The edits keep the finger right, or drop it when
+ * they change the index elsewhere than its entry.
+ * Returns a pointer to the Node holding the given position
+ * & its entry, for an edit.
+ */
+ChainStorage::NodePtr ChainStorage::seek(int& position, int& entry) {
+    if (holds(position)) {
+        position -= fingerStart;
+        entry = fingerEntry;
+
+        return finger;
+    }
+
+    const int start = position;
+
+    finger = locate(position, entry);
+    fingerEntry = entry;
+    fingerStart = start - position;
+    fingerCount = finger->getCount();
+
+    return finger;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` ChainStorage instance is initialized.
+ *      Given int position is valid.
+ *
+ * Post-Conditions:
+ *      Returns whether finger is set & holds the position,
+ *      as in the index.
+ *      No changes to `this`.
+ *
+ * Returns whether the finger holds the given position.
+ */
+bool ChainStorage::holds(int position) const {
+    return finger and fingerStart <= position and
+           position < fingerStart + fingerCount;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` ChainStorage instance is initialized.
+ *      begin & end are the positions of the changed characters
+ *      before the change, begin <= end.
+ *      The index is unchanged since before the change.
+ *
+ * Post-Conditions:
+ *      The index holds the Nodes of the chain but last, in order.
+ *
+ * Nodes starting before begin are kept, the last of them may have been
+ * split or may have absorbed its next Node, so it is indexed again.
+ * Nodes starting after end are kept, except the first one, that may
+ * have been absorbed by the Node before it.
+ * Only the Nodes in between are walked, O(log n) each, so an edit costs
+ * O(log n) per Node it touches instead of O(n).
+ * The finger is moved to the first Node indexed again, if its start is
+ * known, so the next edit around the same place skips the search.
+ * Updates the index after the characters between begin & end
+ * were replaced.
+ */
+void ChainStorage::reindex(int begin, int end) {
+    const int indexed = index.weight();
+    int entry = 0;
+
+    /* Entries starting before begin, the last of them is current */
+    int kept = index.size();
+    NodePtr current = first;
+
+    /* Start of current, -1 if unknown */
+    int start = -1;
+
+    if (not begin) {
+        kept = 0;
+        start = 0;
+    } else if (holds(begin - 1) and fingerEntry < kept) {
+        kept = fingerEntry + 1;
+        current = finger;
+        start = fingerStart;
+    } else if (begin - 1 < indexed) {
+        int position = begin - 1;
+
+        current = index.find(position, entry);
+        kept = entry + 1;
+        start = begin - 1 - position;
+    } else if (kept) {
+        current = index.at(kept - 1);
+    }
+
+    /* Entries starting at or before end, & the one after them */
+    int resumed = index.size();
+
+    if (holds(end)) {
+        resumed = min(fingerEntry + 2, index.size());
+    } else if (end < indexed) {
+        int position = end;
+
+        index.find(position, entry);
+        resumed = min(entry + 2, index.size());
+    }
+
+    NodePtr stop = resumed < index.size() ? index.at(resumed) : nullptr;
+
+    /* The first Node indexed again becomes the finger */
+    finger = nullptr;
+    fingerEntry = kept ? kept - 1 : 0;
+    fingerStart = start;
+
+    index.replace(kept ? kept - 1 : 0, resumed,
+                  [this, &current, stop](NodePtr& node, int& count) {
+        if (current != stop and current == last) {
+            current = current->getNext();
+        }
+
+        if (current == stop) {
+            return false;
+        }
+
+        node = current;
+        count = current->getCount();
+        current = current->getNext();
+
+        if (not finger and 0 <= fingerStart) {
+            finger = node;
+            fingerCount = count;
+        }
+
+        return true;
+    });
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` ChainStorage instance is initialized.
+ *      Node of the chain following the Nodes of the index,
+ *      may be nullptr if the chain is empty.
+ *
+ * Post-Conditions:
+ *      The index holds the Nodes of the chain but last, in order.
+ *
+ * O(log n) per Node added, appends add one per filled Node.
+ * Adds the Nodes from the given one up to last to the end of
+ * the index.
+ */
+void ChainStorage::extendIndex(NodePtr from) {
+    finger = nullptr;
+
+    for (NodePtr current = from; current != last;
+         current = current->getNext()) {
+        index.insert(index.size(), current, current->getCount());
+    }
+}
+
+/*
+ * Pre-Conditions:
+ *      Reference to the first & last Nodes of a chain made by the arena
+ *      of `this`, not connected to the chain of `this`,
+ *      both nullptr for an empty chain.
+ *      Pointer to the characters to copy & their count.
+ *
+ * Post-Conditions:
+ *      The characters are added to the end of the chain.
+ *      The pair holds the first & last Nodes of the chain.
+ *
+ * Adds the given characters to the last Node of a chain until it
+ * is full, then to new Nodes.
+ */
+void ChainStorage::pack(pair<NodePtr, NodePtr>& chain,
+                        const char *data, int count) {
+    while (0 < count) {
+        if (not chain.second or not chain.second->getRoom()) {
+            auto block = arena.make();
+
+            if (not chain.first) {
+                chain.first = block;
+            } else {
+                chain.second->chain(block);
+            }
+
+            chain.second = block;
+        }
+
+        const int taken = chain.second->insert(chain.second->getCount(),
+                                               data, count);
+
+        data += taken;
+        count -= taken;
+    }
+}
@@ -0,0 +1,478 @@
+/*
+ * StringBuilder Project
+ *
+ *
+ * ChainStorage.h
+ *
+ * Date:        17/10/2026
+ *
+ * Author:      Mahmoud Yaman Seraj Alddin
+ *
+ * Purpose:     Header file for the ChainStorage class,
+ *              the linked list of Nodes storage of MyStringBuilder.
+ *
+ * List of public Functions:
+ *      ChainStorage()
+ *          No-arg constructor of the ChainStorage class.
+ *
+ *      ChainStorage(const char*, int)
+ *          Parameterized constructor of the ChainStorage class.
+ *
+ *      ~ChainStorage()
+ *          Destructor for the ChainStorage class.
+ *
+ *      Storage* copy(int begin, int end) const
+ *          Returns a new ChainStorage holding a copy of the characters
+ *          between begin (inclusive) & end (exclusive).
+ *
+ *      int length() const
+ *          Returns the number of characters in the chain.
+ *
+ *      char charAt(int) const
+ *          Returns the character at the given position.
+ *
+ *      void insert(int, const char*, int)
+ *          Inserts a copy of the given characters at the given position.
+ *
+ *      void insert(int, const Storage&)
+ *          Inserts a copy of the characters of the given Storage at the
+ *          given position.
+ *
+ *      void splice(int, Storage&)
+ *          Moves the characters of the given Storage to the given position,
+ *          leaving the given Storage empty.
+ *
+ *      void erase(int begin, int end)
+ *          Removes the characters between begin (inclusive)
+ *          & end (exclusive).
+ *
+ *      bool forEachChunk(int begin, int end, const ChunkVisitor&) const
+ *          Visits the characters between begin & end as contiguous chunks.
+ *
+ *      void forEachMutableChunk(int begin, int end,
+ *                               const MutableChunkVisitor&)
+ *          Visits the characters between begin & end as writable
+ *          contiguous chunks.
+ *
+ *      const NodeArena::Counters& getCounters() const
+ *          Returns the allocation counters of the Nodes of the chain.
+ *
+ * List of private Functions:
+ *      void splice(int, NodePtr, NodePtr, int)
+ *          Connects the given Node chain at the given position.
+ *
+ *      NodePtr splitAt(int)
+ *          Makes the given position fall on a Node boundary,
+ *          returns the Node ending at it.
+ *
+ *      NodePtr locate(int&) const
+ *          Returns a pointer to the Node holding the given position.
+ *
+ *      NodePtr locate(int&, int&) const
+ *          Returns a pointer to the Node holding the given position
+ *          & its entry.
+ *
+ *      NodePtr seek(int&, int&)
+ *          Returns a pointer to the Node holding the given position
+ *          & its entry, for an edit.
+ *
+ *      bool holds(int) const
+ *          Returns whether the finger holds the given position.
+ *
+ *      void reindex(int begin, int end)
+ *          Updates the index after the characters between begin & end
+ *          were replaced.
+ *
+ *      void extendIndex(NodePtr)
+ *          Adds the Nodes from the given one up to last to the end of
+ *          the index.
+ *
+ *      void pack(std::pair<NodePtr, NodePtr>&, const char*, int)
+ *          Adds the given characters to the last Node of a chain until it
+ *          is full, then to new Nodes.
+ */
+
+#ifndef MYSTRINGBUILDER_CHAINSTORAGE_H
+#define MYSTRINGBUILDER_CHAINSTORAGE_H
+
+#include <utility>
+
+#include "Node.h"
+#include "NodeArena.h"
+#include "PositionIndex.h"
+#include "Storage.h"
+
+/*
+ * ChainStorage stores the characters in a chain of Nodes,
+ * each Node holding a block of up to Node::kCapacity characters
+ * (an unrolled linked list).
+ * The Nodes are made by a NodeArena owned by the storage.
+ * Random positions are found through an order-statistic index of the
+ * Nodes, in O(log n). Edits update it in O(log n) per Node they touch,
+ * appends once per Node they fill.
+ * Edits also keep a finger on the last Node they reached, so repeated
+ * edits around one place skip the search.
+ * The const functions never change `this`, so they are safe to call
+ * from many threads at once.
+ */
+class ChainStorage : public Storage {
+public:
+    /*
+     * Type alias for Node*.
+     * Can be accessed outside the class using ChainStorage::NodePtr.
+     */
+    typedef Node* NodePtr;
+
+    /*
+     * Pre-Conditions:
+     *      No preconditions.
+     *
+     * Post-Conditions:
+     *      An empty ChainStorage instance is created.
+     *      first, last & finger are nullptr.
+     *      size is 0.
+     *
+     * No-arg constructor of the ChainStorage class.
+     */
+    ChainStorage();
+
+    /*
+     * Pre-Conditions:
+     *      Pointer to the characters to copy & their count.
+     *
+     * Post-Conditions:
+     *      A ChainStorage instance holding the given characters is created.
+     *      size is equal to the given count.
+     *
+     * Parameterized constructor of the ChainStorage class.
+     */
+    ChainStorage(const char*, int);
+
+    /*
+     * Pre-Conditions:
+     *      `this` ChainStorage instance is not destroyed.
+     *
+     * Post-Conditions:
+     *      `this` ChainStorage instance & all its Nodes are destroyed.
+     *
+     * Destructor for the ChainStorage class.
+     */
+    ~ChainStorage() override;
+
+    /*
+     * Pre-Conditions:
+     *      `this` ChainStorage instance is initialized.
+     *      begin & end are valid positions, begin <= end.
+     *
+     * Post-Conditions:
+     *      A heap allocated ChainStorage is returned.
+     *      No changes to `this`.
+     *
+     * Returns a new ChainStorage holding a copy of the characters
+     * between begin (inclusive) & end (exclusive).
+     */
+    [[nodiscard]] Storage* copy(int /* begin */,
+                                int /* end */) const override;
+
+    /*
+     * Pre-Conditions:
+     *      `this` ChainStorage instance is initialized.
+     *
+     * Post-Conditions:
+     *      Number of characters in the chain is returned.
+     *      No changes to `this`.
+     *
+     * Returns the number of characters in the chain.
+     */
+    [[nodiscard]] int length() const override;
+
+    /*
+     * Pre-Conditions:
+     *      `this` ChainStorage instance is initialized.
+     *      Given int position is valid, less than length().
+     *
+     * Post-Conditions:
+     *      Character at the given position is returned.
+     *      No changes to `this`.
+     *
+     * Returns the character at the given position.
+     */
+    [[nodiscard]] char charAt(int) const override;
+
+    /*
+     * Pre-Conditions:
+     *      `this` ChainStorage instance is initialized.
+     *      Given int position is valid.
+     *      Pointer to the characters to insert & their count.
+     *
+     * Post-Conditions:
+     *      The given characters are inserted at the given position.
+     *
+     * Inserts a copy of the given characters at the given position.
+     */
+    void insert(int, const char*, int) override;
+
+    /*
+     * Pre-Conditions:
+     *      `this` ChainStorage instance is initialized.
+     *      Given int position is valid.
+     *      const reference to a Storage other than `this`.
+     *
+     * Post-Conditions:
+     *      The characters of the given Storage are inserted
+     *      at the given position.
+     *      No changes to the given Storage.
+     *
+     * Inserts a copy of the characters of the given Storage at the
+     * given position.
+     */
+    void insert(int, const Storage&) override;
+
+    /*
+     * Pre-Conditions:
+     *      `this` ChainStorage instance is initialized.
+     *      Given int position is valid.
+     *      Reference to a Storage other than `this`.
+     *
+     * Post-Conditions:
+     *      The characters of the given Storage are inserted
+     *      at the given position.
+     *      The given Storage is empty.
+     *
+     * Moves the characters of the given Storage to the given position,
+     * leaving the given Storage empty.
+     */
+    void splice(int, Storage&) override;
+
+    /*
+     * Pre-Conditions:
+     *      `this` ChainStorage instance is initialized.
+     *      begin & end are valid positions, begin <= end.
+     *
+     * Post-Conditions:
+     *      The characters between begin & end are removed,
+     *      emptied Nodes are deleted.
+     *
+     * Removes the characters between begin (inclusive) & end (exclusive).
+     */
+    void erase(int /* begin */, int /* end */) override;
+
+    /*
+     * Pre-Conditions:
+     *      `this` ChainStorage instance is initialized.
+     *      begin & end are valid positions, begin <= end.
+     *      const reference to a ChunkVisitor.
+     *
+     * Post-Conditions:
+     *      The visitor is called for each Node block between begin & end,
+     *      until it returns false.
+     *      Returns false if the visitor stopped the visit.
+     *      No changes to `this`.
+     *
+     * Visits the characters between begin & end as contiguous chunks.
+     */
+    bool forEachChunk(int /* begin */, int /* end */,
+                      const ChunkVisitor&) const override;
+
+    /*
+     * Pre-Conditions:
+     *      `this` ChainStorage instance is initialized.
+     *      begin & end are valid positions, begin <= end.
+     *      const reference to a MutableChunkVisitor.
+     *
+     * Post-Conditions:
+     *      The visitor is called for each Node block between begin & end.
+     *      Changes made by the visitor are stored in the Nodes.
+     *
+     * Visits the characters between begin & end as writable
+     * contiguous chunks.
+     */
+    void forEachMutableChunk(int /* begin */, int /* end */,
+                             const MutableChunkVisitor&) override;
+
+    /*
+     * Pre-Conditions:
+     *      `this` ChainStorage instance is initialized.
+     *
+     * Post-Conditions:
+     *      const reference to the counters of the NodeArena is returned.
+     *      No changes to `this`.
+     *
+     * Returns the allocation counters of the Nodes of the chain.
+     */
+    [[nodiscard]] const NodeArena::Counters& getCounters() const;
+
+private:
+    /*
+     * Pre-Conditions:
+     *      `this` ChainStorage instance is initialized.
+     *      Given int position is valid.
+     *      First & last Nodes of a chain made by the arena of `this`,
+     *      not connected to the chain of `this`.
+     *      int of the number of characters in the chain.
+     *
+     * Post-Conditions:
+     *      The chain is owned by `this`, starting at the given position.
+     *      size is increased by the given count.
+     *
+     * Connects the given Node chain at the given position.
+     */
+    void splice(int, NodePtr, NodePtr, int);
+
+    /*
+     * Pre-Conditions:
+     *      `this` ChainStorage instance is initialized.
+     *      Given int position is valid.
+     *
+     * Post-Conditions:
+     *      A Node ends exactly at the given position.
+     *      Returns that Node, nullptr if the position is 0.
+     *
+     * Makes the given position fall on a Node boundary,
+     * returns the Node ending at it.
+     */
+    NodePtr splitAt(int);
+
+    /*
+     * Pre-Conditions:
+     *      `this` ChainStorage instance is initialized & not empty.
+     *      Reference to a valid position.
+     *
+     * Post-Conditions:
+     *      A pointer to the Node holding the position is returned,
+     *      the position is changed to an index in that Node's block.
+     *      For the position length(), the last Node is returned
+     *      with an index equal to its count.
+     *
+     * Returns a pointer to the Node holding the given position.
+     */
+    [[nodiscard]] NodePtr locate(int&) const;
+
+    /*
+     * Pre-Conditions:
+     *      `this` ChainStorage instance is initialized & not empty.
+     *      Reference to a valid position.
+     *      Reference to an int receiving the entry.
+     *
+     * Post-Conditions:
+     *      A pointer to the Node holding the position is returned,
+     *      its entry in the index is stored in the given int,
+     *      the position is changed to an index in that Node's block.
+     *      For the positions in last, the entry is the size of the index.
+     *      No changes to `this`.
+     *
+     * Returns a pointer to the Node holding the given position & its entry.
+     */
+    [[nodiscard]] NodePtr locate(int&, int&) const;
+
+    /*
+     * Pre-Conditions:
+     *      `this` ChainStorage instance is initialized & not empty.
+     *      Reference to a valid position, less than length().
+     *      Reference to an int receiving the entry.
+     *
+     * Post-Conditions:
+     *      Same as locate.
+     *      The finger is moved to the returned Node.
+     *
+     * Returns a pointer to the Node holding the given position
+     * & its entry, for an edit.
+     */
+    NodePtr seek(int&, int&);
+
+    /*
+     * Pre-Conditions:
+     *      `this` ChainStorage instance is initialized.
+     *      Given int position is valid.
+     *
+     * Post-Conditions:
+     *      Returns whether finger is set & holds the position,
+     *      as in the index.
+     *      No changes to `this`.
+     *
+     * Returns whether the finger holds the given position.
+     */
+    [[nodiscard]] bool holds(int) const;
+
+    /*
+     * Pre-Conditions:
+     *      `this` ChainStorage instance is initialized.
+     *      begin & end are the positions of the changed characters
+     *      before the change, begin <= end.
+     *      The index is unchanged since before the change.
+     *
+     * Post-Conditions:
+     *      The index holds the Nodes of the chain but last, in order.
+     *
+     * Updates the index after the characters between begin & end
+     * were replaced.
+     */
+    void reindex(int /* begin */, int /* end */);
+
+    /*
+     * Pre-Conditions:
+     *      `this` ChainStorage instance is initialized.
+     *      Node of the chain following the Nodes of the index,
+     *      may be nullptr if the chain is empty.
+     *
+     * Post-Conditions:
+     *      The index holds the Nodes of the chain but last, in order.
+     *
+     * Adds the Nodes from the given one up to last to the end of
+     * the index.
+     */
+    void extendIndex(NodePtr);
+
+    /*
+     * Pre-Conditions:
+     *      Reference to the first & last Nodes of a chain made by the arena
+     *      of `this`, not connected to the chain of `this`,
+     *      both nullptr for an empty chain.
+     *      Pointer to the characters to copy & their count.
+     *
+     * Post-Conditions:
+     *      The characters are added to the end of the chain.
+     *      The pair holds the first & last Nodes of the chain.
+     *
+     * Adds the given characters to the last Node of a chain until it
+     * is full, then to new Nodes.
+     */
+    void pack(std::pair<NodePtr, NodePtr>&, const char*, int);
+
+    /* Allocator of the Nodes of the chain */
+    NodeArena arena;
+
+    /* Node pointer to the first Node in the chain */
+    NodePtr first;
+
+    /* Node pointer to the last Node in the chain, kept for O(1) appends */
+    NodePtr last;
+
+    /* Number of characters in the chain */
+    int size;
+
+    /*
+     * Nodes of the chain but last, in order, weighted by their counts.
+     * last is left out, so appends that only fill it leave the index as
+     * it is.
+     */
+    PositionIndex<NodePtr> index;
+
+    /*
+     * Node of the last edit, with its entry, start & count as in the
+     * index, nullptr once the index changed elsewhere.
+     * Only the edits use & move it, the const functions do not.
+     */
+    NodePtr finger;
+
+    /* Entry of finger in the index */
+    int fingerEntry;
+
+    /* Position of the first character of finger */
+    int fingerStart;
+
+    /* Number of characters of finger */
+    int fingerCount;
+};
+
+#endif /* MYSTRINGBUILDER_CHAINSTORAGE_H */
@@ -0,0 +1,86 @@
+/*
+ * StringBuilder Project
+ *
+ *
+ * CharIterator.cpp
+ *
+ * Date:        17/10/2026
+ *
+ * Author:      Mahmoud Yaman Seraj Alddin
+ *
+ * Purpose:     Implementation of the CharIterator class,
+ *              described in CharIterator.h
+ *              The per-character functions are inline in CharIterator.h.
+ *
+ * List of public Functions:
+ *      CharIterator()
+ *          No-arg constructor of the CharIterator class.
+ *
+ *      CharIterator(const Storage*, int)
+ *          Parameterized constructor of the CharIterator class.
+ *
+ * List of private Functions:
+ *      void load()
+ *          Caches the run of characters starting at the position.
+ */
+
+#include "CharIterator.h"
+
+using namespace std;
+
+/*
+ * Pre-Conditions:
+ *      No preconditions.
+ *
+ * Post-Conditions:
+ *      A singular CharIterator instance is created,
+ *      not attached to any Storage.
+ *
+ * Required by forward iterators, compares equal to other singular
+ * iterators only.
+ * No-arg constructor of the CharIterator class.
+ */
+CharIterator::CharIterator(): storage{nullptr}, position{0},
+                              current{nullptr}, remaining{0} {}
+
+/*
+ * Pre-Conditions:
+ *      Pointer to a Storage, not changed while the iterator is used.
+ *      Given int position is valid, at most the Storage length.
+ *
+ * Post-Conditions:
+ *      A CharIterator instance at the given position is created.
+ *      The position equal to the length is the end iterator.
+ *
+ * Parameterized constructor of the CharIterator class.
+ */
+CharIterator::CharIterator(const Storage *storage, int position):
+        storage{storage}, position{position},
+        current{nullptr}, remaining{0} {
+    load();
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` CharIterator instance is initialized.
+ *
+ * Post-Conditions:
+ *      current points to the character at the position &
+ *      remaining is the number of characters of its run.
+ *      For the end position, current is nullptr.
+ *
+ * Caches the run of characters starting at the position.
+ */
+void CharIterator::load() {
+    if (not storage or storage->length() <= position) {
+        current = nullptr;
+        remaining = 0;
+
+        return;
+    }
+
+    const Storage::Chunk chunk = storage->chunkAt(position);
+
+    current = chunk.data;
+    remaining = chunk.count;
+}
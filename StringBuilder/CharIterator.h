@@ -0,0 +1,325 @@
+/*
+ * StringBuilder Project
+ *
+ *
+ * CharIterator.h
+ *
+ * Date:        17/10/2026
+ *
+ * Author:      Mahmoud Yaman Seraj Alddin
+ *
+ * Purpose:     Header file for the CharIterator class,
+ *              the forward iterator over the characters of MyStringBuilder.
+ *              The per-character functions are defined inline below it.
+ *
+ * List of public Functions:
+ *      CharIterator()
+ *          No-arg constructor of the CharIterator class.
+ *
+ *      CharIterator(const Storage*, int)
+ *          Parameterized constructor of the CharIterator class.
+ *
+ *      const char& operator*() const
+ *          Returns a reference to the current character.
+ *
+ *      const char* operator->() const
+ *          Returns a pointer to the current character.
+ *
+ *      CharIterator& operator++()
+ *          Moves to the next character, returns `this`.
+ *
+ *      CharIterator operator++(int)
+ *          Moves to the next character, returns the previous iterator.
+ *
+ *      bool operator==(const CharIterator&) const
+ *          Returns true if both iterators are at the same position.
+ *
+ *      bool operator!=(const CharIterator&) const
+ *          Returns true if the iterators are at different positions.
+ *
+ *      int getPosition() const
+ *          Returns the position of the current character.
+ *
+ * List of private Functions:
+ *      void load()
+ *          Caches the run of characters starting at the position.
+ */
+
+#ifndef MYSTRINGBUILDER_CHARITERATOR_H
+#define MYSTRINGBUILDER_CHARITERATOR_H
+
+#include <cstddef>
+#include <iterator>
+
+#include "Storage.h"
+
+/*
+ * CharIterator visits the characters of a Storage in order.
+ * It caches the contiguous run holding the current character (the finger),
+ * so the Storage is only searched once per run, not once per character.
+ * Any change to the Storage invalidates its iterators.
+ */
+class CharIterator {
+public:
+    /* Iterator traits, the characters are read-only */
+    typedef std::forward_iterator_tag iterator_category;
+    typedef char value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef const char* pointer;
+    typedef const char& reference;
+
+    /*
+     * Pre-Conditions:
+     *      No preconditions.
+     *
+     * Post-Conditions:
+     *      A singular CharIterator instance is created,
+     *      not attached to any Storage.
+     *
+     * No-arg constructor of the CharIterator class.
+     */
+    CharIterator();
+
+    /*
+     * Pre-Conditions:
+     *      Pointer to a Storage, not changed while the iterator is used.
+     *      Given int position is valid, at most the Storage length.
+     *
+     * Post-Conditions:
+     *      A CharIterator instance at the given position is created.
+     *      The position equal to the length is the end iterator.
+     *
+     * Parameterized constructor of the CharIterator class.
+     */
+    CharIterator(const Storage*, int);
+
+    /*
+     * Pre-Conditions:
+     *      `this` CharIterator instance is not the end iterator.
+     *
+     * Post-Conditions:
+     *      const reference to the current character is returned.
+     *      No changes to `this`.
+     *
+     * Returns a reference to the current character.
+     */
+    reference operator*() const;
+
+    /*
+     * Pre-Conditions:
+     *      `this` CharIterator instance is not the end iterator.
+     *
+     * Post-Conditions:
+     *      Pointer to the current character is returned.
+     *      No changes to `this`.
+     *
+     * Returns a pointer to the current character.
+     */
+    pointer operator->() const;
+
+    /*
+     * Pre-Conditions:
+     *      `this` CharIterator instance is not the end iterator.
+     *
+     * Post-Conditions:
+     *      `this` is at the next character.
+     *      Returns a reference to `this`.
+     *
+     * Moves to the next character, returns `this`.
+     */
+    CharIterator& operator++();
+
+    /*
+     * Pre-Conditions:
+     *      `this` CharIterator instance is not the end iterator.
+     *
+     * Post-Conditions:
+     *      `this` is at the next character.
+     *      Returns a copy of `this` before the move.
+     *
+     * Moves to the next character, returns the previous iterator.
+     */
+    CharIterator operator++(int);
+
+    /*
+     * Pre-Conditions:
+     *      const reference to a CharIterator of the same Storage.
+     *
+     * Post-Conditions:
+     *      Returns true if both iterators are at the same position.
+     *      No changes to `this`.
+     *
+     * Returns true if both iterators are at the same position.
+     */
+    bool operator==(const CharIterator&) const;
+
+    /*
+     * Pre-Conditions:
+     *      const reference to a CharIterator of the same Storage.
+     *
+     * Post-Conditions:
+     *      Returns true if the iterators are at different positions.
+     *      No changes to `this`.
+     *
+     * Returns true if the iterators are at different positions.
+     */
+    bool operator!=(const CharIterator&) const;
+
+    /*
+     * Pre-Conditions:
+     *      `this` CharIterator instance is initialized.
+     *
+     * Post-Conditions:
+     *      Position of the current character is returned.
+     *      No changes to `this`.
+     *
+     * Returns the position of the current character.
+     */
+    [[nodiscard]] int getPosition() const;
+
+private:
+    /*
+     * Pre-Conditions:
+     *      `this` CharIterator instance is initialized.
+     *
+     * Post-Conditions:
+     *      current points to the character at the position &
+     *      remaining is the number of characters of its run.
+     *      For the end position, current is nullptr.
+     *
+     * Caches the run of characters starting at the position.
+     */
+    void load();
+
+    /* Storage of the characters, nullptr for a singular iterator */
+    const Storage *storage;
+
+    /* Position of the current character */
+    int position;
+
+    /* Current character, inside the cached run */
+    const char *current;
+
+    /* Number of characters left in the cached run, including current */
+    int remaining;
+};
+
+/*
+ * The functions called once per character are defined here, so they
+ * inline into the loops of the callers.
+ */
+
+/*
+ * Pre-Conditions:
+ *      `this` CharIterator instance is not the end iterator.
+ *
+ * Post-Conditions:
+ *      const reference to the current character is returned.
+ *      No changes to `this`.
+ *
+ * The reference points into the Storage, O(1).
+ * Returns a reference to the current character.
+ */
+inline CharIterator::reference CharIterator::operator*() const {
+    return *current;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` CharIterator instance is not the end iterator.
+ *
+ * Post-Conditions:
+ *      Pointer to the current character is returned.
+ *      No changes to `this`.
+ *
+ * Returns a pointer to the current character.
+ */
+inline CharIterator::pointer CharIterator::operator->() const {
+    return current;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` CharIterator instance is not the end iterator.
+ *
+ * Post-Conditions:
+ *      `this` is at the next character.
+ *      Returns a reference to `this`.
+ *
+ * Moves inside the cached run, the Storage is only searched when the
+ * run is exhausted, amortized O(1). Only that refill, load, is out of line.
+ * Moves to the next character, returns `this`.
+ */
+inline CharIterator& CharIterator::operator++() {
+    position++;
+
+    if (1 < remaining) {
+        current++;
+        remaining--;
+    } else {
+        load();
+    }
+
+    return *this;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` CharIterator instance is not the end iterator.
+ *
+ * Post-Conditions:
+ *      `this` is at the next character.
+ *      Returns a copy of `this` before the move.
+ *
+ * Moves to the next character, returns the previous iterator.
+ */
+inline CharIterator CharIterator::operator++(int) {
+    CharIterator previous = *this;
+
+    ++*this;
+    return previous;
+}
+
+/*
+ * Pre-Conditions:
+ *      const reference to a CharIterator of the same Storage.
+ *
+ * Post-Conditions:
+ *      Returns true if both iterators are at the same position.
+ *      No changes to `this`.
+ *
+ * Returns true if both iterators are at the same position.
+ */
+inline bool CharIterator::operator==(const CharIterator& other) const {
+    return storage == other.storage and position == other.position;
+}
+
+/*
+ * Pre-Conditions:
+ *      const reference to a CharIterator of the same Storage.
+ *
+ * Post-Conditions:
+ *      Returns true if the iterators are at different positions.
+ *      No changes to `this`.
+ *
+ * Returns true if the iterators are at different positions.
+ */
+inline bool CharIterator::operator!=(const CharIterator& other) const {
+    return not (*this == other);
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` CharIterator instance is initialized.
+ *
+ * Post-Conditions:
+ *      Position of the current character is returned.
+ *      No changes to `this`.
+ *
+ * Returns the position of the current character.
+ */
+inline int CharIterator::getPosition() const {
+    return position;
+}
+
+#endif /* MYSTRINGBUILDER_CHARITERATOR_H */
@@ -0,0 +1,331 @@
+/*
+ * StringBuilder Project
+ *
+ *
+ * ConcurrentBuilder.cpp
+ *
+ * Date:        17/10/2026
+ *
+ * Author:      Mahmoud Yaman Seraj Alddin
+ *
+ * Purpose:     Implementation of the ConcurrentBuilder class,
+ *              described in ConcurrentBuilder.h
+ *
+ * List of public Functions:
+ *      ConcurrentBuilder(Order order = Order::kPerThread,
+ *                        MyStringBuilder::Mode mode = Mode::kRope)
+ *          Parameterized constructor of the ConcurrentBuilder class.
+ *
+ *      ~ConcurrentBuilder()
+ *          Destructor for the ConcurrentBuilder class.
+ *
+ *      ConcurrentBuilder& append(std::string_view)
+ *          Appends the given characters to the segment of the
+ *          calling thread.
+ *
+ *      int length() const
+ *          Returns the number of characters appended.
+ *
+ *      int segmentCount() const
+ *          Returns the number of threads that appended.
+ *
+ *      MyStringBuilder& flatten()
+ *          Merges the segments into the MyStringBuilder & returns it.
+ *
+ *      std::string toString()
+ *          Returns a string of all the characters appended.
+ *
+ *      void writeTo(int)
+ *          Writes all the characters appended to the given
+ *          file descriptor.
+ *
+ *      Order getOrder() const
+ *          Returns the merge order of the ConcurrentBuilder.
+ *
+ * List of private Functions:
+ *      Segment& localSegment()
+ *          Returns the segment of the calling thread.
+ *
+ *      void mergeByTicket()
+ *          Appends the fragments of all the segments to merged,
+ *          in ticket order.
+ */
+
+#include <functional>
+#include <queue>
+#include <utility>
+
+#include "ConcurrentBuilder.h"
+
+using namespace std;
+
+atomic<unsigned long long> ConcurrentBuilder::nextId{1};
+
+thread_local ConcurrentBuilder::Binding ConcurrentBuilder::binding{0, nullptr};
+
+/*
+ * Pre-Conditions:
+ *      Merge order (optional), default is Order::kPerThread.
+ *      Storage mode of the merged MyStringBuilder (optional),
+ *      default is Mode::kRope.
+ *
+ * Post-Conditions:
+ *      An empty ConcurrentBuilder instance is created.
+ *
+ * Parameterized constructor of the ConcurrentBuilder class.
+ */
+ConcurrentBuilder::ConcurrentBuilder(Order order, MyStringBuilder::Mode mode)
+        : id{nextId++}, order{order}, tickets{0}, registry{}, segments{},
+          owners{}, merged("", mode) {}
+
+/*
+ * Pre-Conditions:
+ *      `this` ConcurrentBuilder instance is not destroyed.
+ *      No thread is appending.
+ *
+ * Post-Conditions:
+ *      `this` ConcurrentBuilder instance & its segments are destroyed.
+ *
+ * The bindings of the threads keep the identifier of `this`,
+ * which no later builder receives.
+ * Destructor for the ConcurrentBuilder class.
+ */
+ConcurrentBuilder::~ConcurrentBuilder() {
+    for (Segment *segment: segments) {
+        delete segment;
+    }
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` ConcurrentBuilder instance is initialized.
+ *      string_view of the characters to append.
+ *      No merge is running.
+ *
+ * Post-Conditions:
+ *      The characters are appended to the segment of the calling
+ *      thread, as one fragment.
+ *      A reference to `this` is returned.
+ *
+ * Only the calling thread writes its segment, so no lock is taken,
+ * in ticket order the only shared write is the ticket counter.
+ * Safe to call from many threads at once.
+ * Appends the given characters to the segment of the calling thread.
+ */
+ConcurrentBuilder& ConcurrentBuilder::append(string_view s) {
+    Segment& segment = localSegment();
+
+    segment.text.append(s.data(), s.size());
+
+    /* The merge is ordered by the joins, relaxed is enough */
+    if (order == Order::kTicket) {
+        segment.fragments.push_back(
+                Fragment{tickets.fetch_add(1, memory_order_relaxed),
+                         (int) segment.text.size()}
+        );
+    }
+
+    return *this;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` ConcurrentBuilder instance is initialized.
+ *      No thread is appending.
+ *
+ * Post-Conditions:
+ *      Number of characters appended, merged or not, is returned.
+ *      No changes to `this`.
+ *
+ * Returns the number of characters appended.
+ */
+int ConcurrentBuilder::length() const {
+    lock_guard<mutex> lock(registry);
+    int result = merged.length();
+
+    for (const Segment *segment: segments) {
+        result += (int) segment->text.size();
+    }
+
+    return result;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` ConcurrentBuilder instance is initialized.
+ *
+ * Post-Conditions:
+ *      Number of segments is returned.
+ *      No changes to `this`.
+ *
+ * Returns the number of threads that appended.
+ */
+int ConcurrentBuilder::segmentCount() const {
+    lock_guard<mutex> lock(registry);
+
+    return (int) segments.size();
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` ConcurrentBuilder instance is initialized.
+ *      No thread is appending.
+ *
+ * Post-Conditions:
+ *      The characters of the segments are appended to the merged
+ *      MyStringBuilder in the order of `this`, the segments are empty.
+ *      A reference to the merged MyStringBuilder is returned,
+ *      valid as long as `this`.
+ *
+ * The segments keep their capacity, so the threads appending after
+ * the merge do not regrow them.
+ * Merges the segments into the MyStringBuilder & returns it.
+ */
+MyStringBuilder& ConcurrentBuilder::flatten() {
+    lock_guard<mutex> lock(registry);
+
+    if (order == Order::kTicket) {
+        mergeByTicket();
+    } else {
+        for (Segment *segment: segments) {
+            merged.append(string_view(segment->text));
+        }
+    }
+
+    for (Segment *segment: segments) {
+        segment->text.clear();
+        segment->fragments.clear();
+    }
+
+    return merged;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` ConcurrentBuilder instance is initialized.
+ *      No thread is appending.
+ *
+ * Post-Conditions:
+ *      The segments are merged.
+ *      A string of all the characters appended is returned.
+ *
+ * Returns a string of all the characters appended.
+ */
+string ConcurrentBuilder::toString() {
+    return flatten().toString();
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` ConcurrentBuilder instance is initialized.
+ *      int of a file descriptor open for writing.
+ *      No thread is appending.
+ *
+ * Post-Conditions:
+ *      The segments are merged.
+ *      All the characters appended are written to the descriptor.
+ *      A system_error exception is thrown if a write fails.
+ *
+ * The merged MyStringBuilder is written with writev, chunk by chunk.
+ * Writes all the characters appended to the given file descriptor.
+ */
+void ConcurrentBuilder::writeTo(int fd) {
+    flatten().writeTo(fd);
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` ConcurrentBuilder instance is initialized.
+ *
+ * Post-Conditions:
+ *      Merge order of `this` is returned.
+ *      No changes to `this`.
+ *
+ * Returns the merge order of the ConcurrentBuilder.
+ */
+ConcurrentBuilder::Order ConcurrentBuilder::getOrder() const {
+    return order;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` ConcurrentBuilder instance is initialized.
+ *
+ * Post-Conditions:
+ *      Reference to the segment of the calling thread is returned,
+ *      created on its first call.
+ *
+ * The thread local binding answers without a lock while the thread
+ * keeps appending to the same builder, the registry is only locked
+ * when it switches builders.
+ * Returns the segment of the calling thread.
+ */
+ConcurrentBuilder::Segment& ConcurrentBuilder::localSegment() {
+    if (binding.builder == id) {
+        return *binding.segment;
+    }
+
+    lock_guard<mutex> lock(registry);
+    Segment *&segment = owners[this_thread::get_id()];
+
+    if (not segment) {
+        segment = new Segment();
+        segments.push_back(segment);
+    }
+
+    binding = Binding{id, segment};
+    return *segment;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` ConcurrentBuilder instance is initialized.
+ *      No thread is appending.
+ *
+ * Post-Conditions:
+ *      The fragments of all the segments are appended to merged,
+ *      by increasing ticket.
+ *
+ * The fragments of a segment are already in ticket order, so a heap of
+ * the next fragment of each segment merges them in O(log segments)
+ * per fragment.
+ * The output is gathered in kFlushLength characters before each
+ * append to merged.
+ * Appends the fragments of all the segments to merged,
+ * in ticket order.
+ */
+void ConcurrentBuilder::mergeByTicket() {
+    typedef pair<unsigned long long, int> Head;
+
+    priority_queue<Head, vector<Head>, greater<Head>> heads;
+    vector<int> next(segments.size(), 0);
+    string buffer{};
+
+    for (int i = 0; i < (int) segments.size(); i++) {
+        if (not segments[i]->fragments.empty()) {
+            heads.push({segments[i]->fragments[0].ticket, i});
+        }
+    }
+
+    while (not heads.empty()) {
+        const int i = heads.top().second;
+        const Segment& segment = *segments[i];
+        const int fragment = next[i]++;
+        const int begin = fragment ? segment.fragments[fragment - 1].end : 0;
+        const int end = segment.fragments[fragment].end;
+
+        heads.pop();
+        buffer.append(segment.text, begin, end - begin);
+
+        if (kFlushLength <= (int) buffer.size()) {
+            merged.append(string_view(buffer));
+            buffer.clear();
+        }
+
+        if (next[i] < (int) segment.fragments.size()) {
+            heads.push({segment.fragments[next[i]].ticket, i});
+        }
+    }
+
+    merged.append(string_view(buffer));
+}
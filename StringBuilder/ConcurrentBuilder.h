@@ -0,0 +1,307 @@
+/*
+ * StringBuilder Project
+ *
+ *
+ * ConcurrentBuilder.h
+ *
+ * Date:        17/10/2026
+ *
+ * Author:      Mahmoud Yaman Seraj Alddin
+ *
+ * Purpose:     Header file for the ConcurrentBuilder class,
+ *              a MyStringBuilder appended to by many threads at once.
+ *
+ * List of public Functions:
+ *      ConcurrentBuilder(Order order = Order::kPerThread,
+ *                        MyStringBuilder::Mode mode = Mode::kRope)
+ *          Parameterized constructor of the ConcurrentBuilder class.
+ *
+ *      ~ConcurrentBuilder()
+ *          Destructor for the ConcurrentBuilder class.
+ *
+ *      ConcurrentBuilder& append(std::string_view)
+ *          Appends the given characters to the segment of the
+ *          calling thread.
+ *
+ *      int length() const
+ *          Returns the number of characters appended.
+ *
+ *      int segmentCount() const
+ *          Returns the number of threads that appended.
+ *
+ *      MyStringBuilder& flatten()
+ *          Merges the segments into the MyStringBuilder & returns it.
+ *
+ *      std::string toString()
+ *          Returns a string of all the characters appended.
+ *
+ *      void writeTo(int)
+ *          Writes all the characters appended to the given
+ *          file descriptor.
+ *
+ *      Order getOrder() const
+ *          Returns the merge order of the ConcurrentBuilder.
+ *
+ * List of private Functions:
+ *      Segment& localSegment()
+ *          Returns the segment of the calling thread.
+ *
+ *      void mergeByTicket()
+ *          Appends the fragments of all the segments to merged,
+ *          in ticket order.
+ */
+
+#ifndef MYSTRINGBUILDER_CONCURRENTBUILDER_H
+#define MYSTRINGBUILDER_CONCURRENTBUILDER_H
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "MyStringBuilder.h"
+
+/*
+ * ConcurrentBuilder gives each appending thread its own segment,
+ * so append takes no lock once the thread has appended once.
+ * The segments are merged into a MyStringBuilder on demand, by flatten,
+ * toString or writeTo, which must not run while threads append:
+ * the appends must happen before the merge, as after joining the
+ * threads or any other synchronization.
+ * Appends after a merge go to the segments again & are merged after
+ * the characters merged before.
+ */
+class ConcurrentBuilder {
+public:
+    /*
+     * Order of the appended characters once merged.
+     * Can be accessed outside the class using ConcurrentBuilder::Order.
+     *
+     *      kPerThread: The characters of each thread in the order it
+     *                  appended them, the threads in the order of their
+     *                  first append.
+     *
+     *      kTicket:    All the appends in the order they were made,
+     *                  each append takes a ticket from a shared counter.
+     */
+    enum class Order {
+        kPerThread,
+        kTicket,
+    };
+
+    /* Characters gathered by a ticket merge before appending them at once */
+    static const int kFlushLength = 1 << 16;
+
+    /*
+     * Pre-Conditions:
+     *      Merge order (optional), default is Order::kPerThread.
+     *      Storage mode of the merged MyStringBuilder (optional),
+     *      default is Mode::kRope.
+     *
+     * Post-Conditions:
+     *      An empty ConcurrentBuilder instance is created.
+     *
+     * Parameterized constructor of the ConcurrentBuilder class.
+     */
+    explicit ConcurrentBuilder(Order order = Order::kPerThread,
+                               MyStringBuilder::Mode mode
+                               = MyStringBuilder::Mode::kRope);
+
+    /* Threads keep pointers to the segments, no copies */
+    ConcurrentBuilder(const ConcurrentBuilder&) = delete;
+
+    ConcurrentBuilder& operator=(const ConcurrentBuilder&) = delete;
+
+    /*
+     * Pre-Conditions:
+     *      `this` ConcurrentBuilder instance is not destroyed.
+     *      No thread is appending.
+     *
+     * Post-Conditions:
+     *      `this` ConcurrentBuilder instance & its segments are destroyed.
+     *
+     * Destructor for the ConcurrentBuilder class.
+     */
+    ~ConcurrentBuilder();
+
+    /*
+     * Pre-Conditions:
+     *      `this` ConcurrentBuilder instance is initialized.
+     *      string_view of the characters to append.
+     *      No merge is running.
+     *
+     * Post-Conditions:
+     *      The characters are appended to the segment of the calling
+     *      thread, as one fragment.
+     *      A reference to `this` is returned.
+     *
+     * Safe to call from many threads at once.
+     * Appends the given characters to the segment of the calling thread.
+     */
+    ConcurrentBuilder& append(std::string_view);
+
+    /*
+     * Pre-Conditions:
+     *      `this` ConcurrentBuilder instance is initialized.
+     *      No thread is appending.
+     *
+     * Post-Conditions:
+     *      Number of characters appended, merged or not, is returned.
+     *      No changes to `this`.
+     *
+     * Returns the number of characters appended.
+     */
+    [[nodiscard]] int length() const;
+
+    /*
+     * Pre-Conditions:
+     *      `this` ConcurrentBuilder instance is initialized.
+     *
+     * Post-Conditions:
+     *      Number of segments is returned.
+     *      No changes to `this`.
+     *
+     * Returns the number of threads that appended.
+     */
+    [[nodiscard]] int segmentCount() const;
+
+    /*
+     * Pre-Conditions:
+     *      `this` ConcurrentBuilder instance is initialized.
+     *      No thread is appending.
+     *
+     * Post-Conditions:
+     *      The characters of the segments are appended to the merged
+     *      MyStringBuilder in the order of `this`, the segments are empty.
+     *      A reference to the merged MyStringBuilder is returned,
+     *      valid as long as `this`.
+     *
+     * Merges the segments into the MyStringBuilder & returns it.
+     */
+    MyStringBuilder& flatten();
+
+    /*
+     * Pre-Conditions:
+     *      `this` ConcurrentBuilder instance is initialized.
+     *      No thread is appending.
+     *
+     * Post-Conditions:
+     *      The segments are merged.
+     *      A string of all the characters appended is returned.
+     *
+     * Returns a string of all the characters appended.
+     */
+    [[nodiscard]] std::string toString();
+
+    /*
+     * Pre-Conditions:
+     *      `this` ConcurrentBuilder instance is initialized.
+     *      int of a file descriptor open for writing.
+     *      No thread is appending.
+     *
+     * Post-Conditions:
+     *      The segments are merged.
+     *      All the characters appended are written to the descriptor.
+     *      A system_error exception is thrown if a write fails.
+     *
+     * Writes all the characters appended to the given file descriptor.
+     */
+    void writeTo(int);
+
+    /*
+     * Pre-Conditions:
+     *      `this` ConcurrentBuilder instance is initialized.
+     *
+     * Post-Conditions:
+     *      Merge order of `this` is returned.
+     *      No changes to `this`.
+     *
+     * Returns the merge order of the ConcurrentBuilder.
+     */
+    [[nodiscard]] Order getOrder() const;
+
+private:
+    /*
+     * Characters appended by one call, in ticket order.
+     * end is the position after its last character in the segment.
+     */
+    struct Fragment {
+        unsigned long long ticket;
+        int end;
+    };
+
+    /*
+     * Characters appended by one thread.
+     * Aligned to a cache line, so threads never write the same line.
+     */
+    struct alignas(64) Segment {
+        std::string text;
+
+        /* Only filled in ticket order */
+        std::vector<Fragment> fragments;
+    };
+
+    /* Segment of the builder the calling thread appended to last */
+    struct Binding {
+        unsigned long long builder;
+        Segment *segment;
+    };
+
+    /*
+     * Pre-Conditions:
+     *      `this` ConcurrentBuilder instance is initialized.
+     *
+     * Post-Conditions:
+     *      Reference to the segment of the calling thread is returned,
+     *      created on its first call.
+     *
+     * Returns the segment of the calling thread.
+     */
+    Segment& localSegment();
+
+    /*
+     * Pre-Conditions:
+     *      `this` ConcurrentBuilder instance is initialized.
+     *      No thread is appending.
+     *
+     * Post-Conditions:
+     *      The fragments of all the segments are appended to merged,
+     *      by increasing ticket.
+     *
+     * Appends the fragments of all the segments to merged,
+     * in ticket order.
+     */
+    void mergeByTicket();
+
+    /* Source of the identifiers of the builders, never reused */
+    static std::atomic<unsigned long long> nextId;
+
+    /* Segment last used by the calling thread */
+    static thread_local Binding binding;
+
+    /* Identifier of `this`, unlike its address never reused */
+    const unsigned long long id;
+
+    /* Merge order */
+    const Order order;
+
+    /* Next ticket, only used in ticket order */
+    std::atomic<unsigned long long> tickets;
+
+    /* Guards segments & owners */
+    mutable std::mutex registry;
+
+    /* Segments in the order of the first append of their thread */
+    std::vector<Segment*> segments;
+
+    /* Segment of each thread */
+    std::map<std::thread::id, Segment*> owners;
+
+    /* Characters merged so far */
+    MyStringBuilder merged;
+};
+
+#endif /* MYSTRINGBUILDER_CONCURRENTBUILDER_H */
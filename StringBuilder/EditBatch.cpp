@@ -0,0 +1,227 @@
+/*
+ * StringBuilder Project
+ *
+ *
+ * EditBatch.cpp
+ *
+ * Date:        17/10/2026
+ *
+ * Author:      Mahmoud Yaman Seraj Alddin
+ *
+ * Purpose:     Implementation of the EditBatch class,
+ *              described in EditBatch.h
+ *
+ * List of public Functions:
+ *      EditBatch()
+ *          No-arg constructor of the EditBatch class.
+ *
+ *      EditBatch& insert(int, std::string)
+ *          Adds the insertion of the given string at the given position.
+ *
+ *      EditBatch& replace(int begin, int end, std::string)
+ *          Adds the replacement of the characters between begin & end
+ *          by the given string.
+ *
+ *      EditBatch& clear(int begin, int end)
+ *          Adds the removal of the characters between begin & end.
+ *
+ *      int size() const
+ *          Returns the number of edits added to the EditBatch.
+ *
+ *      void applyTo(Storage&) const
+ *          Applies all the edits to the given Storage.
+ *
+ * List of private Functions:
+ *      std::vector<Edit> merge(int) const
+ *          Returns the edits sorted by position, with the adjacent
+ *          edits merged.
+ */
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "EditBatch.h"
+
+using namespace std;
+
+/*
+ * Pre-Conditions:
+ *      No preconditions.
+ *
+ * Post-Conditions:
+ *      An empty EditBatch instance is created.
+ *
+ * No-arg constructor of the EditBatch class.
+ */
+EditBatch::EditBatch(): edits{} {}
+
+/*
+ * Pre-Conditions:
+ *      `this` EditBatch instance is initialized.
+ *      int of a position in the original characters, at least 0.
+ *      The string to insert.
+ *
+ * Post-Conditions:
+ *      The insertion is added to `this`.
+ *      An invalid_argument exception is thrown if the position
+ *      is negative.
+ *      A reference to `this` is returned.
+ *
+ * Equivalent to replace(position, position, s).
+ * Adds the insertion of the given string at the given position.
+ */
+EditBatch& EditBatch::insert(int position, string s) {
+    return replace(position, position, std::move(s));
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` EditBatch instance is initialized.
+ *      begin & end are positions in the original characters,
+ *      0 <= begin <= end.
+ *      The string replacing the characters.
+ *
+ * Post-Conditions:
+ *      The replacement is added to `this`.
+ *      An invalid_argument exception is thrown if the range
+ *      is invalid.
+ *      A reference to `this` is returned.
+ *
+ * The end of the range is checked against the characters
+ * when the batch is applied.
+ * Adds the replacement of the characters between begin (inclusive)
+ * & end (exclusive) by the given string.
+ */
+EditBatch& EditBatch::replace(int begin, int end, string s) {
+    if (begin < 0 or end < begin) {
+        throw invalid_argument(
+                "Invalid range " + to_string(begin) + " -> " + to_string(end)
+                + ". Must have 0 <= begin <= end.\n"
+        );
+    }
+
+    edits.push_back(Edit{begin, end, std::move(s)});
+    return *this;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` EditBatch instance is initialized.
+ *      begin & end are positions in the original characters,
+ *      0 <= begin <= end.
+ *
+ * Post-Conditions:
+ *      The removal is added to `this`.
+ *      An invalid_argument exception is thrown if the range
+ *      is invalid.
+ *      A reference to `this` is returned.
+ *
+ * Equivalent to replace(begin, end, "").
+ * Adds the removal of the characters between begin (inclusive)
+ * & end (exclusive).
+ */
+EditBatch& EditBatch::clear(int begin, int end) {
+    return replace(begin, end, "");
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` EditBatch instance is initialized.
+ *
+ * Post-Conditions:
+ *      Number of edits added is returned.
+ *      No changes to `this`.
+ *
+ * Returns the number of edits added to the EditBatch.
+ */
+int EditBatch::size() const {
+    return (int) edits.size();
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` EditBatch instance is initialized.
+ *      Reference to the Storage of the original characters.
+ *
+ * Post-Conditions:
+ *      The given Storage holds the edited characters.
+ *      An invalid_argument exception is thrown, with the Storage
+ *      unchanged, if an edit ends past the Storage or two
+ *      removed ranges overlap.
+ *      No changes to `this`.
+ *
+ * The merged edits neither overlap nor touch, so applying them from
+ * the last to the first keeps the positions of the rest valid.
+ * Only the edits are written, the characters between them stay in
+ * their leaves, Nodes or pieces, each edit costs a positional erase
+ * & insert of its own characters.
+ * Applies all the edits to the given Storage.
+ */
+void EditBatch::applyTo(Storage& target) const {
+    const vector<Edit> merged = merge(target.length());
+
+    for (auto edit = merged.rbegin(); edit != merged.rend(); ++edit) {
+        target.erase(edit->begin, edit->end);
+        target.insert(edit->begin, edit->text.data(), (int) edit->text.size());
+    }
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` EditBatch instance is initialized.
+ *      int of the number of original characters.
+ *
+ * Post-Conditions:
+ *      The edits are returned sorted by position, insertions before
+ *      a removal at the same position, the edits touching each other
+ *      merged into one.
+ *      An invalid_argument exception is thrown if an edit ends past
+ *      the given length or two removed ranges overlap.
+ *      No changes to `this`.
+ *
+ * The sort is stable, so insertions at the same position keep
+ * the order they were added in.
+ * Returns the edits sorted by position, with the adjacent
+ * edits merged.
+ */
+vector<EditBatch::Edit> EditBatch::merge(int count) const {
+    vector<const Edit*> order;
+
+    for (const auto& edit: edits) {
+        order.push_back(&edit);
+    }
+
+    stable_sort(order.begin(), order.end(), [](const Edit *a, const Edit *b) {
+        const bool aRemoves = a->begin < a->end;
+        const bool bRemoves = b->begin < b->end;
+
+        return a->begin < b->begin
+               or (a->begin == b->begin and not aRemoves and bRemoves);
+    });
+
+    vector<Edit> merged;
+
+    for (const Edit *edit: order) {
+        if (count < edit->end) {
+            throw invalid_argument(
+                    "Invalid index " + to_string(edit->end)
+                    + ". Must be between 0 & " + to_string(count) + ".\n"
+            );
+        } else if (not merged.empty() and edit->begin < merged.back().end) {
+            throw invalid_argument(
+                    "Overlapping edits at " + to_string(edit->begin)
+                    + ", a removed range ends at "
+                    + to_string(merged.back().end) + ".\n"
+            );
+        }
+
+        if (not merged.empty() and merged.back().end == edit->begin) {
+            merged.back().end = edit->end;
+            merged.back().text += edit->text;
+        } else {
+            merged.push_back(*edit);
+        }
+    }
+
+    return merged;
+}
@@ -0,0 +1,186 @@
+/*
+ * StringBuilder Project
+ *
+ *
+ * EditBatch.h
+ *
+ * Date:        17/10/2026
+ *
+ * Author:      Mahmoud Yaman Seraj Alddin
+ *
+ * Purpose:     Header file for the EditBatch class,
+ *              a script of edits applied to a MyStringBuilder at once.
+ *
+ * List of public Functions:
+ *      EditBatch()
+ *          No-arg constructor of the EditBatch class.
+ *
+ *      EditBatch& insert(int, std::string)
+ *          Adds the insertion of the given string at the given position.
+ *
+ *      EditBatch& replace(int begin, int end, std::string)
+ *          Adds the replacement of the characters between begin & end
+ *          by the given string.
+ *
+ *      EditBatch& clear(int begin, int end)
+ *          Adds the removal of the characters between begin & end.
+ *
+ *      int size() const
+ *          Returns the number of edits added to the EditBatch.
+ *
+ *      void applyTo(Storage&) const
+ *          Applies all the edits to the given Storage.
+ *
+ * List of private Functions:
+ *      std::vector<Edit> merge(int) const
+ *          Returns the edits sorted by position, with the adjacent
+ *          edits merged.
+ */
+
+#ifndef MYSTRINGBUILDER_EDITBATCH_H
+#define MYSTRINGBUILDER_EDITBATCH_H
+
+#include <string>
+#include <vector>
+
+#include "Storage.h"
+
+/*
+ * EditBatch records edits in the coordinates of the original characters,
+ * before any edit of the batch is applied, in any order.
+ * The removed ranges must not overlap, they may touch.
+ * Insertions at the same position keep the order they were added in,
+ * they come before a removal starting at that position
+ * & after a removal ending at it.
+ * Applying the batch gives the same characters as applying each edit
+ * in turn, after shifting its positions by the edits before it,
+ * but never shifts a position & leaves the characters between
+ * the edits where they are.
+ */
+class EditBatch {
+public:
+    /*
+     * Pre-Conditions:
+     *      No preconditions.
+     *
+     * Post-Conditions:
+     *      An empty EditBatch instance is created.
+     *
+     * No-arg constructor of the EditBatch class.
+     */
+    EditBatch();
+
+    /*
+     * Pre-Conditions:
+     *      `this` EditBatch instance is initialized.
+     *      int of a position in the original characters, at least 0.
+     *      The string to insert.
+     *
+     * Post-Conditions:
+     *      The insertion is added to `this`.
+     *      An invalid_argument exception is thrown if the position
+     *      is negative.
+     *      A reference to `this` is returned.
+     *
+     * Adds the insertion of the given string at the given position.
+     */
+    EditBatch& insert(int, std::string);
+
+    /*
+     * Pre-Conditions:
+     *      `this` EditBatch instance is initialized.
+     *      begin & end are positions in the original characters,
+     *      0 <= begin <= end.
+     *      The string replacing the characters.
+     *
+     * Post-Conditions:
+     *      The replacement is added to `this`.
+     *      An invalid_argument exception is thrown if the range
+     *      is invalid.
+     *      A reference to `this` is returned.
+     *
+     * Adds the replacement of the characters between begin (inclusive)
+     * & end (exclusive) by the given string.
+     */
+    EditBatch& replace(int /* begin */, int /* end */, std::string);
+
+    /*
+     * Pre-Conditions:
+     *      `this` EditBatch instance is initialized.
+     *      begin & end are positions in the original characters,
+     *      0 <= begin <= end.
+     *
+     * Post-Conditions:
+     *      The removal is added to `this`.
+     *      An invalid_argument exception is thrown if the range
+     *      is invalid.
+     *      A reference to `this` is returned.
+     *
+     * Adds the removal of the characters between begin (inclusive)
+     * & end (exclusive).
+     */
+    EditBatch& clear(int /* begin */, int /* end */);
+
+    /*
+     * Pre-Conditions:
+     *      `this` EditBatch instance is initialized.
+     *
+     * Post-Conditions:
+     *      Number of edits added is returned.
+     *      No changes to `this`.
+     *
+     * Returns the number of edits added to the EditBatch.
+     */
+    [[nodiscard]] int size() const;
+
+    /*
+     * Pre-Conditions:
+     *      `this` EditBatch instance is initialized.
+     *      Reference to the Storage of the original characters.
+     *
+     * Post-Conditions:
+     *      The given Storage holds the edited characters.
+     *      An invalid_argument exception is thrown, with the Storage
+     *      unchanged, if an edit ends past the Storage or two
+     *      removed ranges overlap.
+     *      No changes to `this`.
+     *
+     * Applies all the edits to the given Storage.
+     */
+    void applyTo(Storage&) const;
+
+private:
+    /*
+     * Replacement of the original characters between begin (inclusive)
+     * & end (exclusive) by text.
+     * An insertion has begin == end, a removal has an empty text.
+     */
+    struct Edit {
+        int begin;
+        int end;
+        std::string text;
+    };
+
+    /*
+     * Pre-Conditions:
+     *      `this` EditBatch instance is initialized.
+     *      int of the number of original characters.
+     *
+     * Post-Conditions:
+     *      The edits are returned sorted by position, insertions before
+     *      a removal at the same position, the edits touching each other
+     *      merged into one.
+     *      An invalid_argument exception is thrown if an edit ends past
+     *      the given length or two removed ranges overlap.
+     *      No changes to `this`.
+     *
+     * Returns the edits sorted by position, with the adjacent
+     * edits merged.
+     */
+    [[nodiscard]] std::vector<Edit> merge(int) const;
+
+    /* Edits in the order they were added */
+    std::vector<Edit> edits;
+};
+
+#endif /* MYSTRINGBUILDER_EDITBATCH_H */
@@ -0,0 +1,491 @@
+/*
+ * StringBuilder Project
+ *
+ *
+ * GapBufferStorage.cpp
+ *
+ * Date:        17/10/2026
+ *
+ * Author:      Mahmoud Yaman Seraj Alddin
+ *
+ * Purpose:     Implementation of the GapBufferStorage class,
+ *              described in GapBufferStorage.h
+ *
+ * List of public Functions:
+ *      GapBufferStorage()
+ *          No-arg constructor of the GapBufferStorage class.
+ *
+ *      GapBufferStorage(const char*, int)
+ *          Parameterized constructor of the GapBufferStorage class.
+ *
+ *      GapBufferStorage(std::string&&)
+ *          Parameterized constructor of the GapBufferStorage class.
+ *          Adopts the buffer of the given string.
+ *
+ *      Storage* copy(int begin, int end) const
+ *          Returns a new GapBufferStorage holding a copy of the characters
+ *          between begin (inclusive) & end (exclusive).
+ *
+ *      int length() const
+ *          Returns the number of characters in the buffer.
+ *
+ *      char charAt(int) const
+ *          Returns the character at the given position.
+ *
+ *      void insert(int, const char*, int)
+ *          Inserts a copy of the given characters at the given position.
+ *
+ *      void insert(int, const Storage&)
+ *          Inserts a copy of the characters of the given Storage at the
+ *          given position.
+ *
+ *      void splice(int, Storage&)
+ *          Moves the characters of the given Storage to the given position,
+ *          leaving the given Storage empty.
+ *
+ *      void erase(int begin, int end)
+ *          Removes the characters between begin (inclusive)
+ *          & end (exclusive).
+ *
+ *      bool forEachChunk(int begin, int end, const ChunkVisitor&) const
+ *          Visits the characters between begin & end as contiguous chunks.
+ *
+ *      void forEachMutableChunk(int begin, int end,
+ *                               const MutableChunkVisitor&)
+ *          Visits the characters between begin & end as writable
+ *          contiguous chunks.
+ *
+ *      char* reserveTail(int&)
+ *          Returns the free room after the last character, or nullptr.
+ *
+ *      void commitTail(int)
+ *          Appends the given count of characters written to the
+ *          reserved tail.
+ *
+ * List of private Functions:
+ *      void moveGap(int)
+ *          Moves the gap so that it starts at the given position.
+ *
+ *      void reserveGap(int)
+ *          Grows the buffer until the gap can take the given count.
+ */
+
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "GapBufferStorage.h"
+
+using namespace std;
+
+/*
+ * Pre-Conditions:
+ *      No preconditions.
+ *
+ * Post-Conditions:
+ *      An empty GapBufferStorage instance is created.
+ *      buffer is initialized to an empty string.
+ *      capacity, gapStart & gapEnd are initialized to 0.
+ *
+ * The buffer is only allocated on the first insertion.
+ * No-arg constructor of the GapBufferStorage class.
+ */
+GapBufferStorage::GapBufferStorage(): buffer{}, capacity{0},
+                                      gapStart{0}, gapEnd{0} {}
+
+/*
+ * Pre-Conditions:
+ *      Pointer to the characters to copy & their count.
+ *
+ * Post-Conditions:
+ *      A GapBufferStorage instance holding the given characters
+ *      is created, the gap is at the end.
+ *
+ * Parameterized constructor of the GapBufferStorage class.
+ */
+GapBufferStorage::GapBufferStorage(const char *data, int count):
+        GapBufferStorage() {
+    insert(0, data, count);
+}
+
+/*
+ * Pre-Conditions:
+ *      rvalue reference to the string to adopt.
+ *
+ * Post-Conditions:
+ *      A GapBufferStorage instance holding the characters of the
+ *      given string is created, without copying them.
+ *      The gap is empty, at the end.
+ *      The given string is left empty.
+ *
+ * The first insertion grows the buffer, as it would for a full buffer.
+ * Parameterized constructor of the GapBufferStorage class.
+ * Adopts the buffer of the given string.
+ */
+GapBufferStorage::GapBufferStorage(string&& s): buffer{std::move(s)},
+                                                capacity{0},
+                                                gapStart{0}, gapEnd{0} {
+    capacity = (int) buffer.size();
+    gapStart = capacity;
+    gapEnd = capacity;
+    s.clear();
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` GapBufferStorage instance is initialized.
+ *      begin & end are valid positions, begin <= end.
+ *
+ * Post-Conditions:
+ *      A heap allocated GapBufferStorage is returned.
+ *      No changes to `this`.
+ *
+ * Returns a new GapBufferStorage holding a copy of the characters
+ * between begin (inclusive) & end (exclusive).
+ */
+Storage* GapBufferStorage::copy(int begin, int end) const {
+    auto result = new GapBufferStorage();
+
+    result->reserveGap(end - begin);
+
+    forEachChunk(begin, end, [result](const char *data, int count) {
+        result->insert(result->gapStart, data, count);
+        return true;
+    });
+
+    return result;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` GapBufferStorage instance is initialized.
+ *
+ * Post-Conditions:
+ *      Number of characters in the buffer is returned.
+ *      No changes to `this`.
+ *
+ * Returns the number of characters in the buffer.
+ */
+int GapBufferStorage::length() const {
+    return capacity - (gapEnd - gapStart);
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` GapBufferStorage instance is initialized.
+ *      Given int position is valid, less than length().
+ *
+ * Post-Conditions:
+ *      Character at the given position is returned.
+ *      No changes to `this`.
+ *
+ * Positions after the gap are shifted by its length, O(1).
+ * Returns the character at the given position.
+ */
+char GapBufferStorage::charAt(int position) const {
+    if (position < gapStart) {
+        return buffer[position];
+    }
+
+    return buffer[position + gapEnd - gapStart];
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` GapBufferStorage instance is initialized.
+ *      Given int position is valid.
+ *      Pointer to the characters to insert & their count.
+ *
+ * Post-Conditions:
+ *      The given characters are inserted at the given position.
+ *      The gap starts right after the inserted characters.
+ *
+ * Inserts a copy of the given characters at the given position.
+ */
+void GapBufferStorage::insert(int position, const char *data, int count) {
+    if (count <= 0) {
+        return;
+    }
+
+    moveGap(position);
+    reserveGap(count);
+
+    memcpy(&buffer[gapStart], data, count);
+    gapStart += count;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` GapBufferStorage instance is initialized.
+ *      Given int position is valid.
+ *      const reference to a Storage other than `this`.
+ *
+ * Post-Conditions:
+ *      The characters of the given Storage are inserted
+ *      at the given position.
+ *      No changes to the given Storage.
+ *
+ * The gap is moved & grown once, then the chunks are copied into it.
+ * Inserts a copy of the characters of the given Storage at the
+ * given position.
+ */
+void GapBufferStorage::insert(int position, const Storage& source) {
+    moveGap(position);
+    reserveGap(source.length());
+
+    source.forEachChunk(0, source.length(),
+                        [this](const char *data, int count) {
+        memcpy(&buffer[gapStart], data, count);
+        gapStart += count;
+
+        return true;
+    });
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` GapBufferStorage instance is initialized.
+ *      Given int position is valid.
+ *      Reference to a Storage other than `this`.
+ *
+ * Post-Conditions:
+ *      The characters of the given Storage are inserted
+ *      at the given position.
+ *      The given Storage is empty.
+ *
+ * If `this` is empty, the buffer of another GapBufferStorage is taken
+ * as is, otherwise the characters are copied.
+ * Moves the characters of the given Storage to the given position,
+ * leaving the given Storage empty.
+ */
+void GapBufferStorage::splice(int position, Storage& source) {
+    auto gapBuffer = dynamic_cast<GapBufferStorage*>(&source);
+
+    if (not gapBuffer or length()) {
+        Storage::splice(position, source);
+        return;
+    }
+
+    swap(buffer, gapBuffer->buffer);
+    swap(capacity, gapBuffer->capacity);
+    swap(gapStart, gapBuffer->gapStart);
+    swap(gapEnd, gapBuffer->gapEnd);
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` GapBufferStorage instance is initialized.
+ *      begin & end are valid positions, begin <= end.
+ *
+ * Post-Conditions:
+ *      The characters between begin & end are removed.
+ *      The gap starts at begin.
+ *
+ * The gap is moved to the range, then widened over it.
+ * Removes the characters between begin (inclusive) & end (exclusive).
+ */
+void GapBufferStorage::erase(int begin, int end) {
+    if (end <= begin) {
+        return;
+    }
+
+    moveGap(begin);
+    gapEnd += end - begin;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` GapBufferStorage instance is initialized.
+ *      begin & end are valid positions, begin <= end.
+ *      const reference to a ChunkVisitor.
+ *
+ * Post-Conditions:
+ *      The visitor is called for the characters before the gap,
+ *      then for those after it, until it returns false.
+ *      Returns false if the visitor stopped the visit.
+ *      No changes to `this`.
+ *
+ * Visits the characters between begin & end as contiguous chunks.
+ */
+bool GapBufferStorage::forEachChunk(int begin, int end,
+                                    const ChunkVisitor& visitor) const {
+    const int gap = gapEnd - gapStart;
+
+    /* Part of the range before the gap */
+    if (begin < gapStart and begin < end) {
+        const int until = min(end, gapStart);
+
+        if (not visitor(buffer.data() + begin, until - begin)) {
+            return false;
+        }
+
+        begin = until;
+    }
+
+    /* Part of the range after the gap */
+    if (begin < end) {
+        return visitor(buffer.data() + begin + gap, end - begin);
+    }
+
+    return true;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` GapBufferStorage instance is initialized.
+ *      begin & end are valid positions, begin <= end.
+ *      const reference to a MutableChunkVisitor.
+ *
+ * Post-Conditions:
+ *      The visitor is called for the characters before the gap,
+ *      then for those after it.
+ *      Changes made by the visitor are stored in the buffer.
+ *
+ * Visits the characters between begin & end as writable
+ * contiguous chunks.
+ */
+void GapBufferStorage::forEachMutableChunk(int begin, int end,
+                                           const MutableChunkVisitor& visitor) {
+    const int gap = gapEnd - gapStart;
+
+    /* Part of the range before the gap */
+    if (begin < gapStart and begin < end) {
+        const int until = min(end, gapStart);
+
+        visitor(&buffer[begin], until - begin);
+        begin = until;
+    }
+
+    /* Part of the range after the gap */
+    if (begin < end) {
+        visitor(&buffer[begin + gap], end - begin);
+    }
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` GapBufferStorage instance is initialized.
+ *      Reference to the most characters wanted, at least 1,
+ *      at most INT_MAX - length().
+ *
+ * Post-Conditions:
+ *      The gap is at the end.
+ *      Pointer to the start of the gap is returned, the given count
+ *      is lowered to the size of the gap.
+ *      nullptr is returned if the gap is empty.
+ *      length() is unchanged.
+ *
+ * The gap is the writable tail, so a reader fills it in place
+ * instead of going through a temporary buffer.
+ * The buffer is never grown here, a full buffer grows by the insertion
+ * of the reader, so reading stops at the end without doubling it.
+ * Returns the free room after the last character, or nullptr.
+ */
+char* GapBufferStorage::reserveTail(int& count) {
+    if (gapStart == gapEnd) {
+        return nullptr;
+    }
+
+    moveGap(length());
+    count = min(count, gapEnd - gapStart);
+
+    return &buffer[gapStart];
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` GapBufferStorage instance is initialized.
+ *      reserveTail returned room for at least the given count,
+ *      its first count characters are written.
+ *
+ * Post-Conditions:
+ *      The gap starts after the given count of characters.
+ *
+ * Appends the given count of characters written to the
+ * reserved tail.
+ */
+void GapBufferStorage::commitTail(int count) {
+    gapStart += count;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` GapBufferStorage instance is initialized.
+ *      Given int position is valid.
+ *
+ * Post-Conditions:
+ *      gapStart is the given position.
+ *      The characters between the old & new gap are moved
+ *      across the gap.
+ *
+ * Only the characters between the two gap positions are moved,
+ * so edits next to the previous edit move nothing.
+ * Moves the gap so that it starts at the given position.
+ */
+void GapBufferStorage::moveGap(int position) {
+    const int gap = gapEnd - gapStart;
+
+    if (position < gapStart) {
+        /* Move the characters between position & gap after the gap */
+        const int moved = gapStart - position;
+
+        memmove(&buffer[gapEnd - moved], &buffer[position], moved);
+    } else if (gapStart < position) {
+        /* Move the characters between gap & position before the gap */
+        const int moved = position - gapStart;
+
+        memmove(&buffer[gapStart], &buffer[gapEnd], moved);
+    }
+
+    gapStart = position;
+    gapEnd = position + gap;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` GapBufferStorage instance is initialized.
+ *      int of the number of free characters needed.
+ *
+ * Post-Conditions:
+ *      The gap is at least the given count long.
+ *      gapStart is unchanged.
+ *      A length_error exception is thrown if the characters & the gap
+ *      would exceed INT_MAX.
+ *
+ * The capacity at least doubles on growth, so a run of insertions is
+ * amortized O(1) per character. Near INT_MAX it is clamped instead.
+ * Grows the buffer until the gap can take the given count.
+ */
+void GapBufferStorage::reserveGap(int count) {
+    if (count <= gapEnd - gapStart) {
+        return;
+    }
+
+    const int used = length();
+    const long long needed = (long long) used + count;
+
+    if (INT_MAX < needed) {
+        throw length_error("Gap buffer of " + to_string(used)
+                           + " characters cannot take " + to_string(count)
+                           + " more");
+    }
+
+    /* Computed in long long, 2 * capacity overflows int past 1 GiB */
+    const int grown = (int) min<long long>(
+            INT_MAX, max({(long long) kInitialCapacity,
+                          2 * (long long) capacity, needed}));
+    const int tail = capacity - gapEnd;
+
+    string grownBuffer(grown, '\0');
+
+    /* Copy the characters before & after the gap around the new gap */
+    memcpy(&grownBuffer[0], buffer.data(), gapStart);
+    memcpy(&grownBuffer[grown - tail], buffer.data() + gapEnd, tail);
+
+    buffer.swap(grownBuffer);
+    capacity = grown;
+    gapEnd = grown - tail;
+}
@@ -0,0 +1,336 @@
+/*
+ * StringBuilder Project
+ *
+ *
+ * GapBufferStorage.h
+ *
+ * Date:        17/10/2026
+ *
+ * Author:      Mahmoud Yaman Seraj Alddin
+ *
+ * Purpose:     Header file for the GapBufferStorage class,
+ *              the gap buffer storage of MyStringBuilder.
+ *
+ * List of public Functions:
+ *      GapBufferStorage()
+ *          No-arg constructor of the GapBufferStorage class.
+ *
+ *      GapBufferStorage(const char*, int)
+ *          Parameterized constructor of the GapBufferStorage class.
+ *
+ *      GapBufferStorage(std::string&&)
+ *          Parameterized constructor of the GapBufferStorage class.
+ *          Adopts the buffer of the given string.
+ *
+ *      Storage* copy(int begin, int end) const
+ *          Returns a new GapBufferStorage holding a copy of the characters
+ *          between begin (inclusive) & end (exclusive).
+ *
+ *      int length() const
+ *          Returns the number of characters in the buffer.
+ *
+ *      char charAt(int) const
+ *          Returns the character at the given position.
+ *
+ *      void insert(int, const char*, int)
+ *          Inserts a copy of the given characters at the given position.
+ *
+ *      void insert(int, const Storage&)
+ *          Inserts a copy of the characters of the given Storage at the
+ *          given position.
+ *
+ *      void splice(int, Storage&)
+ *          Moves the characters of the given Storage to the given position,
+ *          leaving the given Storage empty.
+ *
+ *      void erase(int begin, int end)
+ *          Removes the characters between begin (inclusive)
+ *          & end (exclusive).
+ *
+ *      bool forEachChunk(int begin, int end, const ChunkVisitor&) const
+ *          Visits the characters between begin & end as contiguous chunks.
+ *
+ *      void forEachMutableChunk(int begin, int end,
+ *                               const MutableChunkVisitor&)
+ *          Visits the characters between begin & end as writable
+ *          contiguous chunks.
+ *
+ *      char* reserveTail(int&)
+ *          Returns the free room after the last character, or nullptr.
+ *
+ *      void commitTail(int)
+ *          Appends the given count of characters written to the
+ *          reserved tail.
+ *
+ * List of private Functions:
+ *      void moveGap(int)
+ *          Moves the gap so that it starts at the given position.
+ *
+ *      void reserveGap(int)
+ *          Grows the buffer until the gap can take the given count.
+ */
+
+#ifndef MYSTRINGBUILDER_GAPBUFFERSTORAGE_H
+#define MYSTRINGBUILDER_GAPBUFFERSTORAGE_H
+
+#include <string>
+
+#include "Storage.h"
+
+/*
+ * GapBufferStorage stores the characters in a single contiguous buffer
+ * with a movable gap of free space at the last edit position.
+ * Edits near the previous edit are amortized O(1),
+ * charAt is O(1).
+ */
+class GapBufferStorage : public Storage {
+public:
+    /* Capacity of the buffer the first time it grows */
+    static const int kInitialCapacity = 64;
+
+    /*
+     * Pre-Conditions:
+     *      No preconditions.
+     *
+     * Post-Conditions:
+     *      An empty GapBufferStorage instance is created.
+     *      buffer is empty.
+     *      capacity, gapStart & gapEnd are 0.
+     *
+     * No-arg constructor of the GapBufferStorage class.
+     */
+    GapBufferStorage();
+
+    /*
+     * Pre-Conditions:
+     *      Pointer to the characters to copy & their count.
+     *
+     * Post-Conditions:
+     *      A GapBufferStorage instance holding the given characters
+     *      is created, the gap is at the end.
+     *
+     * Parameterized constructor of the GapBufferStorage class.
+     */
+    GapBufferStorage(const char*, int);
+
+    /*
+     * Pre-Conditions:
+     *      rvalue reference to the string to adopt.
+     *
+     * Post-Conditions:
+     *      A GapBufferStorage instance holding the characters of the
+     *      given string is created, without copying them.
+     *      The gap is empty, at the end.
+     *      The given string is left empty.
+     *
+     * Parameterized constructor of the GapBufferStorage class.
+     * Adopts the buffer of the given string.
+     */
+    explicit GapBufferStorage(std::string&&);
+
+    /*
+     * Pre-Conditions:
+     *      `this` GapBufferStorage instance is initialized.
+     *      begin & end are valid positions, begin <= end.
+     *
+     * Post-Conditions:
+     *      A heap allocated GapBufferStorage is returned.
+     *      No changes to `this`.
+     *
+     * Returns a new GapBufferStorage holding a copy of the characters
+     * between begin (inclusive) & end (exclusive).
+     */
+    [[nodiscard]] Storage* copy(int /* begin */,
+                                int /* end */) const override;
+
+    /*
+     * Pre-Conditions:
+     *      `this` GapBufferStorage instance is initialized.
+     *
+     * Post-Conditions:
+     *      Number of characters in the buffer is returned.
+     *      No changes to `this`.
+     *
+     * Returns the number of characters in the buffer.
+     */
+    [[nodiscard]] int length() const override;
+
+    /*
+     * Pre-Conditions:
+     *      `this` GapBufferStorage instance is initialized.
+     *      Given int position is valid, less than length().
+     *
+     * Post-Conditions:
+     *      Character at the given position is returned.
+     *      No changes to `this`.
+     *
+     * Returns the character at the given position.
+     */
+    [[nodiscard]] char charAt(int) const override;
+
+    /*
+     * Pre-Conditions:
+     *      `this` GapBufferStorage instance is initialized.
+     *      Given int position is valid.
+     *      Pointer to the characters to insert & their count.
+     *
+     * Post-Conditions:
+     *      The given characters are inserted at the given position.
+     *      The gap starts right after the inserted characters.
+     *
+     * Inserts a copy of the given characters at the given position.
+     */
+    void insert(int, const char*, int) override;
+
+    /*
+     * Pre-Conditions:
+     *      `this` GapBufferStorage instance is initialized.
+     *      Given int position is valid.
+     *      const reference to a Storage other than `this`.
+     *
+     * Post-Conditions:
+     *      The characters of the given Storage are inserted
+     *      at the given position.
+     *      No changes to the given Storage.
+     *
+     * Inserts a copy of the characters of the given Storage at the
+     * given position.
+     */
+    void insert(int, const Storage&) override;
+
+    /*
+     * Pre-Conditions:
+     *      `this` GapBufferStorage instance is initialized.
+     *      Given int position is valid.
+     *      Reference to a Storage other than `this`.
+     *
+     * Post-Conditions:
+     *      The characters of the given Storage are inserted
+     *      at the given position.
+     *      The given Storage is empty.
+     *
+     * Moves the characters of the given Storage to the given position,
+     * leaving the given Storage empty.
+     */
+    void splice(int, Storage&) override;
+
+    /*
+     * Pre-Conditions:
+     *      `this` GapBufferStorage instance is initialized.
+     *      begin & end are valid positions, begin <= end.
+     *
+     * Post-Conditions:
+     *      The characters between begin & end are removed.
+     *      The gap starts at begin.
+     *
+     * Removes the characters between begin (inclusive) & end (exclusive).
+     */
+    void erase(int /* begin */, int /* end */) override;
+
+    /*
+     * Pre-Conditions:
+     *      `this` GapBufferStorage instance is initialized.
+     *      begin & end are valid positions, begin <= end.
+     *      const reference to a ChunkVisitor.
+     *
+     * Post-Conditions:
+     *      The visitor is called for the characters before the gap,
+     *      then for those after it, until it returns false.
+     *      Returns false if the visitor stopped the visit.
+     *      No changes to `this`.
+     *
+     * Visits the characters between begin & end as contiguous chunks.
+     */
+    bool forEachChunk(int /* begin */, int /* end */,
+                      const ChunkVisitor&) const override;
+
+    /*
+     * Pre-Conditions:
+     *      `this` GapBufferStorage instance is initialized.
+     *      begin & end are valid positions, begin <= end.
+     *      const reference to a MutableChunkVisitor.
+     *
+     * Post-Conditions:
+     *      The visitor is called for the characters before the gap,
+     *      then for those after it.
+     *      Changes made by the visitor are stored in the buffer.
+     *
+     * Visits the characters between begin & end as writable
+     * contiguous chunks.
+     */
+    void forEachMutableChunk(int /* begin */, int /* end */,
+                             const MutableChunkVisitor&) override;
+
+    /*
+     * Pre-Conditions:
+     *      `this` GapBufferStorage instance is initialized.
+     *      Reference to the most characters wanted, at least 1,
+     *      at most INT_MAX - length().
+     *
+     * Post-Conditions:
+     *      The gap is at the end.
+     *      Pointer to the start of the gap is returned, the given count
+     *      is lowered to the size of the gap.
+     *      nullptr is returned if the gap is empty.
+     *      length() is unchanged.
+     *
+     * Returns the free room after the last character, or nullptr.
+     */
+    [[nodiscard]] char* reserveTail(int&) override;
+
+    /*
+     * Pre-Conditions:
+     *      `this` GapBufferStorage instance is initialized.
+     *      reserveTail returned room for at least the given count,
+     *      its first count characters are written.
+     *
+     * Post-Conditions:
+     *      The gap starts after the given count of characters.
+     *
+     * Appends the given count of characters written to the
+     * reserved tail.
+     */
+    void commitTail(int) override;
+
+private:
+    /*
+     * Pre-Conditions:
+     *      `this` GapBufferStorage instance is initialized.
+     *      Given int position is valid.
+     *
+     * Post-Conditions:
+     *      gapStart is the given position.
+     *      The characters between the old & new gap are moved
+     *      across the gap.
+     *
+     * Moves the gap so that it starts at the given position.
+     */
+    void moveGap(int);
+
+    /*
+     * Pre-Conditions:
+     *      `this` GapBufferStorage instance is initialized.
+     *      int of the number of free characters needed.
+     *
+     * Post-Conditions:
+     *      The gap is at least the given count long.
+     *      gapStart is unchanged.
+     *
+     * Grows the buffer until the gap can take the given count.
+     */
+    void reserveGap(int);
+
+    /* Buffer holding the characters & the gap, its size is capacity */
+    std::string buffer;
+
+    /* Number of characters the buffer can hold */
+    int capacity;
+
+    /* Position of the first free character of the gap */
+    int gapStart;
+
+    /* Position of the first character after the gap */
+    int gapEnd;
+};
+
+#endif /* MYSTRINGBUILDER_GAPBUFFERSTORAGE_H */
@@ -0,0 +1,509 @@
+/*
+ * StringBuilder Project
+ *
+ *
+ * LogBuilder.cpp
+ *
+ * Date:        17/10/2026
+ *
+ * Author:      Mahmoud Yaman Seraj Alddin
+ *
+ * Purpose:     Implementation of the LogBuilder class,
+ *              described in LogBuilder.h
+ *
+ * List of public Functions:
+ *      LogBuilder(int segments = 8, int capacity = 1 << 20,
+ *                 Overflow overflow = Overflow::kBlock)
+ *          Parameterized constructor of the LogBuilder class.
+ *
+ *      ~LogBuilder()
+ *          Destructor for the LogBuilder class.
+ *
+ *      bool append(std::string_view)
+ *          Appends the given record to the log.
+ *
+ *      bool append(const MyStringBuilder&)
+ *          Appends the characters of the given MyStringBuilder to the log,
+ *          as one record.
+ *
+ *      long long drain(int)
+ *          Writes the completed segments to the given file descriptor.
+ *
+ *      long long flush(int)
+ *          Writes all the records appended so far to the given
+ *          file descriptor.
+ *
+ *      long long droppedCount() const
+ *          Returns the number of records dropped.
+ *
+ *      long long blockedCount() const
+ *          Returns the number of appends that waited for a free segment.
+ *
+ * List of private Functions:
+ *      Segment* reserve(int, int&)
+ *          Reserves room for the given number of characters.
+ *
+ *      void commit(Segment*, int)
+ *          Marks the given number of reserved characters as copied.
+ *
+ *      bool advance(long long)
+ *          Opens the segment after the given one, if one is free.
+ *
+ *      void release(long long)
+ *          Hands the given number of drained segments back to the
+ *          producers.
+ *
+ * List of local Functions:
+ *      void writeAll(int, const char*, int)
+ *          Writes all the given characters to the given file descriptor.
+ */
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+
+#if defined(__unix__) or defined(__APPLE__)
+#include <unistd.h>
+#else
+#include <io.h>
+#endif
+
+#include "LogBuilder.h"
+
+using namespace std;
+
+/*
+ * Pre-Conditions:
+ *      int of a file descriptor open for writing.
+ *      Pointer to the characters to write & their count.
+ *
+ * Post-Conditions:
+ *      All the characters are written, in order.
+ *      A system_error exception is thrown if a write fails.
+ *
+ * Partial & interrupted writes are resumed.
+ * Writes all the given characters to the given file descriptor.
+ */
+static void writeAll(int fd, const char *data, int count) {
+    while (0 < count) {
+        const long long written = ::write(fd, data, count);
+
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+
+            throw system_error(errno, generic_category(),
+                               "Cannot write to descriptor " + to_string(fd));
+        }
+
+        data += written;
+        count -= (int) written;
+    }
+}
+
+/*
+ * Pre-Conditions:
+ *      int of the number of segments (optional), at least 2,
+ *      default is 8.
+ *      int of the characters per segment (optional), at least 1,
+ *      default is 1 MiB, the longest record.
+ *      What appends do when every segment is full (optional),
+ *      default is Overflow::kBlock.
+ *
+ * Post-Conditions:
+ *      An empty LogBuilder instance is created, all its segments
+ *      allocated.
+ *      An invalid_argument exception is thrown if the sizes are
+ *      invalid.
+ *
+ * Two segments at least, so producers fill one while the other
+ * is written.
+ * Parameterized constructor of the LogBuilder class.
+ */
+LogBuilder::LogBuilder(int segments, int capacity, Overflow overflow)
+        : pool(max(segments, 0)), capacity{capacity}, overflow{overflow},
+          head{0}, opened{0}, drained{0}, dropped{0}, blocked{0},
+          pressure{}, freed{} {
+    if (segments < 2 or capacity < 1) {
+        throw invalid_argument(
+                "Invalid log of " + to_string(segments) + " segments of "
+                + to_string(capacity) + " characters. Must have at least"
+                + " 2 segments of 1 character.\n"
+        );
+    }
+
+    for (Segment& segment: pool) {
+        segment.data = new char[capacity];
+        segment.reserved = 0;
+        segment.committed = 0;
+        segment.size = -1;
+    }
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` LogBuilder instance is not destroyed.
+ *      No thread is appending or draining.
+ *
+ * Post-Conditions:
+ *      `this` LogBuilder instance & its segments are destroyed,
+ *      the records not drained are lost.
+ *
+ * Destructor for the LogBuilder class.
+ */
+LogBuilder::~LogBuilder() {
+    for (Segment& segment: pool) {
+        delete[] segment.data;
+        segment.data = nullptr;
+    }
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` LogBuilder instance is initialized.
+ *      string_view of the record, at most the segment capacity.
+ *
+ * Post-Conditions:
+ *      The record is appended in one piece & true is returned,
+ *      or it is dropped, counted & false is returned.
+ *      A length_error exception is thrown if the record is longer
+ *      than a segment.
+ *
+ * Safe to call from many threads at once, lock-free unless every
+ * segment is full.
+ * Appends the given record to the log.
+ */
+bool LogBuilder::append(string_view record) {
+    /* Checked before the cast, a size past INT_MAX would truncate */
+    if ((size_t) capacity < record.size()) {
+        throw length_error("Record of " + to_string(record.size())
+                           + " characters, longer than a segment of "
+                           + to_string(capacity));
+    }
+
+    int offset = 0;
+    Segment *segment = reserve((int) record.size(), offset);
+
+    if (not segment) {
+        return false;
+    }
+
+    memcpy(segment->data + offset, record.data(), record.size());
+    commit(segment, (int) record.size());
+
+    return true;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` LogBuilder instance is initialized.
+ *      const reference to the MyStringBuilder holding the record,
+ *      at most the segment capacity.
+ *
+ * Post-Conditions:
+ *      The record is appended in one piece & true is returned,
+ *      or it is dropped, counted & false is returned.
+ *      A length_error exception is thrown if the record is longer
+ *      than a segment.
+ *
+ * The chunks are copied straight into the reserved room, the record
+ * is never flattened.
+ * Appends the characters of the given MyStringBuilder to the log,
+ * as one record.
+ */
+bool LogBuilder::append(const MyStringBuilder& record) {
+    int offset = 0;
+    Segment *segment = reserve(record.length(), offset);
+
+    if (not segment) {
+        return false;
+    }
+
+    char *to = segment->data + offset;
+
+    record.forEachChunk([&to](const char *data, int count) {
+        memcpy(to, data, count);
+        to += count;
+
+        return true;
+    });
+
+    commit(segment, record.length());
+    return true;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` LogBuilder instance is initialized.
+ *      int of a file descriptor open for writing.
+ *      Only one thread drains or flushes.
+ *
+ * Post-Conditions:
+ *      The sealed segments whose records are all copied are written,
+ *      in order, & freed.
+ *      Number of characters written is returned.
+ *      A system_error exception is thrown if a write fails.
+ *
+ * Stops at the open segment, or at a segment whose size is not
+ * published yet or whose records are still being copied.
+ * Never waits for the producers.
+ * Writes the completed segments to the given file descriptor.
+ */
+long long LogBuilder::drain(int fd) {
+    long long written = 0;
+    long long next = drained.load(memory_order_relaxed);
+
+    while (next < head.load(memory_order_acquire)) {
+        Segment& segment = pool[next % (long long) pool.size()];
+        const int size = segment.size.load(memory_order_acquire);
+
+        if (size < 0 or segment.committed.load(memory_order_acquire) < size) {
+            break;
+        }
+
+        writeAll(fd, segment.data, size);
+        written += size;
+        release(++next);
+    }
+
+    return written;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` LogBuilder instance is initialized.
+ *      int of a file descriptor open for writing.
+ *      Only one thread drains or flushes.
+ *
+ * Post-Conditions:
+ *      The open segment is sealed, then every record appended
+ *      before the call is written, in order.
+ *      Number of characters written is returned.
+ *      A system_error exception is thrown if a write fails.
+ *
+ * The open segment is sealed as a producer would, by reserving more
+ * than its capacity, then the segments are drained, waiting for the
+ * copies in progress.
+ * Writes all the records appended so far to the given
+ * file descriptor.
+ */
+long long LogBuilder::flush(int fd) {
+    long long written = drain(fd);
+    const long long last = head.load(memory_order_acquire);
+    Segment& segment = pool[last % (long long) pool.size()];
+
+    if (segment.reserved.load(memory_order_acquire)) {
+        const long long offset = segment.reserved.fetch_add(
+                capacity + 1, memory_order_acq_rel
+        );
+
+        if (offset <= capacity) {
+            segment.size.store((int) offset, memory_order_release);
+        }
+
+        /* Every other segment may be sealed & still being copied */
+        while (not advance(last)) {
+            written += drain(fd);
+            this_thread::yield();
+        }
+    }
+
+    while (drained.load(memory_order_relaxed) < head.load(memory_order_acquire)
+           and drained.load(memory_order_relaxed) <= last) {
+        written += drain(fd);
+        this_thread::yield();
+    }
+
+    return written;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` LogBuilder instance is initialized.
+ *
+ * Post-Conditions:
+ *      Number of records dropped because every segment was full
+ *      is returned.
+ *      No changes to `this`.
+ *
+ * Returns the number of records dropped.
+ */
+long long LogBuilder::droppedCount() const {
+    return dropped.load(memory_order_relaxed);
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` LogBuilder instance is initialized.
+ *
+ * Post-Conditions:
+ *      Number of appends that waited because every segment was full
+ *      is returned.
+ *      No changes to `this`.
+ *
+ * Returns the number of appends that waited for a free segment.
+ */
+long long LogBuilder::blockedCount() const {
+    return blocked.load(memory_order_relaxed);
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` LogBuilder instance is initialized.
+ *      int of the number of characters, at most the capacity.
+ *      Reference to the int receiving the offset in the segment.
+ *
+ * Post-Conditions:
+ *      Pointer to the segment holding the reserved room is returned,
+ *      the offset of the room is stored in the given int.
+ *      nullptr is returned, & the drop counted, if every segment is
+ *      full & the overflow is Overflow::kDrop.
+ *
+ * Reservations are ordered by the atomic addition, those ending past
+ * the capacity are refused. The first refused one starts at or before
+ * the capacity, it alone seals the segment, at its offset, which is
+ * exactly the room granted before it.
+ * A reservation may land in a segment reused since head was read,
+ * it is then a valid reservation of the newer segment or a refusal.
+ * Reserves room for the given number of characters.
+ */
+LogBuilder::Segment* LogBuilder::reserve(int count, int& offset) {
+    if (capacity < count) {
+        throw length_error("Record of " + to_string(count)
+                           + " characters, longer than a segment of "
+                           + to_string(capacity));
+    }
+
+    bool waited = false;
+
+    while (true) {
+        const long long index = head.load(memory_order_acquire);
+        Segment& segment = pool[index % (long long) pool.size()];
+        const long long start = segment.reserved.fetch_add(
+                count, memory_order_acq_rel
+        );
+
+        if (start + count <= capacity) {
+            offset = (int) start;
+
+            if (waited) {
+                blocked.fetch_add(1, memory_order_relaxed);
+            }
+
+            return &segment;
+        }
+
+        if (start <= capacity) {
+            segment.size.store((int) start, memory_order_release);
+        }
+
+        if (advance(index)) {
+            continue;
+        }
+
+        if (overflow == Overflow::kDrop) {
+            dropped.fetch_add(1, memory_order_relaxed);
+            return nullptr;
+        }
+
+        waited = true;
+
+        unique_lock<mutex> lock(pressure);
+
+        freed.wait(lock, [this, index]() {
+            return head.load(memory_order_acquire) != index
+                   or index + 1 - drained.load(memory_order_acquire)
+                      < (long long) pool.size();
+        });
+    }
+}
+
+/*
+ * Pre-Conditions:
+ *      Pointer to a segment returned by reserve.
+ *      int of the number of characters reserved in it.
+ *
+ * Post-Conditions:
+ *      The characters are counted as copied, the consumer may
+ *      write them.
+ *
+ * The release ordering publishes the copied characters to the consumer.
+ * Marks the given number of reserved characters as copied.
+ */
+void LogBuilder::commit(Segment *segment, int count) {
+    segment->committed.fetch_add(count, memory_order_release);
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` LogBuilder instance is initialized.
+ *      long long of the index of a full segment.
+ *
+ * Post-Conditions:
+ *      Returns true once a later segment is open,
+ *      false if every segment is still in use.
+ *
+ * The thread winning the exchange on opened resets the next segment,
+ * its reservations last, then publishes it as head, the others wait
+ * for head to move.
+ * Opens the segment after the given one, if one is free.
+ */
+bool LogBuilder::advance(long long index) {
+    if (head.load(memory_order_acquire) != index) {
+        return true;
+    }
+
+    /* The next segment is still waiting to be drained */
+    if ((long long) pool.size()
+        <= index + 1 - drained.load(memory_order_acquire)) {
+        return head.load(memory_order_acquire) != index;
+    }
+
+    long long expected = index;
+
+    if (opened.compare_exchange_strong(expected, index + 1,
+                                       memory_order_acq_rel)) {
+        Segment& next = pool[(index + 1) % (long long) pool.size()];
+
+        next.size.store(-1, memory_order_relaxed);
+        next.committed.store(0, memory_order_relaxed);
+        next.reserved.store(0, memory_order_release);
+        head.store(index + 1, memory_order_release);
+
+        return true;
+    }
+
+    while (head.load(memory_order_acquire) == index) {
+        this_thread::yield();
+    }
+
+    return true;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` LogBuilder instance is initialized.
+ *      long long of the new number of drained segments.
+ *
+ * Post-Conditions:
+ *      The drained segments may be reused, the waiting producers
+ *      are woken.
+ *
+ * Taking the lock orders the store before the check of a waiting
+ * producer, so no wake up is lost.
+ * Hands the given number of drained segments back to the producers.
+ */
+void LogBuilder::release(long long count) {
+    drained.store(count, memory_order_release);
+
+    {
+        lock_guard<mutex> lock(pressure);
+    }
+
+    freed.notify_all();
+}
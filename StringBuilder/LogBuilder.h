@@ -0,0 +1,330 @@
+/*
+ * StringBuilder Project
+ *
+ *
+ * LogBuilder.h
+ *
+ * Date:        17/10/2026
+ *
+ * Author:      Mahmoud Yaman Seraj Alddin
+ *
+ * Purpose:     Header file for the LogBuilder class,
+ *              an append-only log many threads append records to,
+ *              drained to a file descriptor by one thread.
+ *
+ * List of public Functions:
+ *      LogBuilder(int segments = 8, int capacity = 1 << 20,
+ *                 Overflow overflow = Overflow::kBlock)
+ *          Parameterized constructor of the LogBuilder class.
+ *
+ *      ~LogBuilder()
+ *          Destructor for the LogBuilder class.
+ *
+ *      bool append(std::string_view)
+ *          Appends the given record to the log.
+ *
+ *      bool append(const MyStringBuilder&)
+ *          Appends the characters of the given MyStringBuilder to the log,
+ *          as one record.
+ *
+ *      long long drain(int)
+ *          Writes the completed segments to the given file descriptor.
+ *
+ *      long long flush(int)
+ *          Writes all the records appended so far to the given
+ *          file descriptor.
+ *
+ *      long long droppedCount() const
+ *          Returns the number of records dropped.
+ *
+ *      long long blockedCount() const
+ *          Returns the number of appends that waited for a free segment.
+ *
+ * List of private Functions:
+ *      Segment* reserve(int, int&)
+ *          Reserves room for the given number of characters.
+ *
+ *      void commit(Segment*, int)
+ *          Marks the given number of reserved characters as copied.
+ *
+ *      bool advance(long long)
+ *          Opens the segment after the given one, if one is free.
+ *
+ *      void release(long long)
+ *          Hands the given number of drained segments back to the
+ *          producers.
+ */
+
+#ifndef MYSTRINGBUILDER_LOGBUILDER_H
+#define MYSTRINGBUILDER_LOGBUILDER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+#include "MyStringBuilder.h"
+
+/*
+ * LogBuilder keeps a ring of preallocated segments.
+ * Producers reserve room in the open segment with one atomic addition,
+ * then copy their record without any lock, so records never interleave.
+ * The producer whose reservation crosses the end of the segment seals
+ * it at its offset & opens the next free one.
+ * A single consumer drains the sealed segments, in order, once all
+ * their records are copied, which frees them for the producers.
+ * When no segment is free the producers wait or drop their record,
+ * as chosen at construction.
+ */
+class LogBuilder {
+public:
+    /*
+     * What an append does when every segment is full.
+     * Can be accessed outside the class using LogBuilder::Overflow.
+     *
+     *      kBlock: Waits for the consumer to drain a segment.
+     *
+     *      kDrop:  Drops the record & returns false.
+     */
+    enum class Overflow {
+        kBlock,
+        kDrop,
+    };
+
+    /*
+     * Pre-Conditions:
+     *      int of the number of segments (optional), at least 2,
+     *      default is 8.
+     *      int of the characters per segment (optional), at least 1,
+     *      default is 1 MiB, the longest record.
+     *      What appends do when every segment is full (optional),
+     *      default is Overflow::kBlock.
+     *
+     * Post-Conditions:
+     *      An empty LogBuilder instance is created, all its segments
+     *      allocated.
+     *      An invalid_argument exception is thrown if the sizes are
+     *      invalid.
+     *
+     * Parameterized constructor of the LogBuilder class.
+     */
+    explicit LogBuilder(int segments = 8, int capacity = 1 << 20,
+                        Overflow overflow = Overflow::kBlock);
+
+    /* Producers keep pointers to the segments, no copies */
+    LogBuilder(const LogBuilder&) = delete;
+
+    LogBuilder& operator=(const LogBuilder&) = delete;
+
+    /*
+     * Pre-Conditions:
+     *      `this` LogBuilder instance is not destroyed.
+     *      No thread is appending or draining.
+     *
+     * Post-Conditions:
+     *      `this` LogBuilder instance & its segments are destroyed,
+     *      the records not drained are lost.
+     *
+     * Destructor for the LogBuilder class.
+     */
+    ~LogBuilder();
+
+    /*
+     * Pre-Conditions:
+     *      `this` LogBuilder instance is initialized.
+     *      string_view of the record, at most the segment capacity.
+     *
+     * Post-Conditions:
+     *      The record is appended in one piece & true is returned,
+     *      or it is dropped, counted & false is returned.
+     *      A length_error exception is thrown if the record is longer
+     *      than a segment.
+     *
+     * Safe to call from many threads at once, lock-free unless every
+     * segment is full.
+     * Appends the given record to the log.
+     */
+    bool append(std::string_view);
+
+    /*
+     * Pre-Conditions:
+     *      `this` LogBuilder instance is initialized.
+     *      const reference to the MyStringBuilder holding the record,
+     *      at most the segment capacity.
+     *
+     * Post-Conditions:
+     *      The record is appended in one piece & true is returned,
+     *      or it is dropped, counted & false is returned.
+     *      A length_error exception is thrown if the record is longer
+     *      than a segment.
+     *
+     * Appends the characters of the given MyStringBuilder to the log,
+     * as one record.
+     */
+    bool append(const MyStringBuilder&);
+
+    /*
+     * Pre-Conditions:
+     *      `this` LogBuilder instance is initialized.
+     *      int of a file descriptor open for writing.
+     *      Only one thread drains or flushes.
+     *
+     * Post-Conditions:
+     *      The sealed segments whose records are all copied are written,
+     *      in order, & freed.
+     *      Number of characters written is returned.
+     *      A system_error exception is thrown if a write fails.
+     *
+     * Never waits for the producers.
+     * Writes the completed segments to the given file descriptor.
+     */
+    long long drain(int);
+
+    /*
+     * Pre-Conditions:
+     *      `this` LogBuilder instance is initialized.
+     *      int of a file descriptor open for writing.
+     *      Only one thread drains or flushes.
+     *
+     * Post-Conditions:
+     *      The open segment is sealed, then every record appended
+     *      before the call is written, in order.
+     *      Number of characters written is returned.
+     *      A system_error exception is thrown if a write fails.
+     *
+     * Writes all the records appended so far to the given
+     * file descriptor.
+     */
+    long long flush(int);
+
+    /*
+     * Pre-Conditions:
+     *      `this` LogBuilder instance is initialized.
+     *
+     * Post-Conditions:
+     *      Number of records dropped because every segment was full
+     *      is returned.
+     *      No changes to `this`.
+     *
+     * Returns the number of records dropped.
+     */
+    [[nodiscard]] long long droppedCount() const;
+
+    /*
+     * Pre-Conditions:
+     *      `this` LogBuilder instance is initialized.
+     *
+     * Post-Conditions:
+     *      Number of appends that waited because every segment was full
+     *      is returned.
+     *      No changes to `this`.
+     *
+     * Returns the number of appends that waited for a free segment.
+     */
+    [[nodiscard]] long long blockedCount() const;
+
+private:
+    /*
+     * Preallocated buffer of records.
+     * reserved may grow past the capacity, the overflowing reservations
+     * are refused. size is the number of characters of the sealed
+     * segment, -1 while open. The segment is complete once committed
+     * reaches size.
+     * Aligned to a cache line, so producers of different segments
+     * never write the same line.
+     */
+    struct alignas(64) Segment {
+        char *data;
+        std::atomic<long long> reserved;
+        std::atomic<int> committed;
+        std::atomic<int> size;
+    };
+
+    /*
+     * Pre-Conditions:
+     *      `this` LogBuilder instance is initialized.
+     *      int of the number of characters, at most the capacity.
+     *      Reference to the int receiving the offset in the segment.
+     *
+     * Post-Conditions:
+     *      Pointer to the segment holding the reserved room is returned,
+     *      the offset of the room is stored in the given int.
+     *      nullptr is returned, & the drop counted, if every segment is
+     *      full & the overflow is Overflow::kDrop.
+     *
+     * Reserves room for the given number of characters.
+     */
+    Segment* reserve(int /* count */, int& /* offset */);
+
+    /*
+     * Pre-Conditions:
+     *      Pointer to a segment returned by reserve.
+     *      int of the number of characters reserved in it.
+     *
+     * Post-Conditions:
+     *      The characters are counted as copied, the consumer may
+     *      write them.
+     *
+     * Marks the given number of reserved characters as copied.
+     */
+    void commit(Segment*, int);
+
+    /*
+     * Pre-Conditions:
+     *      `this` LogBuilder instance is initialized.
+     *      long long of the index of a full segment.
+     *
+     * Post-Conditions:
+     *      Returns true once a later segment is open,
+     *      false if every segment is still in use.
+     *
+     * Opens the segment after the given one, if one is free.
+     */
+    bool advance(long long);
+
+    /*
+     * Pre-Conditions:
+     *      `this` LogBuilder instance is initialized.
+     *      long long of the new number of drained segments.
+     *
+     * Post-Conditions:
+     *      The drained segments may be reused, the waiting producers
+     *      are woken.
+     *
+     * Hands the given number of drained segments back to the producers.
+     */
+    void release(long long);
+
+    /* Ring of segments, segment i of the log is pool[i % pool.size()] */
+    std::vector<Segment> pool;
+
+    /* Characters per segment */
+    const int capacity;
+
+    /* What an append does when every segment is full */
+    const Overflow overflow;
+
+    /* Index of the open segment */
+    std::atomic<long long> head;
+
+    /* Index of the last segment reset for opening */
+    std::atomic<long long> opened;
+
+    /* Number of segments written by the consumer */
+    std::atomic<long long> drained;
+
+    /* Records dropped */
+    std::atomic<long long> dropped;
+
+    /* Appends that waited for a free segment */
+    std::atomic<long long> blocked;
+
+    /* Guards the wait of the producers for a free segment */
+    std::mutex pressure;
+
+    /* Signaled when the consumer frees a segment */
+    std::condition_variable freed;
+};
+
+#endif /* MYSTRINGBUILDER_LOGBUILDER_H */
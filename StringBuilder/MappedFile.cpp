@@ -0,0 +1,232 @@
+/*
+ * StringBuilder Project
+ *
+ *
+ * MappedFile.cpp
+ *
+ * Date:        17/10/2026
+ *
+ * Author:      Mahmoud Yaman Seraj Alddin
+ *
+ * Purpose:     Implementation of the MappedFile class,
+ *              described in MappedFile.h
+ *
+ * List of public Functions:
+ *      MappedFile(const std::string&, long long offset = 0,
+ *                 long long length = LLONG_MAX)
+ *          Parameterized constructor of the MappedFile class.
+ *
+ *      ~MappedFile()
+ *          Destructor for the MappedFile class.
+ *
+ *      const char* data() const
+ *          Returns a pointer to the first character of the window.
+ *
+ *      int size() const
+ *          Returns the number of characters in the window.
+ *
+ * List of local Functions:
+ *      long long window(long long, long long, long long, const std::string&)
+ *          Returns the number of characters of the window in the file.
+ */
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <stdexcept>
+#include <system_error>
+
+/* POSIX systems map the file, others read it */
+#if defined(__unix__) or defined(__APPLE__)
+#define MYSTRINGBUILDER_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <fstream>
+#include <iterator>
+#endif
+
+#include "MappedFile.h"
+
+using namespace std;
+
+/*
+ * Pre-Conditions:
+ *      long long of the size of the file in characters.
+ *      long long of the offset & of the length of the window.
+ *      const reference to the path of the file.
+ *
+ * Post-Conditions:
+ *      Number of characters of the file from the offset, at most
+ *      the length, is returned.
+ *      An invalid_argument exception is thrown if the offset or
+ *      the length is negative, or the offset is past the end.
+ *      A length_error exception is thrown if the window holds more
+ *      than INT_MAX characters.
+ *
+ * The positions of MyStringBuilder are ints, so larger files are
+ * mapped in windows.
+ * Returns the number of characters of the window in the file.
+ */
+static long long window(long long size, long long offset, long long length,
+                        const string& path) {
+    if (offset < 0 or length < 0 or size < offset) {
+        throw invalid_argument(
+                "Invalid window " + to_string(offset) + " + "
+                + to_string(length) + " of file " + path + ". Must have "
+                + "0 <= offset <= " + to_string(size) + " & 0 <= length.\n"
+        );
+    }
+
+    const long long count = min(length, size - offset);
+
+    if (INT_MAX < count) {
+        throw length_error("File " + path + " holds " + to_string(count)
+                           + " characters from " + to_string(offset)
+                           + ", more than " + to_string(INT_MAX)
+                           + ", map it in smaller windows");
+    }
+
+    return count;
+}
+
+/*
+ * Pre-Conditions:
+ *      const reference to the path of a regular file.
+ *      long long of the offset of the window (optional),
+ *      default is 0.
+ *      long long of the length of the window (optional),
+ *      default is up to the end of the file.
+ *
+ * Post-Conditions:
+ *      A MappedFile instance mapping the characters of the file from
+ *      the offset is created, as many as the length or up to the end.
+ *      An invalid_argument exception is thrown if the offset or
+ *      the length is negative, or the offset is past the end.
+ *      A system_error exception is thrown if the file cannot be
+ *      opened or mapped.
+ *      A length_error exception is thrown if the window holds more
+ *      than INT_MAX characters.
+ *
+ * mmap needs an offset on a page boundary, so the mapping starts at the
+ * page holding the offset & the window starts inside it.
+ * The descriptor is closed right after mapping, the mapping keeps
+ * the file alive, even if it is later renamed or removed.
+ * Parameterized constructor of the MappedFile class.
+ */
+MappedFile::MappedFile(const string& path, long long offset, long long length):
+        base{nullptr}, count{0}, region{nullptr}, regionLength{0},
+        fallback{} {
+#ifdef MYSTRINGBUILDER_MMAP
+    const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+
+    if (fd < 0) {
+        throw system_error(errno, generic_category(), "Cannot open " + path);
+    }
+
+    struct stat status{};
+
+    if (::fstat(fd, &status) < 0) {
+        const int error = errno;
+
+        ::close(fd);
+        throw system_error(error, generic_category(), "Cannot stat " + path);
+    }
+
+    try {
+        count = (int) window(status.st_size, offset, length, path);
+    } catch (...) {
+        ::close(fd);
+        throw;
+    }
+
+    /* An empty mapping is invalid, an empty window maps to nothing */
+    if (count) {
+        const long long page = ::sysconf(_SC_PAGESIZE);
+        const long long skipped = offset % page;
+        void *mapping = ::mmap(nullptr, skipped + count, PROT_READ,
+                               MAP_PRIVATE, fd, offset - skipped);
+
+        if (mapping == MAP_FAILED) {
+            const int error = errno;
+
+            ::close(fd);
+            throw system_error(error, generic_category(), "Cannot map " + path);
+        }
+
+        region = mapping;
+        regionLength = skipped + count;
+        base = (const char*) mapping + skipped;
+    }
+
+    ::close(fd);
+#else
+    ifstream file(path, ios::binary | ios::ate);
+
+    if (not file) {
+        throw system_error(make_error_code(errc::no_such_file_or_directory),
+                           "Cannot open " + path);
+    }
+
+    count = (int) window((long long) file.tellg(), offset, length, path);
+    fallback.resize(count);
+    file.seekg(offset);
+
+    if (not file.read(&fallback[0], count)) {
+        throw system_error(make_error_code(errc::io_error),
+                           "Cannot read " + path);
+    }
+
+    base = count ? fallback.data() : nullptr;
+#endif
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` MappedFile instance is not destroyed.
+ *
+ * Post-Conditions:
+ *      The mapping is released.
+ *
+ * Destructor for the MappedFile class.
+ */
+MappedFile::~MappedFile() {
+#ifdef MYSTRINGBUILDER_MMAP
+    if (region) {
+        ::munmap(region, regionLength);
+    }
+#endif
+
+    base = nullptr;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` MappedFile instance is initialized.
+ *
+ * Post-Conditions:
+ *      Pointer to the first character of the window is returned,
+ *      nullptr for an empty window.
+ *      No changes to `this`.
+ *
+ * Returns a pointer to the first character of the window.
+ */
+const char* MappedFile::data() const {
+    return base;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` MappedFile instance is initialized.
+ *
+ * Post-Conditions:
+ *      Number of characters in the window is returned.
+ *      No changes to `this`.
+ *
+ * Returns the number of characters in the window.
+ */
+int MappedFile::size() const {
+    return count;
+}
@@ -0,0 +1,129 @@
+/*
+ * StringBuilder Project
+ *
+ *
+ * MappedFile.h
+ *
+ * Date:        17/10/2026
+ *
+ * Author:      Mahmoud Yaman Seraj Alddin
+ *
+ * Purpose:     Header file for the MappedFile class,
+ *              a read-only memory mapping of a file or of a window of it.
+ *
+ * List of public Functions:
+ *      MappedFile(const std::string&, long long offset = 0,
+ *                 long long length = LLONG_MAX)
+ *          Parameterized constructor of the MappedFile class.
+ *
+ *      ~MappedFile()
+ *          Destructor for the MappedFile class.
+ *
+ *      const char* data() const
+ *          Returns a pointer to the first character of the window.
+ *
+ *      int size() const
+ *          Returns the number of characters in the window.
+ */
+
+#ifndef MYSTRINGBUILDER_MAPPEDFILE_H
+#define MYSTRINGBUILDER_MAPPEDFILE_H
+
+#include <climits>
+#include <string>
+
+/*
+ * MappedFile maps a file read-only & privately, so the pages are only
+ * read from the disk when first touched & opening costs the same for
+ * any file size.
+ * A window of at most INT_MAX characters is mapped, the whole file by
+ * default, files past INT_MAX characters are mapped window by window.
+ * Later changes to the file by other processes must be avoided,
+ * they may show through the mapping.
+ * Where mmap is not available, the file is read into memory instead.
+ * A MappedFile can neither be copied nor moved, it is shared through
+ * a std::shared_ptr by the storages using it.
+ */
+class MappedFile {
+public:
+    /*
+     * Pre-Conditions:
+     *      const reference to the path of a regular file.
+     *      long long of the offset of the window (optional),
+     *      default is 0.
+     *      long long of the length of the window (optional),
+     *      default is up to the end of the file.
+     *
+     * Post-Conditions:
+     *      A MappedFile instance mapping the characters of the file from
+     *      the offset is created, as many as the length or up to the end.
+     *      An invalid_argument exception is thrown if the offset or
+     *      the length is negative, or the offset is past the end.
+     *      A system_error exception is thrown if the file cannot be
+     *      opened or mapped.
+     *      A length_error exception is thrown if the window holds more
+     *      than INT_MAX characters.
+     *
+     * Parameterized constructor of the MappedFile class.
+     */
+    explicit MappedFile(const std::string&, long long offset = 0,
+                        long long length = LLONG_MAX);
+
+    MappedFile(const MappedFile&) = delete;
+
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /*
+     * Pre-Conditions:
+     *      `this` MappedFile instance is not destroyed.
+     *
+     * Post-Conditions:
+     *      The mapping is released.
+     *
+     * Destructor for the MappedFile class.
+     */
+    ~MappedFile();
+
+    /*
+     * Pre-Conditions:
+     *      `this` MappedFile instance is initialized.
+     *
+     * Post-Conditions:
+     *      Pointer to the first character of the window is returned,
+     *      nullptr for an empty window.
+     *      No changes to `this`.
+     *
+     * Returns a pointer to the first character of the window.
+     */
+    [[nodiscard]] const char* data() const;
+
+    /*
+     * Pre-Conditions:
+     *      `this` MappedFile instance is initialized.
+     *
+     * Post-Conditions:
+     *      Number of characters in the window is returned.
+     *      No changes to `this`.
+     *
+     * Returns the number of characters in the window.
+     */
+    [[nodiscard]] int size() const;
+
+private:
+    /* First character of the window, nullptr for an empty window */
+    const char *base;
+
+    /* Number of characters in the window */
+    int count;
+
+    /* Pages mapped, starting at the page holding the window */
+    void *region;
+
+    /* Number of bytes mapped, the window & its first page before it */
+    long long regionLength;
+
+    /* Characters of the file, if it could not be mapped */
+    std::string fallback;
+};
+
+#endif /* MYSTRINGBUILDER_MAPPEDFILE_H */
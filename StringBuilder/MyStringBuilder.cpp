@@ -12,34 +12,138 @@
  *              described in MyStringBuilder.h
  *
  * List of public Functions:
- *      MyStringBuilder(std::string)
+ *      MyStringBuilder(std::string, Mode mode = Mode::kRope)
  *          Parameterized constructor of the MyStringBuilder class.
  *
+ *      MyStringBuilder(const MyStringBuilder&)
+ *          Copy constructor of the MyStringBuilder class.
+ *
+ *      MyStringBuilder& operator=(const MyStringBuilder&)
+ *          Assignment operator for the MyStringBuilder class.
+ *
+ *      MyStringBuilder(MyStringBuilder&&)
+ *          Move constructor of the MyStringBuilder class.
+ *
+ *      MyStringBuilder& operator=(MyStringBuilder&&)
+ *          Move assignment operator for the MyStringBuilder class.
+ *
+ *      ~MyStringBuilder()
+ *          Destructor for the MyStringBuilder class.
+ *
  *      MyStringBuilder& insert(int, const MyStringBuilder&)
  *          Inserts a copy of the given MyStringBuilder into the given position.
  *
+ *      MyStringBuilder& insert(int, MyStringBuilder&&)
+ *          Moves the characters of the given MyStringBuilder into the
+ *          given position.
+ *
+ *      MyStringBuilder& insert(int, std::string_view)
+ *          Inserts a copy of the given characters into the given position.
+ *
  *      MyStringBuilder& append(const MyStringBuilder&)
  *          Inserts a copy of the given MyStringBuilder instance
  *          into the end of `this` MyStringBuilder.
  *
+ *      MyStringBuilder& append(MyStringBuilder&&)
+ *          Moves the characters of the given MyStringBuilder instance
+ *          into the end of `this` MyStringBuilder.
+ *
  *      MyStringBuilder& append(int)
  *          Inserts a copy of the given int into the end
  *          of `this` MyStringBuilder.
  *
+ *      MyStringBuilder& append(unsigned)
+ *          Inserts the decimal digits of the given unsigned int into the end
+ *          of `this` MyStringBuilder.
+ *
+ *      MyStringBuilder& append(long)
+ *          Inserts the decimal digits of the given long into the end
+ *          of `this` MyStringBuilder.
+ *
+ *      MyStringBuilder& append(unsigned long)
+ *          Inserts the decimal digits of the given unsigned long into the end
+ *          of `this` MyStringBuilder.
+ *
+ *      MyStringBuilder& append(long long)
+ *          Inserts the decimal digits of the given long long into the end
+ *          of `this` MyStringBuilder.
+ *
+ *      MyStringBuilder& append(unsigned long long)
+ *          Inserts the decimal digits of the given unsigned long long into the end
+ *          of `this` MyStringBuilder.
+ *
+ *      MyStringBuilder& append(double)
+ *          Inserts the shortest decimal form of the given double into the end
+ *          of `this` MyStringBuilder.
+ *
+ *      MyStringBuilder& append(float)
+ *          Inserts the shortest decimal form of the given float into the end
+ *          of `this` MyStringBuilder.
+ *
+ *      MyStringBuilder& append(char)
+ *          Inserts the given character into the end of `this` MyStringBuilder.
+ *
+ *      MyStringBuilder& append(bool)
+ *          Inserts "true" or "false" into the end of `this` MyStringBuilder.
+ *
+ *      MyStringBuilder& append(std::string_view)
+ *          Inserts a copy of the given characters into the end
+ *          of `this` MyStringBuilder.
+ *
+ *      MyStringBuilder& append(const char*)
+ *          Inserts a copy of the given null-terminated string into the end
+ *          of `this` MyStringBuilder.
+ *
  *      MyStringBuilder& replace(int begin, int end, const MyStringBuilder&)
  *          Replaces the substring from begin (inclusive) to
  *          end (exclusive) by a copy of the given MyStringBuilder instance.
  *
+ *      MyStringBuilder& replace(int begin, int end, std::string_view)
+ *          Replaces the substring from begin (inclusive) to
+ *          end (exclusive) by a copy of the given characters.
+ *
+ *      MyStringBuilder& apply(const EditBatch&)
+ *          Applies all the edits of the given EditBatch at once.
+ *
+ *      MyStringBuilder& replaceAll(const std::string&, const std::string&)
+ *          Replaces every occurrence of the target by the replacement.
+ *
+ *      MyStringBuilder& replaceFirst(const std::string&, const std::string&,
+ *                                    int count = 1)
+ *          Replaces the first count occurrences of the target
+ *          by the replacement.
+ *
  *      MyStringBuilder& toUpperCase()
  *          Changes all the characters in the MyStringBuilder instance to
  *          upper case.
  *
+ *      MyStringBuilder& toLowerCase()
+ *          Changes all the characters in the MyStringBuilder instance to
+ *          lower case.
+ *
+ *      MyStringBuilder& swapCase()
+ *          Swaps the case of all the characters in the MyStringBuilder
+ *          instance.
+ *
+ *      MyStringBuilder& transform(const ByteTable&)
+ *          Replaces each character of the MyStringBuilder instance by its
+ *          entry in the given table.
+ *
  *      int length() const
  *          Returns the number of characters in the MyStringBuilder instance.
  *
  *      char charAt(int) const
  *          Returns the character at the given index in MyStringBuilder instance.
  *
+ *      const_iterator begin() const
+ *          Returns an iterator at the first character.
+ *
+ *      const_iterator end() const
+ *          Returns an iterator past the last character.
+ *
+ *      bool forEachChunk(const Storage::ChunkVisitor&) const
+ *          Calls the visitor with each run of characters, in order.
+ *
  *      MyStringBuilder substring(int begin, int end)
  *          Returns a new MyStringBuilder instance from the characters between
  *          begin (inclusive) & end (exclusive).
@@ -48,27 +152,82 @@
  *          Returns a new MyStringBuilder instance from the characters starting
  *          from begin (inclusive) to the end of the MyStringBuilder.
  *
+ *      int indexOf(const std::string&, int fromIndex = 0) const
+ *          Returns the position of the first occurrence of the given string,
+ *          starting the search at fromIndex.
+ *
+ *      int lastIndexOf(const std::string&) const
+ *          Returns the position of the last occurrence of the given string.
+ *
+ *      int lastIndexOf(const std::string&, int fromIndex) const
+ *          Returns the position of the last occurrence of the given string,
+ *          starting at or before fromIndex.
+ *
+ *      bool contains(const std::string&) const
+ *          Returns true if the given string occurs in the MyStringBuilder.
+ *
+ *      bool startsWith(const std::string&) const
+ *          Returns true if the MyStringBuilder starts with the given string.
+ *
+ *      bool endsWith(const std::string&) const
+ *          Returns true if the MyStringBuilder ends with the given string.
+ *
  *      std::string toString() const
  *          Returns a string of the characters stored in the MyStringBuilder
  *          instance.
  *
- *      void clear()
- *          Makes the MyStringBuilder empty.
+ *      std::string toString(int begin, int end) const
+ *          Returns a string of the characters between begin & end.
+ *
+ *      void clear(int begin, int end)
+ *          Makes the range in the MyStringBuilder empty.
+ *
+ *      Mode getMode() const
+ *          Returns the storage mode of the MyStringBuilder instance.
+ *
+ *      NodeArena::Counters arenaCounters() const
+ *          Returns the allocation counters of the Nodes of a chain builder.
+ *
+ *      static MyStringBuilder fromFile(const std::string&,
+ *                                      long long offset = 0,
+ *                                      long long length = LLONG_MAX)
+ *          Returns a MyStringBuilder over the characters of the given file,
+ *          mapped instead of read.
+ *
+ *      void saveTo(const std::string&) const
+ *          Writes the characters of the MyStringBuilder to the given file.
+ *
+ *      void writeTo(int) const
+ *          Writes the characters of the MyStringBuilder to the given
+ *          file descriptor.
+ *
+ *      void writeTo(const std::string&) const
+ *          Writes the characters of the MyStringBuilder to the given file,
+ *          in place.
+ *
+ *      MyStringBuilder& readFrom(int)
+ *          Appends the characters read from the given file descriptor,
+ *          until its end.
  *
  * List of private Functions:
- *      MyStringBuilder(NodePtr, int)
+ *      MyStringBuilder(Storage*, Mode)
  *          Parameterized constructor of the MyStringBuilder class.
- *          Takes a Node pointer & a size parameter.
+ *          Takes a Storage pointer & its mode.
  *
- *      NodePtr* copyChain(int start = 0, int end = 0) const
- *          Returns a Node double pointer to the beginning of a Node chain
- *          that has the copies of characters of `this` MyStringBuilder instance
- *          from the given start (inclusive) to the given end (exclusive).
+ *      static Storage* makeStorage(std::string, Mode)
+ *          Returns a new Storage of the given mode holding
+ *          the characters of the given string.
  *
  *     void checkIndex(int) const
  *          Checks if the given index is valid (between 0 and size inclusive).
  *          If invalid, an invalid_argument exception is raised.
  *
+ *      const Storage& readable() const
+ *          Returns the Storage of the characters, for reading.
+ *
+ *      Storage& editable()
+ *          Returns the Storage of the characters, for editing.
+ *
  * List of global Functions:
  *      std::ostream& operator<<(std::ostream&, const MyStringBuilder&)
  *          Displays the string representation of the given MyStringBuilder
@@ -77,9 +236,72 @@
  *      void throwIndexException(int index, int end, int begin = 0)
  *          Throws an invalid_argument exception.
  *          The message is formatted based on the given parameters.
+ *
+ *      void appendFormatted(Storage&, T)
+ *          Appends the decimal form of the given number to the Storage.
+ *
+ *      void writeBatch(int, iovec*, int)
+ *          Writes all the given buffers to the given file descriptor.
+ *
+ *      int openTemporary(const std::string&, std::string&, int)
+ *          Creates a new file of a unique name next to the given path.
+ *
+ *      void syncFile(int)
+ *          Flushes the written characters of the given file descriptor
+ *          to the disk.
  */
 
+#include <atomic>
+#include <cerrno>
+#include <charconv>
+#include <climits>
+#include <cstdio>
+#include <memory>
+#include <stdexcept>
+#include <system_error>
+#include <vector>
+
+/* POSIX systems gather the chunks with writev, others write them in turn */
+#if defined(__unix__) or defined(__APPLE__)
+#define MYSTRINGBUILDER_POSIX_IO
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#else
+#include <fcntl.h>
+#include <io.h>
+#include <process.h>
+#include <sys/stat.h>
+
+#define getpid _getpid
+#define fsync _commit
+
+/* Same fields as the POSIX iovec */
+struct iovec {
+    void *iov_base;
+    size_t iov_len;
+};
+#endif
+
+#ifndef IOV_MAX
+#define IOV_MAX 1024
+#endif
+
+#ifndef O_CLOEXEC
+#define O_CLOEXEC 0
+#endif
+
+#ifndef O_BINARY
+#define O_BINARY 0
+#endif
+
+#include "ChainStorage.h"
+#include "GapBufferStorage.h"
 #include "MyStringBuilder.h"
+#include "PieceTableStorage.h"
+#include "RopeStorage.h"
+#include "Searcher.h"
 
 using namespace std;
 
@@ -104,111 +326,270 @@ void throwIndexException(int index, int end, int begin = 0) {
 
 /*
  * Pre-Conditions:
- *      A string whose characters are copied is given.
+ *      Reference to the Storage to append to.
+ *      Number to append, of a type supported by std::to_chars.
  *
  * Post-Conditions:
- *      A MyStringBuilder instance is created.
- *      first is initialized a Node* or remains a nullptr.
- *      size is equal to the size of the string.
+ *      The decimal form of the number is inserted at the end
+ *      of the Storage.
  *
- * Marked explicit to prevent implicit conversions from char* to string.
- * Parameterized constructor of the MyStringBuilder class.
+ * The number is formatted into a buffer on the stack, then copied once
+ * into the tail of the Storage, no heap allocation is made besides the
+ * growth of the Storage itself.
+ * Floating point numbers get the shortest form that reads back as
+ * the same number.
+ * Appends the decimal form of the given number to the Storage.
+ */
+template<typename T>
+static void appendFormatted(Storage& storage, T value) {
+    /* Longest forms: 20 digits & a sign, "-2.2250738585072014e-308" */
+    char digits[32];
+    const char *end = to_chars(digits, digits + sizeof(digits), value).ptr;
+
+    storage.insert(storage.length(), digits, (int) (end - digits));
+}
+
+/*
+ * Pre-Conditions:
+ *      int of a file descriptor open for writing.
+ *      Pointer to the buffers to write & their count, at most IOV_MAX.
+ *
+ * Post-Conditions:
+ *      All the characters of the buffers are written, in order.
+ *      The buffers are consumed, their fields are changed.
+ *      A system_error exception is thrown if a write fails.
+ *
+ * A partial write skips the buffers fully written & trims the next,
+ * interrupted writes are retried.
+ * Writes all the given buffers to the given file descriptor.
  */
-MyStringBuilder::MyStringBuilder(string s): first{nullptr} {
-    size = (int) s.size();
+static void writeBatch(int fd, iovec *buffers, int count) {
+    while (count) {
+#ifdef MYSTRINGBUILDER_POSIX_IO
+        const long long written = ::writev(fd, buffers, count);
+#else
+        const long long written = ::write(fd, buffers->iov_base,
+                                          (unsigned) buffers->iov_len);
+#endif
+
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+
+            throw system_error(errno, generic_category(),
+                               "Cannot write to descriptor " + to_string(fd));
+        }
 
-    /* s is empty */
-    if (not size) {
-        return;
+        auto left = (size_t) written;
+
+        while (count and buffers->iov_len <= left) {
+            left -= buffers->iov_len;
+            buffers++;
+            count--;
+        }
+
+        if (count) {
+            buffers->iov_base = (char*) buffers->iov_base + left;
+            buffers->iov_len -= left;
+        }
     }
+}
+
+/* Suffixes of the temporary files of saveTo, unique within the process */
+static atomic<unsigned> temporaries(0);
+
+/*
+ * Pre-Conditions:
+ *      const reference to the path the file will replace.
+ *      Reference to the string receiving the path of the new file.
+ *      int of the permissions of the new file, before the umask.
+ *
+ * Post-Conditions:
+ *      A file descriptor of the new, empty file open for writing
+ *      is returned, its path stored in the given string.
+ *      -1 is returned if it cannot be created, errno is set.
+ *
+ * The name joins the process identifier & a counter, so concurrent
+ * saves to the same path, from threads or processes, never share a file.
+ * O_EXCL never opens an existing file, a taken name is skipped.
+ * Creates a new file of a unique name next to the given path.
+ */
+static int openTemporary(const string& path, string& temporary, int mode) {
+    for (int attempt = 0; attempt < 100; attempt++) {
+        temporary = path + "." + to_string(getpid()) + "."
+                    + to_string(temporaries++) + ".tmp";
+
+        const int fd = ::open(temporary.c_str(),
+                              O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC | O_BINARY,
+                              mode);
 
-    first = new Node{s[0]};
-    NodePtr current = first;
+        if (0 <= fd or errno != EEXIST) {
+            return fd;
+        }
+    }
 
-    /*
-     * Iterate over the characters of s from the second to the last,
-     * adding them to Nodes chain.
-     */
-    for (int i = 1; i < size; i++) {
-        /* Node pointer */
-        auto newNext = new Node{s[i]};
+    return -1;
+}
 
-        current->chain(newNext);
-        current = current->getNext();
+/*
+ * Pre-Conditions:
+ *      int of a file descriptor open for writing.
+ *
+ * Post-Conditions:
+ *      The characters written to the descriptor are on the disk.
+ *      A system_error exception is thrown if they cannot be flushed.
+ *
+ * Flushes the written characters of the given file descriptor
+ * to the disk.
+ */
+static void syncFile(int fd) {
+    while (::fsync(fd) < 0) {
+        if (errno != EINTR) {
+            throw system_error(errno, generic_category(),
+                               "Cannot flush descriptor " + to_string(fd));
+        }
     }
 }
 
 /*
  * Pre-Conditions:
- *      NodePtr to a char Node.
- *      int of the number of Nodes.
+ *      A string whose characters are copied is given.
+ *      Storage mode (optional), default is Mode::kRope.
  *
  * Post-Conditions:
  *      A MyStringBuilder instance is created.
- *      first is initialized to the given NodePtr.
- *      size is initialized to the given size.
+ *      storage is initialized to a Storage holding the string characters.
+ *      mode is initialized to the given mode.
  *
- * Marked explicit to prevent implicit conversions from void* to Node*.
+ * The string is moved into the Storage, the gap buffer & piece table
+ * modes adopt its buffer, so `MyStringBuilder(std::move(s), mode)`
+ * does not copy the characters.
+ * Marked explicit to prevent implicit conversions from char* to string.
  * Parameterized constructor of the MyStringBuilder class.
- * Takes a Node pointer & a size parameter.
  */
-MyStringBuilder::MyStringBuilder(NodePtr ptr,
-                                 int length): first{ptr}, size{length} {}
+MyStringBuilder::MyStringBuilder(string s, Mode mode):
+        storage{makeStorage(std::move(s), mode)}, mode{mode} {}
 
 /*
  * Pre-Conditions:
- *      MyStringBuilder instance is initialized.
- *      Given start & end are valid indices.
- *      end is greater than or equal to start.
+ *      const reference to a MyStringBuilder instance to copy.
  *
  * Post-Conditions:
- *      A Node double pointer, pointing to the start
- *      of a memory chunk containing 2 Node pointers.
- *      The first of which is the start of the chain,
- *      while the second is the end.
- *      No changes to `this`.
+ *      A MyStringBuilder instance is created,
+ *      holding a copy of the characters of the given instance.
+ *      mode is initialized to the mode of the given instance.
  *
- * If `this` MyStringBuilder is empty, nullptr is returned.
- * Returns a Node double pointer to the beginning of a Node chain
- * that has the copies of characters of `this` MyStringBuilder instance
- * from the given start (inclusive) to the given end (exclusive).
+ * Copy constructor of the MyStringBuilder class.
  */
-MyStringBuilder::NodePtr* MyStringBuilder::copyChain(int start,
-                                                     int end) const {
-    if (not first) {
-        /* Empty StringBuilder */
-        return nullptr;
-    }
-
-    /* Initialize end to its default */
-    if (end <= 0) {
-        end = length();
-    }
+MyStringBuilder::MyStringBuilder(const MyStringBuilder& other):
+        storage{other.readable().copy(0, other.length())}, mode{other.mode} {}
 
-    checkIndex(start);
-    checkIndex(end);
+/*
+ * Pre-Conditions:
+ *      Pointer to a heap allocated Storage.
+ *      Mode of the given Storage.
+ *
+ * Post-Conditions:
+ *      A MyStringBuilder instance is created.
+ *      storage is initialized to the given Storage, owned by `this`.
+ *      mode is initialized to the given mode.
+ *
+ * Marked explicit to prevent implicit conversions from Storage*.
+ * Parameterized constructor of the MyStringBuilder class.
+ * Takes a Storage pointer & its mode.
+ */
+MyStringBuilder::MyStringBuilder(Storage *ptr, Mode mode):
+        storage{ptr}, mode{mode} {}
 
-    if (end < start) {
-        throwIndexException(end, length(), start);
+/*
+ * Pre-Conditions:
+ *      `this` & the given MyStringBuilder instances are initialized.
+ *
+ * Post-Conditions:
+ *      `this` holds a copy of the characters of the given instance.
+ *      mode is the mode of the given instance.
+ *      Returns a reference to `this`.
+ *
+ * The copy is made before the old storage is released, which prevents
+ * self assignment from losing the characters.
+ * Assignment operator for the MyStringBuilder class.
+ */
+MyStringBuilder& MyStringBuilder::operator=(const MyStringBuilder& other) {
+    /* Self-assignment test */
+    if (this == &other) {
+        return *this;
     }
 
-    /* Create beginning of a new Node chain */
-    auto begin = new Node{first->skip(start)->getData()};
-    NodePtr current = begin;
-    NodePtr pivot = first->skip(start)->getNext();
+    Storage *replacement = other.readable().copy(0, other.length());
+
+    delete storage;
+    storage = replacement;
+    mode = other.mode;
 
-    const int chainSize = end - start;
+    return *this;
+}
 
-    /* Iterate over all the characters from index begin + 1 to end */
-    for (int i = 1; i < chainSize; i++) {
-        current->chain(new Node{pivot->getData()});
+/*
+ * Pre-Conditions:
+ *      rvalue reference to a MyStringBuilder instance to move.
+ *
+ * Post-Conditions:
+ *      A MyStringBuilder instance is created,
+ *      holding the storage of the given instance.
+ *      mode is initialized to the mode of the given instance.
+ *      The given instance is empty, with the same mode.
+ *
+ * No character is copied & nothing is allocated, the given instance is
+ * left without a storage, see readable & editable.
+ * Move constructor of the MyStringBuilder class.
+ */
+MyStringBuilder::MyStringBuilder(MyStringBuilder&& other) noexcept:
+        storage{other.storage}, mode{other.mode} {
+    other.storage = nullptr;
+}
 
-        current = current->getNext();
-        pivot = pivot->getNext();
+/*
+ * Pre-Conditions:
+ *      `this` & the given MyStringBuilder instances are initialized.
+ *
+ * Post-Conditions:
+ *      `this` holds the storage of the given instance.
+ *      mode is the mode of the given instance.
+ *      The given instance is empty, with the same mode.
+ *      Returns a reference to `this`.
+ *
+ * No character is copied & nothing is allocated, the old storage of `this`
+ * is released, the given instance is left without a storage.
+ * Move assignment operator for the MyStringBuilder class.
+ */
+MyStringBuilder& MyStringBuilder::operator=(
+        MyStringBuilder&& other) noexcept {
+    /* Self-assignment test */
+    if (this == &other) {
+        return *this;
     }
 
-    /* Pointer to NodePtr array of size 2 */
-    return new NodePtr[2]{begin, current};
+    delete storage;
+    storage = other.storage;
+    mode = other.mode;
+    other.storage = nullptr;
+
+    return *this;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` MyStringBuilder instance is not destroyed.
+ *
+ * Post-Conditions:
+ *      `this` MyStringBuilder instance & its storage are destroyed.
+ *
+ * Destructor for the MyStringBuilder class.
+ */
+MyStringBuilder::~MyStringBuilder() {
+    delete storage;
+    storage = nullptr;
 }
 
 /*
@@ -228,28 +609,68 @@ MyStringBuilder& MyStringBuilder::insert(int offset,
                                          const MyStringBuilder& s) {
     checkIndex(offset);
 
-    /* Pointer to NodePtr array of size 2 */
-    const auto temp = s.copyChain();
-
-    /* s is Empty */
-    if (not temp) {
-        return *this;
+    /* Inserting `this` into itself, copy it before it changes */
+    if (this == &s) {
+        return insert(offset, MyStringBuilder(s));
     }
 
-    NodePtr chain_start = temp[0], chain_end = temp[1];
-    NodePtr current = first->skip(offset - 1);
+    editable().insert(offset, s.readable());
+    return *this;
+}
+
+/*
+ * Pre-Conditions:
+ *      MyStringBuilder instance is initialized.
+ *      int position of the insertion, must be valid.
+ *      rvalue reference to a MyStringBuilder instance to insert.
+ *
+ * Post-Conditions:
+ *      The characters of the given
+ *      MyStringBuilder are inserted at the given position.
+ *      The given MyStringBuilder is empty.
+ *      A reference to `this` is returned.
+ *
+ * If both instances have the same mode, the storage of the given instance
+ * is spliced in without copying its characters.
+ * Moves the characters of the given MyStringBuilder into the
+ * given position.
+ */
+MyStringBuilder& MyStringBuilder::insert(int offset, MyStringBuilder&& s) {
+    checkIndex(offset);
+
+    /* Moving `this` into itself, it keeps its characters */
+    if (this == &s) {
+        return insert(offset, static_cast<const MyStringBuilder&>(s));
+    }
 
-    if (not offset) {
-        /* Handle changing first NodePtr */
-        chain_end->chain(first);
-        first = chain_start;
-    } else {
-        /* Connect the copy chain to the main chain */
-        chain_end->chain(current->getNext());
-        current->chain(chain_start);
+    /* A moved-from instance has no storage & nothing to splice */
+    if (s.storage) {
+        editable().splice(offset, *s.storage);
     }
 
-    size += s.length();
+    return *this;
+}
+
+/*
+ * Pre-Conditions:
+ *      MyStringBuilder instance is initialized.
+ *      int position of the insertion, must be valid.
+ *      string_view of the characters to insert, not viewing
+ *      the characters of `this`.
+ *
+ * Post-Conditions:
+ *      The characters of the given string_view are inserted
+ *      at the given position.
+ *      A reference to `this` is returned.
+ *
+ * The characters are copied straight into the storage, without
+ * building a temporary MyStringBuilder around them.
+ * Inserts a copy of the given characters into the given position.
+ */
+MyStringBuilder& MyStringBuilder::insert(int offset, string_view s) {
+    checkIndex(offset);
+
+    editable().insert(offset, s.data(), (int) s.size());
     return *this;
 }
 
@@ -272,6 +693,26 @@ MyStringBuilder& MyStringBuilder::append(const MyStringBuilder& s) {
     return insert(length(), s);
 }
 
+/*
+ * Pre-Conditions:
+ *      MyStringBuilder instance is initialized.
+ *      rvalue reference to a MyStringBuilder instance to insert
+ *      at the end of `this` MyStringBuilder instance.
+ *
+ * Post-Conditions:
+ *      The characters of the given MyStringBuilder instance
+ *      are inserted at the end of `this`.
+ *      The given MyStringBuilder is empty.
+ *      A reference to `this` is returned.
+ *
+ * Equivalent to insert(length(), std::move(s)).
+ * Moves the characters of the given MyStringBuilder instance
+ * into the end of `this` MyStringBuilder.
+ */
+MyStringBuilder& MyStringBuilder::append(MyStringBuilder&& s) {
+    return insert(length(), std::move(s));
+}
+
 /*
  * Pre-Conditions:
  *      MyStringBuilder instance is initialized.
@@ -281,102 +722,355 @@ MyStringBuilder& MyStringBuilder::append(const MyStringBuilder& s) {
  *      The given int is inserted at the end of `this`.
  *      A reference to `this` is returned.
  *
- * Equivalent to append(to_string(i))
+ * Equivalent to append(to_string(i)), without building a string
+ * or a temporary MyStringBuilder, see appendFormatted.
  * Inserts a copy of the given int into the end
  * of `this` MyStringBuilder.
  */
 MyStringBuilder& MyStringBuilder::append(int i) {
-    return append(MyStringBuilder(to_string(i)));
+    appendFormatted(editable(), i);
+    return *this;
 }
 
 /*
  * Pre-Conditions:
  *      MyStringBuilder instance is initialized.
+ *      unsigned int to append to the MyStringBuilder.
  *
  * Post-Conditions:
- *      Number of characters in the builder is returned.
- *      No changes to `this`.
+ *      The decimal digits of the given unsigned int are inserted at
+ *      the end of `this`.
+ *      A reference to `this` is returned.
  *
- * Marked [[nodiscard]] to allow the compiler to issue warnings in case of
- * wasteful calls. For example `builder.length();`.
- * Returns the number of characters in the MyStringBuilder instance.
+ * Formatted on the stack, see appendFormatted.
+ * Inserts the decimal digits of the given unsigned int into the end
+ * of `this` MyStringBuilder.
  */
-int MyStringBuilder::length() const {
-    return size;
+MyStringBuilder& MyStringBuilder::append(unsigned i) {
+    appendFormatted(editable(), i);
+    return *this;
 }
 
 /*
  * Pre-Conditions:
  *      MyStringBuilder instance is initialized.
- *      Given int position is valid.
+ *      long to append to the MyStringBuilder.
  *
  * Post-Conditions:
- *      Characters in the builder at the given position is returned.
- *      No changes to `this`.
+ *      The decimal digits of the given long are inserted at
+ *      the end of `this`.
+ *      A reference to `this` is returned.
  *
- * Marked [[nodiscard]] to allow the compiler to issue warnings in case of
- * wasteful calls. For example `builder.charAt(0);`.
- * Returns the character at the given index in MyStringBuilder instance.
+ * Formatted on the stack, see appendFormatted.
+ * Inserts the decimal digits of the given long into the end
+ * of `this` MyStringBuilder.
  */
-char MyStringBuilder::charAt(int position) const {
-    checkIndex(position);
-
-    return first->skip(position)->getData();
+MyStringBuilder& MyStringBuilder::append(long i) {
+    appendFormatted(editable(), i);
+    return *this;
 }
 
 /*
  * Pre-Conditions:
  *      MyStringBuilder instance is initialized.
- *      Given begin & end are valid indices.
- *      end is greater than or equal to begin.
+ *      unsigned long to append to the MyStringBuilder.
  *
  * Post-Conditions:
- *      A MyStringBuilder instance is returned,
- *      having the characters between begin (inclusive)
- *      & end (exclusive) of `this`.
- *      No changes to `this`.
+ *      The decimal digits of the given unsigned long are inserted at
+ *      the end of `this`.
+ *      A reference to `this` is returned.
  *
- * Marked [[nodiscard]] to allow the compiler to issue warnings in case of
- * wasteful calls. For example `builder.substring(0, length());`.
- * Returns a new MyStringBuilder instance from the characters between
- * begin (inclusive) & end (exclusive)
+ * Formatted on the stack, see appendFormatted.
+ * Inserts the decimal digits of the given unsigned long into the end
+ * of `this` MyStringBuilder.
  */
-MyStringBuilder MyStringBuilder::substring(int begin, int end) const {
-    checkIndex(begin);
-    checkIndex(end);
-
-    if (end < begin) {
-        throwIndexException(end, length(), begin);
-    } else if (end == begin) {
-        /* Range is empty */
-        return MyStringBuilder("");
-    }
-
-    /* Pointer to NodePtr array of size 2 */
-    const auto temp = copyChain(begin, end);
-
-    /* `this` is empty */
-    if (not temp) {
-        return MyStringBuilder("");
-    }
-
-    /* Return a new MyStringBuilder with begin */
-    return MyStringBuilder(temp[0], end - begin);
+MyStringBuilder& MyStringBuilder::append(unsigned long i) {
+    appendFormatted(editable(), i);
+    return *this;
 }
 
 /*
  * Pre-Conditions:
  *      MyStringBuilder instance is initialized.
- *      Given begin is a valid index.
+ *      long long to append to the MyStringBuilder.
  *
  * Post-Conditions:
- *      A MyStringBuilder instance is returned,
- *      having the characters after begin (inclusive) of `this`.
- *      No changes to `this`.
+ *      The decimal digits of the given long long are inserted at
+ *      the end of `this`.
+ *      A reference to `this` is returned.
  *
- * Equivalent to substring(begin, length()).
- * Marked [[nodiscard]] to allow the compiler to issue warnings in case of
- * wasteful calls. For example `builder.substring(0);`.
+ * Formatted on the stack, see appendFormatted.
+ * Inserts the decimal digits of the given long long into the end
+ * of `this` MyStringBuilder.
+ */
+MyStringBuilder& MyStringBuilder::append(long long i) {
+    appendFormatted(editable(), i);
+    return *this;
+}
+
+/*
+ * Pre-Conditions:
+ *      MyStringBuilder instance is initialized.
+ *      unsigned long long to append to the MyStringBuilder.
+ *
+ * Post-Conditions:
+ *      The decimal digits of the given unsigned long long are inserted at
+ *      the end of `this`.
+ *      A reference to `this` is returned.
+ *
+ * Formatted on the stack, see appendFormatted.
+ * Inserts the decimal digits of the given unsigned long long into the end
+ * of `this` MyStringBuilder.
+ */
+MyStringBuilder& MyStringBuilder::append(unsigned long long i) {
+    appendFormatted(editable(), i);
+    return *this;
+}
+
+/*
+ * Pre-Conditions:
+ *      MyStringBuilder instance is initialized.
+ *      double to append to the MyStringBuilder.
+ *
+ * Post-Conditions:
+ *      The shortest decimal form that reads back as the same double
+ *      is inserted at the end of `this`, "inf" & "nan" for the
+ *      special values.
+ *      A reference to `this` is returned.
+ *
+ * Unlike Java, a whole number has no ".0" & large numbers use an
+ * exponent only when shorter, as std::to_chars does.
+ * Inserts the shortest decimal form of the given double into the end
+ * of `this` MyStringBuilder.
+ */
+MyStringBuilder& MyStringBuilder::append(double d) {
+    appendFormatted(editable(), d);
+    return *this;
+}
+
+/*
+ * Pre-Conditions:
+ *      MyStringBuilder instance is initialized.
+ *      float to append to the MyStringBuilder.
+ *
+ * Post-Conditions:
+ *      The shortest decimal form that reads back as the same float
+ *      is inserted at the end of `this`, "inf" & "nan" for the
+ *      special values.
+ *      A reference to `this` is returned.
+ *
+ * Formatted as a float, so 0.1f is "0.1" rather than the digits of
+ * the nearest double.
+ * Inserts the shortest decimal form of the given float into the end
+ * of `this` MyStringBuilder.
+ */
+MyStringBuilder& MyStringBuilder::append(float f) {
+    appendFormatted(editable(), f);
+    return *this;
+}
+
+/*
+ * Pre-Conditions:
+ *      MyStringBuilder instance is initialized.
+ *      char to append to the MyStringBuilder.
+ *
+ * Post-Conditions:
+ *      The given character is inserted at the end of `this`.
+ *      A reference to `this` is returned.
+ *
+ * Appends the character itself, not its code as append(int) would.
+ * Inserts the given character into the end of `this` MyStringBuilder.
+ */
+MyStringBuilder& MyStringBuilder::append(char c) {
+    editable().insert(length(), &c, 1);
+    return *this;
+}
+
+/*
+ * Pre-Conditions:
+ *      MyStringBuilder instance is initialized.
+ *      bool to append to the MyStringBuilder.
+ *
+ * Post-Conditions:
+ *      "true" or "false" is inserted at the end of `this`.
+ *      A reference to `this` is returned.
+ *
+ * Same text as Java's StringBuilder.append(boolean).
+ * Inserts "true" or "false" into the end of `this` MyStringBuilder.
+ */
+MyStringBuilder& MyStringBuilder::append(bool b) {
+    return append(b ? string_view("true") : string_view("false"));
+}
+
+/*
+ * Pre-Conditions:
+ *      MyStringBuilder instance is initialized.
+ *      string_view of the characters to append.
+ *
+ * Post-Conditions:
+ *      The characters of the given string_view are inserted at
+ *      the end of `this`.
+ *      A reference to `this` is returned.
+ *
+ * Copied straight from the given characters, without a temporary
+ * MyStringBuilder. Also taken by std::string arguments.
+ * Inserts a copy of the given characters into the end
+ * of `this` MyStringBuilder.
+ */
+MyStringBuilder& MyStringBuilder::append(std::string_view s) {
+    editable().insert(length(), s.data(), (int) s.size());
+    return *this;
+}
+
+/*
+ * Pre-Conditions:
+ *      MyStringBuilder instance is initialized.
+ *      Pointer to a null-terminated string, or nullptr.
+ *
+ * Post-Conditions:
+ *      The characters of the given string are inserted at
+ *      the end of `this`, "null" for nullptr.
+ *      A reference to `this` is returned.
+ *
+ * Like Java, a null string appends "null".
+ * Inserts a copy of the given null-terminated string into the end
+ * of `this` MyStringBuilder.
+ */
+MyStringBuilder& MyStringBuilder::append(const char *s) {
+    return append(s ? string_view(s) : string_view("null"));
+}
+
+/*
+ * Pre-Conditions:
+ *      MyStringBuilder instance is initialized.
+ *
+ * Post-Conditions:
+ *      Number of characters in the builder is returned.
+ *      No changes to `this`.
+ *
+ * Marked [[nodiscard]] to allow the compiler to issue warnings in case of
+ * wasteful calls. For example `builder.length();`.
+ * Returns the number of characters in the MyStringBuilder instance.
+ */
+int MyStringBuilder::length() const {
+    return readable().length();
+}
+
+/*
+ * Pre-Conditions:
+ *      MyStringBuilder instance is initialized.
+ *      Given int position is valid.
+ *
+ * Post-Conditions:
+ *      Characters in the builder at the given position is returned.
+ *      No changes to `this`.
+ *
+ * Marked [[nodiscard]] to allow the compiler to issue warnings in case of
+ * wasteful calls. For example `builder.charAt(0);`.
+ * Returns the character at the given index in MyStringBuilder instance.
+ */
+char MyStringBuilder::charAt(int position) const {
+    checkIndex(position);
+
+    if (position == length()) {
+        throwIndexException(position, length() - 1);
+    }
+
+    return readable().charAt(position);
+}
+
+/*
+ * Pre-Conditions:
+ *      MyStringBuilder instance is initialized.
+ *
+ * Post-Conditions:
+ *      An iterator at the first character is returned,
+ *      equal to end() if `this` is empty.
+ *      No changes to `this`.
+ *
+ * Sequential reads through the iterator are amortized O(1) in every
+ * mode, unlike a loop of charAt calls.
+ * Returns an iterator at the first character.
+ */
+MyStringBuilder::const_iterator MyStringBuilder::begin() const {
+    return {&readable(), 0};
+}
+
+/*
+ * Pre-Conditions:
+ *      MyStringBuilder instance is initialized.
+ *
+ * Post-Conditions:
+ *      An iterator past the last character is returned.
+ *      No changes to `this`.
+ *
+ * Returns an iterator past the last character.
+ */
+MyStringBuilder::const_iterator MyStringBuilder::end() const {
+    return {&readable(), length()};
+}
+
+/*
+ * Pre-Conditions:
+ *      MyStringBuilder instance is initialized.
+ *      const reference to a ChunkVisitor, not changing `this`.
+ *
+ * Post-Conditions:
+ *      The visitor is called with each run of characters, in order,
+ *      until it returns false.
+ *      Returns false if the visitor stopped the visit.
+ *      No changes to `this`.
+ *
+ * The runs are the storage's own blocks, so scanners that carry their
+ * state between runs read every character once, without a copy.
+ * Calls the visitor with each run of characters, in order.
+ */
+bool MyStringBuilder::forEachChunk(const Storage::ChunkVisitor& visitor) const {
+    return readable().forEachChunk(0, length(), visitor);
+}
+
+/*
+ * Pre-Conditions:
+ *      MyStringBuilder instance is initialized.
+ *      Given begin & end are valid indices.
+ *      end is greater than or equal to begin.
+ *
+ * Post-Conditions:
+ *      A MyStringBuilder instance is returned,
+ *      having the characters between begin (inclusive)
+ *      & end (exclusive) of `this`.
+ *      No changes to `this`.
+ *
+ * Marked [[nodiscard]] to allow the compiler to issue warnings in case of
+ * wasteful calls. For example `builder.substring(0, length());`.
+ * Returns a new MyStringBuilder instance from the characters between
+ * begin (inclusive) & end (exclusive)
+ */
+MyStringBuilder MyStringBuilder::substring(int begin, int end) const {
+    checkIndex(begin);
+    checkIndex(end);
+
+    if (end < begin) {
+        throwIndexException(end, length(), begin);
+    }
+
+    /* Return a new MyStringBuilder of the same mode */
+    return MyStringBuilder(readable().copy(begin, end), mode);
+}
+
+/*
+ * Pre-Conditions:
+ *      MyStringBuilder instance is initialized.
+ *      Given begin is a valid index.
+ *
+ * Post-Conditions:
+ *      A MyStringBuilder instance is returned,
+ *      having the characters after begin (inclusive) of `this`.
+ *      No changes to `this`.
+ *
+ * Equivalent to substring(begin, length()).
+ * Marked [[nodiscard]] to allow the compiler to issue warnings in case of
+ * wasteful calls. For example `builder.substring(0);`.
  * Returns a new MyStringBuilder instance from the characters starting
  * from begin (inclusive) to the end of the MyStringBuilder.
  */
@@ -391,8 +1085,7 @@ MyStringBuilder MyStringBuilder::substring(int begin) const {
  *
  * Post-Conditions:
  *      The MyStringBuilder is empty from begin to end.
- *      first is nullptr.
- *      size is 0.
+ *      length() is reduced by end - begin.
  *
  * Makes the range in the MyStringBuilder empty.
  */
@@ -402,22 +1095,9 @@ void MyStringBuilder::clear(int begin, int end) {
 
     if (begin > end) {
         throwIndexException(end, length(), begin);
-    } else if (begin == end) {
-        return;
-    }
-
-    NodePtr begin_ptr = first->skip(begin - 1);
-    NodePtr end_ptr = begin_ptr->unchain(end - begin - !begin);
-
-    if (not begin) {
-        /* Handle changing first NodePtr */
-        first = end_ptr;
-    } else {
-        /* Connect the copy chain to the main chain */
-        begin_ptr->chain(end_ptr);
     }
 
-    size -= end - begin;
+    editable().erase(begin, end);
 }
 
 /*
@@ -445,30 +1125,13 @@ MyStringBuilder& MyStringBuilder::replace(int begin, int end,
         return *this;
     }
 
-    /* Pointer to NodePtr array of size 2 */
-    const auto temp = s.copyChain();
-
-    /* s is Empty */
-    if (not temp) {
-        clear(begin, end);
-        return *this;
-    }
-
-    NodePtr chain_start = temp[0], chain_end = temp[1];
-
-    NodePtr begin_ptr = first->skip(begin - 1);
-    NodePtr end_ptr = begin_ptr->unchain(end - begin - !begin);
-
-    if (not begin) {
-        /* Handle changing first NodePtr */
-        first = chain_start;
-    } else {
-        /* Connect the copy chain to the main chain */
-        begin_ptr->chain(chain_start);
+    /* Replacing with `this`, copy it before it changes */
+    if (this == &s) {
+        return replace(begin, end, MyStringBuilder(s));
     }
 
-    chain_end->chain(end_ptr);
-    size += s.length() - end + begin;
+    editable().erase(begin, end);
+    editable().insert(begin, s.readable());
 
     return *this;
 }
@@ -476,83 +1139,794 @@ MyStringBuilder& MyStringBuilder::replace(int begin, int end,
 /*
  * Pre-Conditions:
  *      MyStringBuilder instance is initialized.
+ *      begin & end are valid indices.
+ *      end is greater than or equal to begin.
+ *      string_view of the replacement characters, not viewing
+ *      the characters of `this`.
  *
  * Post-Conditions:
- *      The characters in `this` MyStringBuilder are all capitalized.
+ *      The characters between begin (inclusive) & end (exclusive)
+ *      are replaced with the given characters.
  *      A reference to `this` is returned.
  *
- * Changes all the characters in the MyStringBuilder instance to
- * upper case.
+ * Same checks as the MyStringBuilder overload, the characters are
+ * copied straight into the storage.
+ * Replaces the substring from begin (inclusive) to
+ * end (exclusive) by a copy of the given characters.
  */
-MyStringBuilder& MyStringBuilder::toUpperCase() {
-    NodePtr current = first;
+MyStringBuilder& MyStringBuilder::replace(int begin, int end,
+                                          string_view s) {
+    checkIndex(begin);
+    checkIndex(end);
 
-    /* Iterate over all characters & change them to upper case */
-    while (current) {
-        current->setData((char) toupper(current->getData()));
-        current = current->getNext();
+    if (end < begin) {
+        throwIndexException(end, length(), begin);
+    } else if (end == begin) {
+        return *this;
     }
 
+    editable().erase(begin, end);
+    editable().insert(begin, s.data(), (int) s.size());
+
     return *this;
 }
 
-
 /*
  * Pre-Conditions:
  *      MyStringBuilder instance is initialized.
+ *      const reference to an EditBatch, its positions are in the
+ *      current characters of `this`.
  *
  * Post-Conditions:
- *      A string of the characters in `this` MyStringBuilder is returned.
- *      No changes to `this`.
+ *      All the edits of the batch are applied, with the result of
+ *      applying them one by one.
+ *      An invalid_argument exception is thrown, with `this`
+ *      unchanged, if an edit ends past length() or two removed
+ *      ranges overlap.
+ *      A reference to `this` is returned.
  *
- * Returns a string of the characters stored in the MyStringBuilder
- * instance.
+ * The edits are applied in place, from the last to the first,
+ * see EditBatch::applyTo, so the characters between them are
+ * neither copied nor moved.
+ * Applies all the edits of the given EditBatch at once.
  */
-string MyStringBuilder::toString() const {
-    string result{};
-
-    NodePtr current = first;
-
-    /* Iterate over all the character & add them to the string */
-    while (current) {
-        result.push_back(current->getData());
-        current = current->getNext();
+MyStringBuilder& MyStringBuilder::apply(const EditBatch& batch) {
+    if (not batch.size()) {
+        return *this;
     }
 
-    return result;
+    batch.applyTo(editable());
+
+    return *this;
 }
 
 /*
  * Pre-Conditions:
- *      Reference to an output stream.
- *      const reference to a MyStringBuilder instance.
+ *      MyStringBuilder instance is initialized.
+ *      const reference to the target string.
+ *      const reference to the replacement string.
  *
  * Post-Conditions:
- *      String representation of MyStringBuilder is displayed.
- *      ostream& is returned.
+ *      Every non-overlapping occurrence of the target, from left to
+ *      right, is replaced by the replacement.
+ *      Like Java, an empty target matches before each character &
+ *      at the end.
+ *      A reference to `this` is returned.
  *
- * Displays the string representation of the given MyStringBuilder
- * instance in the given ostream.
+ * Equivalent to replaceFirst(target, replacement, INT_MAX).
+ * Replaces every occurrence of the target by the replacement.
  */
-ostream& operator<<(ostream& out, const MyStringBuilder& str) {
-    return out << str.toString();
+MyStringBuilder& MyStringBuilder::replaceAll(const string& target,
+                                             const string& replacement) {
+    return replaceFirst(target, replacement, INT_MAX);
 }
 
 /*
  * Pre-Conditions:
  *      MyStringBuilder instance is initialized.
- *      An int of the index to check.
+ *      const reference to the target string.
+ *      const reference to the replacement string.
+ *      int of the most occurrences to replace (optional),
+ *      default is 1, must be at least 0.
  *
  * Post-Conditions:
- *      A invalid_argument exception is thrown if the
- *      index is invalid.
- *      No changes to `this`.
+ *      The first count non-overlapping occurrences of the target,
+ *      from left to right, are replaced by the replacement.
+ *      An invalid_argument exception is thrown if count is negative.
+ *      A reference to `this` is returned.
  *
- * Checks if the given index is valid (between 0 and size inclusive).
- * If invalid, an invalid_argument exception is raised.
+ * The characters before the first occurrence are copied as a block,
+ * shared in rope mode, the rest is searched & copied in a single pass
+ * into a new storage of the same mode, see Searcher::copyReplacing.
+ * Without any occurrence `this` is left untouched.
+ * Replaces the first count occurrences of the target
+ * by the replacement.
  */
-void MyStringBuilder::checkIndex(int index) const {
-    if (index < 0 or length() < index) {
-        throwIndexException(index, length());
+MyStringBuilder& MyStringBuilder::replaceFirst(const string& target,
+                                               const string& replacement,
+                                               int count) {
+    if (count < 0) {
+        throw invalid_argument(
+                "Invalid count " + to_string(count) + ". Must be >= 0.\n"
+        );
     }
+
+    const Searcher searcher(target);
+    const int first = count ? searcher.find(readable(), 0, length()) : -1;
+
+    if (first == -1) {
+        return *this;
+    }
+
+    Storage *result = readable().copy(0, first);
+
+    searcher.copyReplacing(readable(), first, *result, replacement, count);
+
+    delete storage;
+    storage = result;
+
+    return *this;
+}
+
+/*
+ * Pre-Conditions:
+ *      MyStringBuilder instance is initialized.
+ *
+ * Post-Conditions:
+ *      The characters in `this` MyStringBuilder are all capitalized.
+ *      A reference to `this` is returned.
+ *
+ * Each chunk is converted by the SIMD kernel of ByteTransform,
+ * with the result of toupper in the "C" locale.
+ * Changes all the characters in the MyStringBuilder instance to
+ * upper case.
+ */
+MyStringBuilder& MyStringBuilder::toUpperCase() {
+    editable().forEachMutableChunk(0, length(), upperCaseBytes);
+
+    return *this;
+}
+
+/*
+ * Pre-Conditions:
+ *      MyStringBuilder instance is initialized.
+ *
+ * Post-Conditions:
+ *      The characters in `this` MyStringBuilder are all in lower case.
+ *      A reference to `this` is returned.
+ *
+ * Each chunk is converted by the SIMD kernel of ByteTransform.
+ * Changes all the characters in the MyStringBuilder instance to
+ * lower case.
+ */
+MyStringBuilder& MyStringBuilder::toLowerCase() {
+    editable().forEachMutableChunk(0, length(), lowerCaseBytes);
+
+    return *this;
+}
+
+/*
+ * Pre-Conditions:
+ *      MyStringBuilder instance is initialized.
+ *
+ * Post-Conditions:
+ *      Upper case characters in `this` are in lower case,
+ *      & lower case characters are in upper case.
+ *      A reference to `this` is returned.
+ *
+ * Each chunk is converted by the SIMD kernel of ByteTransform.
+ * Swaps the case of all the characters in the MyStringBuilder
+ * instance.
+ */
+MyStringBuilder& MyStringBuilder::swapCase() {
+    editable().forEachMutableChunk(0, length(), swapCaseBytes);
+
+    return *this;
+}
+
+/*
+ * Pre-Conditions:
+ *      MyStringBuilder instance is initialized.
+ *      const reference to a table of 256 replacements,
+ *      indexed by the characters as unsigned char.
+ *
+ * Post-Conditions:
+ *      Each character c of `this` is replaced by
+ *      table[(unsigned char) c].
+ *      A reference to `this` is returned.
+ *
+ * Replaces each character of the MyStringBuilder instance by its
+ * entry in the given table.
+ */
+MyStringBuilder& MyStringBuilder::transform(const ByteTable& table) {
+    editable().forEachMutableChunk(0, length(),
+                                 [&table](char *data, int count) {
+        mapBytes(data, count, table);
+    });
+
+    return *this;
+}
+
+
+/*
+ * Pre-Conditions:
+ *      MyStringBuilder instance is initialized.
+ *      const reference to the string to search for.
+ *      int of the position to start from (optional), default is 0.
+ *
+ * Post-Conditions:
+ *      The position of the first occurrence starting at or after
+ *      fromIndex is returned, -1 if there is none.
+ *      No changes to `this`.
+ *
+ * The storage is searched in place, including the matches straddling
+ * its chunks, see Searcher.
+ * Like Java, fromIndex is clamped to [0, length()].
+ * Returns the position of the first occurrence of the given string,
+ * starting the search at fromIndex.
+ */
+int MyStringBuilder::indexOf(const string& s, int fromIndex) const {
+    const int begin = min(max(fromIndex, 0), length());
+
+    return Searcher(s).find(readable(), begin, length());
+}
+
+/*
+ * Pre-Conditions:
+ *      MyStringBuilder instance is initialized.
+ *      const reference to the string to search for.
+ *
+ * Post-Conditions:
+ *      The position of the last occurrence is returned,
+ *      -1 if there is none.
+ *      No changes to `this`.
+ *
+ * Equivalent to lastIndexOf(s, length()).
+ * Returns the position of the last occurrence of the given string.
+ */
+int MyStringBuilder::lastIndexOf(const string& s) const {
+    return lastIndexOf(s, length());
+}
+
+/*
+ * Pre-Conditions:
+ *      MyStringBuilder instance is initialized.
+ *      const reference to the string to search for.
+ *      int of the last position a match may start at.
+ *
+ * Post-Conditions:
+ *      The position of the last occurrence starting at or before
+ *      fromIndex is returned, -1 if there is none.
+ *      No changes to `this`.
+ *
+ * The storage is searched backwards in windows, so the cost depends on
+ * the distance of the match from fromIndex.
+ * Like Java, a negative fromIndex finds nothing.
+ * Returns the position of the last occurrence of the given string,
+ * starting at or before fromIndex.
+ */
+int MyStringBuilder::lastIndexOf(const string& s, int fromIndex) const {
+    if (fromIndex < 0) {
+        return -1;
+    }
+
+    /* Matches starting at fromIndex end before fromIndex + s.size() */
+    const int last = min(fromIndex, length());
+    const int end = (int) min((long long) last + (long long) s.size(),
+                              (long long) length());
+
+    return Searcher(s).findLast(readable(), 0, end);
+}
+
+/*
+ * Pre-Conditions:
+ *      MyStringBuilder instance is initialized.
+ *      const reference to the string to search for.
+ *
+ * Post-Conditions:
+ *      Returns true if the string occurs in `this`.
+ *      No changes to `this`.
+ *
+ * Equivalent to indexOf(s) != -1.
+ * Returns true if the given string occurs in the MyStringBuilder.
+ */
+bool MyStringBuilder::contains(const string& s) const {
+    return indexOf(s) != -1;
+}
+
+/*
+ * Pre-Conditions:
+ *      MyStringBuilder instance is initialized.
+ *      const reference to the prefix to compare with.
+ *
+ * Post-Conditions:
+ *      Returns true if the first characters of `this` are equal to
+ *      the given string.
+ *      No changes to `this`.
+ *
+ * Only the first s.size() characters are compared.
+ * Returns true if the MyStringBuilder starts with the given string.
+ */
+bool MyStringBuilder::startsWith(const string& s) const {
+    return Searcher(s).matchesAt(readable(), 0);
+}
+
+/*
+ * Pre-Conditions:
+ *      MyStringBuilder instance is initialized.
+ *      const reference to the suffix to compare with.
+ *
+ * Post-Conditions:
+ *      Returns true if the last characters of `this` are equal to
+ *      the given string.
+ *      No changes to `this`.
+ *
+ * Only the last s.size() characters are compared.
+ * Returns true if the MyStringBuilder ends with the given string.
+ */
+bool MyStringBuilder::endsWith(const string& s) const {
+    if (length() < (int) s.size()) {
+        return false;
+    }
+
+    return Searcher(s).matchesAt(readable(), length() - (int) s.size());
+}
+
+/*
+ * Pre-Conditions:
+ *      MyStringBuilder instance is initialized.
+ *
+ * Post-Conditions:
+ *      A string of the characters in `this` MyStringBuilder is returned.
+ *      No changes to `this`.
+ *
+ * Each chunk is copied in bulk.
+ * Returns a string of the characters stored in the MyStringBuilder
+ * instance.
+ */
+string MyStringBuilder::toString() const {
+    string result{};
+
+    /* Allocated once, the chunks are copied without regrowing */
+    result.reserve(length());
+
+    /* Iterate over all the chunks & add them to the string */
+    readable().forEachChunk(0, length(), [&result](const char *data,
+                                                 int count) {
+        result.append(data, count);
+        return true;
+    });
+
+    return result;
+}
+
+/*
+ * Pre-Conditions:
+ *      MyStringBuilder instance is initialized.
+ *      begin & end are valid indices, begin <= end.
+ *
+ * Post-Conditions:
+ *      A string of the characters between begin (inclusive)
+ *      & end (exclusive) is returned.
+ *      No changes to `this`.
+ *
+ * Only the chunks of the range are visited, unlike
+ * substring(begin, end).toString() no MyStringBuilder is built.
+ * Returns a string of the characters between begin & end.
+ */
+string MyStringBuilder::toString(int begin, int end) const {
+    checkIndex(begin);
+    checkIndex(end);
+
+    if (end < begin) {
+        throwIndexException(end, length(), begin);
+    }
+
+    string result{};
+
+    result.reserve(end - begin);
+
+    readable().forEachChunk(begin, end, [&result](const char *data,
+                                                int count) {
+        result.append(data, count);
+        return true;
+    });
+
+    return result;
+}
+
+/*
+ * Pre-Conditions:
+ *      Reference to an output stream.
+ *      const reference to a MyStringBuilder instance.
+ *
+ * Post-Conditions:
+ *      String representation of MyStringBuilder is displayed.
+ *      ostream& is returned.
+ *
+ * No string is built, the chunks are written directly to the stream,
+ * so the peak memory does not grow with the length of the builder,
+ * unless a width is set on the stream.
+ * Displays the string representation of the given MyStringBuilder
+ * instance in the given ostream.
+ */
+ostream& operator<<(ostream& out, const MyStringBuilder& str) {
+    /* Padding needs the whole string, like any string output */
+    if (out.width()) {
+        return out << str.toString();
+    }
+
+    /* Write the chunks as they are stored, until the stream fails */
+    str.readable().forEachChunk(0, str.length(),
+                              [&out](const char *data, int count) {
+        return bool(out.write(data, count));
+    });
+
+    return out;
+}
+
+/*
+ * Pre-Conditions:
+ *      MyStringBuilder instance is initialized.
+ *
+ * Post-Conditions:
+ *      Storage mode of the builder is returned.
+ *      No changes to `this`.
+ *
+ * Marked [[nodiscard]] to allow the compiler to issue warnings in case of
+ * wasteful calls. For example `builder.getMode();`.
+ * Returns the storage mode of the MyStringBuilder instance.
+ */
+MyStringBuilder::Mode MyStringBuilder::getMode() const {
+    return mode;
+}
+
+/*
+ * Pre-Conditions:
+ *      MyStringBuilder instance is initialized.
+ *      Storage mode of the builder is kChain.
+ *
+ * Post-Conditions:
+ *      Counters of the Nodes made & released by the builder are returned.
+ *      A logic_error exception is thrown in any other mode.
+ *      No changes to `this`.
+ *
+ * Only the chain storage allocates Nodes from an arena.
+ * Returns the allocation counters of the Nodes of a chain builder.
+ */
+NodeArena::Counters MyStringBuilder::arenaCounters() const {
+    if (mode != Mode::kChain) {
+        throw logic_error("arenaCounters requires Mode::kChain");
+    }
+
+    return static_cast<const ChainStorage&>(readable()).getCounters();
+}
+
+/*
+ * Pre-Conditions:
+ *      const reference to the path of a regular file.
+ *      long long of the offset of the window (optional),
+ *      default is 0.
+ *      long long of the length of the window (optional),
+ *      default is up to the end of the file.
+ *
+ * Post-Conditions:
+ *      A piece table MyStringBuilder over the characters of the file
+ *      from the offset, as many as the length or up to the end,
+ *      is returned, in O(1) whatever the size of the file.
+ *      The file must not be changed by others while in use.
+ *      An invalid_argument exception is thrown if the offset or
+ *      the length is negative, or the offset is past the end.
+ *      A system_error exception is thrown if the file cannot be
+ *      opened or mapped.
+ *      A length_error exception is thrown if the window holds more
+ *      than INT_MAX characters.
+ *
+ * The mapped file is the original buffer of the piece table, edits go
+ * to its add buffer & substrings share the mapping, so the untouched
+ * characters are never copied & only the visited pages are read.
+ * Files past INT_MAX characters are opened window by window,
+ * saveTo writes the characters of the window only.
+ * Returns a MyStringBuilder over the characters of the given file,
+ * mapped instead of read.
+ */
+MyStringBuilder MyStringBuilder::fromFile(const string& path,
+                                          long long offset, long long length) {
+    auto file = make_shared<const MappedFile>(path, offset, length);
+
+    return MyStringBuilder(new PieceTableStorage(std::move(file)),
+                           Mode::kPieceTable);
+}
+
+/*
+ * Pre-Conditions:
+ *      MyStringBuilder instance is initialized.
+ *      const reference to the path of the file to write.
+ *
+ * Post-Conditions:
+ *      The file holds the characters of `this`, it is replaced
+ *      only once completely written & flushed to the disk.
+ *      A replaced file keeps its permissions, a new one gets those
+ *      allowed by the umask.
+ *      A system_error exception is thrown if the file cannot be
+ *      written, the file is then unchanged.
+ *      No changes to `this`.
+ *
+ * The characters are written by writeTo to a temporary file of a unique
+ * name, flushed, then renamed over the given one, so saving over the
+ * file `this` was opened from is safe, the mapping keeps the old file
+ * alive, & concurrent saves to the same path never mix their characters.
+ * Writes the characters of the MyStringBuilder to the given file.
+ */
+void MyStringBuilder::saveTo(const string& path) const {
+    struct stat target{};
+    const bool replacing = ::stat(path.c_str(), &target) == 0;
+    string temporary;
+    const int fd = openTemporary(path, temporary, 0666);
+
+    if (fd < 0) {
+        throw system_error(errno, generic_category(), "Cannot write " + path);
+    }
+
+    try {
+#ifdef MYSTRINGBUILDER_POSIX_IO
+        /* The umask applied to the new file must not narrow the old mode */
+        if (replacing and ::fchmod(fd, target.st_mode & 07777) < 0) {
+            throw system_error(errno, generic_category(),
+                               "Cannot keep the permissions of " + path);
+        }
+#else
+        (void) replacing;
+#endif
+
+        writeTo(fd);
+        syncFile(fd);
+    } catch (...) {
+        ::close(fd);
+        remove(temporary.c_str());
+        throw;
+    }
+
+    /* Some file systems only report write errors on close */
+    if (::close(fd) < 0 or rename(temporary.c_str(), path.c_str())) {
+        const int error = errno;
+
+        remove(temporary.c_str());
+        throw system_error(error, generic_category(), "Cannot write " + path);
+    }
+}
+
+/*
+ * Pre-Conditions:
+ *      MyStringBuilder instance is initialized.
+ *      int of a file descriptor open for writing.
+ *
+ * Post-Conditions:
+ *      The characters of `this` are written to the descriptor,
+ *      retrying partial writes.
+ *      A system_error exception is thrown if a write fails.
+ *      No changes to `this`, the descriptor is left open.
+ *
+ * The chunks are gathered as they are stored, without copying them,
+ * & written IOV_MAX at a time with writev, the untouched ranges of a
+ * mapped file straight from the mapping.
+ * Writes the characters of the MyStringBuilder to the given
+ * file descriptor.
+ */
+void MyStringBuilder::writeTo(int fd) const {
+    vector<iovec> batch;
+
+    readable().forEachChunk(0, length(), [&](const char *data, int count) {
+        batch.push_back(iovec{(void*) data, (size_t) count});
+
+        if ((int) batch.size() == IOV_MAX) {
+            writeBatch(fd, batch.data(), (int) batch.size());
+            batch.clear();
+        }
+
+        return true;
+    });
+
+    writeBatch(fd, batch.data(), (int) batch.size());
+}
+
+/*
+ * Pre-Conditions:
+ *      MyStringBuilder instance is initialized.
+ *      const reference to the path of the file to write,
+ *      not the file `this` was opened from with fromFile.
+ *
+ * Post-Conditions:
+ *      The file is created or truncated, then holds the
+ *      characters of `this`.
+ *      A system_error exception is thrown if the file cannot be
+ *      written.
+ *      No changes to `this`.
+ *
+ * Truncating the file `this` is mapped from would remove the
+ * characters being written, saveTo replaces it safely instead.
+ * Writes the characters of the MyStringBuilder to the given file,
+ * in place.
+ */
+void MyStringBuilder::writeTo(const string& path) const {
+    const int fd = ::open(path.c_str(),
+                          O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC | O_BINARY,
+                          0666);
+
+    if (fd < 0) {
+        throw system_error(errno, generic_category(), "Cannot open " + path);
+    }
+
+    try {
+        writeTo(fd);
+    } catch (...) {
+        ::close(fd);
+        throw;
+    }
+
+    /* Some file systems only report write errors on close */
+    if (::close(fd) < 0) {
+        throw system_error(errno, generic_category(), "Cannot write " + path);
+    }
+}
+
+/*
+ * Pre-Conditions:
+ *      MyStringBuilder instance is initialized.
+ *      int of a file descriptor open for reading.
+ *
+ * Post-Conditions:
+ *      The characters read from the descriptor until its end are
+ *      appended to `this`.
+ *      A system_error exception is thrown if a read fails,
+ *      a length_error exception if `this` would exceed INT_MAX
+ *      characters, the characters read before are kept.
+ *      The descriptor is left open.
+ *      A reference to `this` is returned.
+ *
+ * Reads up to kReadLength characters at a time. While the gap buffer
+ * & piece table modes have free room at the end of their buffer,
+ * see Storage::reserveTail, they read straight into it, otherwise
+ * the read goes to a temporary buffer appended as one insertion
+ * at the end, which grows the storage.
+ * Appends the characters read from the given file descriptor,
+ * until its end.
+ */
+MyStringBuilder& MyStringBuilder::readFrom(int fd) {
+    /* Only allocated if the storage has no writable tail */
+    string buffer{};
+
+    while (true) {
+        const int left = INT_MAX - length();
+        int room = left < kReadLength ? left : kReadLength;
+        char *tail = 0 < room ? editable().reserveTail(room) : nullptr;
+
+        if (not tail and buffer.empty()) {
+            buffer.resize(kReadLength);
+        }
+
+        const long long count = ::read(fd, tail ? tail : &buffer[0],
+                                       tail ? room : kReadLength);
+        const int error = errno;
+
+        if (tail) {
+            /* The unread part of the tail is given back */
+            storage->commitTail((int) max(0LL, count));
+        }
+
+        if (count < 0) {
+            if (error == EINTR) {
+                continue;
+            }
+
+            throw system_error(error, generic_category(),
+                               "Cannot read from descriptor "
+                               + to_string(fd));
+        } else if (count == 0) {
+            return *this;
+        } else if (tail) {
+            continue;
+        } else if (INT_MAX - length() < count) {
+            throw length_error("Reading from descriptor " + to_string(fd)
+                               + " exceeds " + to_string(INT_MAX)
+                               + " characters");
+        }
+
+        editable().insert(length(), buffer.data(), (int) count);
+    }
+}
+
+/*
+ * Pre-Conditions:
+ *      The string whose characters the Storage holds.
+ *      Mode of the Storage to create.
+ *
+ * Post-Conditions:
+ *      A heap allocated Storage of the given mode is returned.
+ *
+ * The gap buffer & the piece table adopt the buffer of the string,
+ * so a string moved into the constructor is never copied.
+ * Returns a new Storage of the given mode holding
+ * the characters of the given string.
+ */
+Storage* MyStringBuilder::makeStorage(string s, Mode mode) {
+    switch (mode) {
+        case Mode::kChain:
+            return new ChainStorage(s.data(), (int) s.size());
+        case Mode::kGapBuffer:
+            return new GapBufferStorage(std::move(s));
+        case Mode::kPieceTable:
+            return new PieceTableStorage(std::move(s));
+        case Mode::kRope:
+        default:
+            return new RopeStorage(s.data(), (int) s.size());
+    }
+}
+
+/*
+ * Pre-Conditions:
+ *      MyStringBuilder instance is initialized.
+ *      An int of the index to check.
+ *
+ * Post-Conditions:
+ *      A invalid_argument exception is thrown if the
+ *      index is invalid.
+ *      No changes to `this`.
+ *
+ * Checks if the given index is valid (between 0 and size inclusive).
+ * If invalid, an invalid_argument exception is raised.
+ */
+void MyStringBuilder::checkIndex(int index) const {
+    if (index < 0 or length() < index) {
+        throwIndexException(index, length());
+    }
+}
+
+/*
+ * Pre-Conditions:
+ *      MyStringBuilder instance is initialized.
+ *
+ * Post-Conditions:
+ *      const reference to the Storage of `this` is returned.
+ *      No changes to `this`.
+ *
+ * A moved-from instance has no storage, it reads an empty Storage of its
+ * mode, made once & shared by all of them. Empty reads never touch the
+ * cached index of a Storage, so the sharing is safe across threads.
+ * Returns the Storage of the characters, for reading.
+ */
+const Storage& MyStringBuilder::readable() const {
+    if (storage) {
+        return *storage;
+    }
+
+    /* Never released, moved-from instances may outlive static destructors */
+    static const Storage *const kEmpty[] = {
+            makeStorage("", Mode::kRope),
+            makeStorage("", Mode::kChain),
+            makeStorage("", Mode::kGapBuffer),
+            makeStorage("", Mode::kPieceTable),
+    };
+
+    return *kEmpty[(int) mode];
+}
+
+/*
+ * Pre-Conditions:
+ *      MyStringBuilder instance is initialized.
+ *
+ * Post-Conditions:
+ *      Reference to the Storage of `this` is returned.
+ *      A moved-from instance gets a new empty Storage of its mode first.
+ *
+ * Moves leave the given instance without a storage so they never
+ * allocate, the first edit after pays for it instead.
+ * Returns the Storage of the characters, for editing.
+ */
+Storage& MyStringBuilder::editable() {
+    if (not storage) {
+        storage = makeStorage("", mode);
+    }
+
+    return *storage;
 }
@@ -12,34 +12,138 @@
  *              based on the Java StringBuilder class.
  *
  * List of public Functions:
- *      MyStringBuilder(std::string)
+ *      MyStringBuilder(std::string, Mode mode = Mode::kRope)
  *          Parameterized constructor of the MyStringBuilder class.
  *
+ *      MyStringBuilder(const MyStringBuilder&)
+ *          Copy constructor of the MyStringBuilder class.
+ *
+ *      MyStringBuilder& operator=(const MyStringBuilder&)
+ *          Assignment operator for the MyStringBuilder class.
+ *
+ *      MyStringBuilder(MyStringBuilder&&) noexcept
+ *          Move constructor of the MyStringBuilder class.
+ *
+ *      MyStringBuilder& operator=(MyStringBuilder&&) noexcept
+ *          Move assignment operator for the MyStringBuilder class.
+ *
+ *      ~MyStringBuilder()
+ *          Destructor for the MyStringBuilder class.
+ *
  *      MyStringBuilder& insert(int, const MyStringBuilder&)
  *          Inserts a copy of the given MyStringBuilder into the given position.
  *
+ *      MyStringBuilder& insert(int, MyStringBuilder&&)
+ *          Moves the characters of the given MyStringBuilder into the
+ *          given position.
+ *
+ *      MyStringBuilder& insert(int, std::string_view)
+ *          Inserts a copy of the given characters into the given position.
+ *
  *      MyStringBuilder& append(const MyStringBuilder&)
  *          Inserts a copy of the given MyStringBuilder instance
  *          into the end of `this` MyStringBuilder.
  *
+ *      MyStringBuilder& append(MyStringBuilder&&)
+ *          Moves the characters of the given MyStringBuilder instance
+ *          into the end of `this` MyStringBuilder.
+ *
  *      MyStringBuilder& append(int)
  *          Inserts a copy of the given int into the end
  *          of `this` MyStringBuilder.
  *
+ *      MyStringBuilder& append(unsigned)
+ *          Inserts the decimal digits of the given unsigned int into the end
+ *          of `this` MyStringBuilder.
+ *
+ *      MyStringBuilder& append(long)
+ *          Inserts the decimal digits of the given long into the end
+ *          of `this` MyStringBuilder.
+ *
+ *      MyStringBuilder& append(unsigned long)
+ *          Inserts the decimal digits of the given unsigned long into the end
+ *          of `this` MyStringBuilder.
+ *
+ *      MyStringBuilder& append(long long)
+ *          Inserts the decimal digits of the given long long into the end
+ *          of `this` MyStringBuilder.
+ *
+ *      MyStringBuilder& append(unsigned long long)
+ *          Inserts the decimal digits of the given unsigned long long into the end
+ *          of `this` MyStringBuilder.
+ *
+ *      MyStringBuilder& append(double)
+ *          Inserts the shortest decimal form of the given double into the end
+ *          of `this` MyStringBuilder.
+ *
+ *      MyStringBuilder& append(float)
+ *          Inserts the shortest decimal form of the given float into the end
+ *          of `this` MyStringBuilder.
+ *
+ *      MyStringBuilder& append(char)
+ *          Inserts the given character into the end of `this` MyStringBuilder.
+ *
+ *      MyStringBuilder& append(bool)
+ *          Inserts "true" or "false" into the end of `this` MyStringBuilder.
+ *
+ *      MyStringBuilder& append(std::string_view)
+ *          Inserts a copy of the given characters into the end
+ *          of `this` MyStringBuilder.
+ *
+ *      MyStringBuilder& append(const char*)
+ *          Inserts a copy of the given null-terminated string into the end
+ *          of `this` MyStringBuilder.
+ *
  *      MyStringBuilder& replace(int begin, int end, const MyStringBuilder&)
  *          Replaces the substring from begin (inclusive) to
  *          end (exclusive) by a copy of the given MyStringBuilder instance.
  *
+ *      MyStringBuilder& replace(int begin, int end, std::string_view)
+ *          Replaces the substring from begin (inclusive) to
+ *          end (exclusive) by a copy of the given characters.
+ *
+ *      MyStringBuilder& apply(const EditBatch&)
+ *          Applies all the edits of the given EditBatch at once.
+ *
+ *      MyStringBuilder& replaceAll(const std::string&, const std::string&)
+ *          Replaces every occurrence of the target by the replacement.
+ *
+ *      MyStringBuilder& replaceFirst(const std::string&, const std::string&,
+ *                                    int count = 1)
+ *          Replaces the first count occurrences of the target
+ *          by the replacement.
+ *
  *      MyStringBuilder& toUpperCase()
  *          Changes all the characters in the MyStringBuilder instance to
  *          upper case.
  *
+ *      MyStringBuilder& toLowerCase()
+ *          Changes all the characters in the MyStringBuilder instance to
+ *          lower case.
+ *
+ *      MyStringBuilder& swapCase()
+ *          Swaps the case of all the characters in the MyStringBuilder
+ *          instance.
+ *
+ *      MyStringBuilder& transform(const ByteTable&)
+ *          Replaces each character of the MyStringBuilder instance by its
+ *          entry in the given table.
+ *
  *      int length() const
  *          Returns the number of characters in the MyStringBuilder instance.
  *
  *      char charAt(int) const
  *          Returns the character at the given index in MyStringBuilder instance.
  *
+ *      const_iterator begin() const
+ *          Returns an iterator at the first character.
+ *
+ *      const_iterator end() const
+ *          Returns an iterator past the last character.
+ *
+ *      bool forEachChunk(const Storage::ChunkVisitor&) const
+ *          Calls the visitor with each run of characters, in order.
+ *
  *      MyStringBuilder substring(int begin, int end)
  *          Returns a new MyStringBuilder instance from the characters between
  *          begin (inclusive) & end (exclusive).
@@ -48,27 +152,82 @@
  *          Returns a new MyStringBuilder instance from the characters starting
  *          from begin (inclusive) to the end of the MyStringBuilder.
  *
+ *      int indexOf(const std::string&, int fromIndex = 0) const
+ *          Returns the position of the first occurrence of the given string,
+ *          starting the search at fromIndex.
+ *
+ *      int lastIndexOf(const std::string&) const
+ *          Returns the position of the last occurrence of the given string.
+ *
+ *      int lastIndexOf(const std::string&, int fromIndex) const
+ *          Returns the position of the last occurrence of the given string,
+ *          starting at or before fromIndex.
+ *
+ *      bool contains(const std::string&) const
+ *          Returns true if the given string occurs in the MyStringBuilder.
+ *
+ *      bool startsWith(const std::string&) const
+ *          Returns true if the MyStringBuilder starts with the given string.
+ *
+ *      bool endsWith(const std::string&) const
+ *          Returns true if the MyStringBuilder ends with the given string.
+ *
  *      std::string toString() const
  *          Returns a string of the characters stored in the MyStringBuilder
  *          instance.
  *
+ *      std::string toString(int begin, int end) const
+ *          Returns a string of the characters between begin & end.
+ *
  *      void clear(int begin, int end)
  *          Makes the range in the MyStringBuilder empty.
  *
+ *      Mode getMode() const
+ *          Returns the storage mode of the MyStringBuilder instance.
+ *
+ *      NodeArena::Counters arenaCounters() const
+ *          Returns the allocation counters of the Nodes of a chain builder.
+ *
+ *      static MyStringBuilder fromFile(const std::string&,
+ *                                      long long offset = 0,
+ *                                      long long length = LLONG_MAX)
+ *          Returns a MyStringBuilder over the characters of the given file,
+ *          mapped instead of read.
+ *
+ *      void saveTo(const std::string&) const
+ *          Writes the characters of the MyStringBuilder to the given file.
+ *
+ *      void writeTo(int) const
+ *          Writes the characters of the MyStringBuilder to the given
+ *          file descriptor.
+ *
+ *      void writeTo(const std::string&) const
+ *          Writes the characters of the MyStringBuilder to the given file,
+ *          in place.
+ *
+ *      MyStringBuilder& readFrom(int)
+ *          Appends the characters read from the given file descriptor,
+ *          until its end.
+ *
  * List of private Functions:
- *      MyStringBuilder(NodePtr, int)
+ *      MyStringBuilder(Storage*, Mode)
  *          Parameterized constructor of the MyStringBuilder class.
- *          Takes a Node pointer & a size parameter.
+ *          Takes a Storage pointer & its mode.
  *
- *      NodePtr* copyChain(int start = 0, int end = 0) const
- *          Returns a Node double pointer to the beginning of a Node chain
- *          that has the copies of characters of `this` MyStringBuilder instance
- *          from the given start (inclusive) to the given end (exclusive).
+ *      static Storage* makeStorage(std::string, Mode)
+ *          Returns a new Storage of the given mode holding
+ *          the characters of the given string.
  *
  *     void checkIndex(int) const
  *          Checks if the given index is valid (between 0 and size inclusive).
  *          If invalid, an invalid_argument exception is raised.
  *
+ *      const Storage& readable() const
+ *          Returns the Storage of the characters, for reading.
+ *
+ *      Storage& editable()
+ *          Returns the Storage of the characters, for editing.
+ *
  * List of global Functions:
  *      std::ostream& operator<<(std::ostream&, const MyStringBuilder&)
  *          Displays the string representation of the given MyStringBuilder
@@ -78,35 +237,143 @@
 #ifndef MYSTRINGBUILDER_MYSTRINGBUILDER_H
 #define MYSTRINGBUILDER_MYSTRINGBUILDER_H
 
+#include <climits>
 #include <exception>
 #include <iostream>
 #include <string>
+#include <string_view>
 
-#include "Node.h"
+#include "ByteTransform.h"
+#include "CharIterator.h"
+#include "EditBatch.h"
+#include "NodeArena.h"
+#include "Storage.h"
 
 /*
  * MyStringBuilder class mimics Java's StringBuilder class.
+ *
+ * The const functions keep no caches in any mode,
+ * so they may be called from many threads at once,
+ * as long as no thread changes the MyStringBuilder meanwhile.
+ * Changes need a lock or a ConcurrentBuilder / SharedBuilder.
  */
 class MyStringBuilder {
 public:
     /*
-     * Type alias for Node*.
-     * Can be accessed outside the class using MyStringBuilder::NodePtr.
+     * Storage engines a MyStringBuilder can be backed by.
+     * Can be accessed outside the class using MyStringBuilder::Mode.
+     *
+     *      kRope:      Balanced tree of character leaves,
+     *                  O(log n) positional operations.
+     *
+     *      kChain:     Linked list of Nodes holding character blocks,
+     *                  indexed for O(log n) positional lookups.
+     *
+     *      kGapBuffer: Contiguous buffer with a movable gap,
+     *                  amortized O(1) edits near the previous edit
+     *                  & O(1) charAt.
+     *
+     *      kPieceTable: Immutable original buffer & append-only add buffer
+     *                   described by pieces, edits split pieces
+     *                   without copying characters.
+     */
+    enum class Mode {
+        kRope,
+        kChain,
+        kGapBuffer,
+        kPieceTable,
+    };
+
+    /* Characters requested per read by readFrom */
+    static const int kReadLength = 1 << 20;
+
+    /*
+     * Forward iterators over the characters, read-only.
+     * Invalidated by any change to the MyStringBuilder.
      */
-    typedef Node* NodePtr;
+    typedef CharIterator const_iterator;
+    typedef CharIterator iterator;
 
     /*
      * Pre-Conditions:
      *      A string whose characters are copied is given.
+     *      Storage mode (optional), default is Mode::kRope.
      *
      * Post-Conditions:
      *      A MyStringBuilder instance is created.
-     *      first is a Node* or nullptr.
-     *      size is equal to the size of the string.
+     *      storage holds the characters of the string.
+     *      mode is the given mode.
      *
+     * A string moved in is adopted without copying by the
+     * gap buffer & piece table modes.
      * Parameterized constructor of the MyStringBuilder class.
      */
-    explicit MyStringBuilder(std::string);
+    explicit MyStringBuilder(std::string, Mode mode = Mode::kRope);
+
+    /*
+     * Pre-Conditions:
+     *      const reference to a MyStringBuilder instance to copy.
+     *
+     * Post-Conditions:
+     *      A MyStringBuilder instance is created,
+     *      holding a copy of the characters of the given instance.
+     *      mode is the mode of the given instance.
+     *
+     * Copy constructor of the MyStringBuilder class.
+     */
+    MyStringBuilder(const MyStringBuilder&);
+
+    /*
+     * Pre-Conditions:
+     *      `this` & the given MyStringBuilder instances are initialized.
+     *
+     * Post-Conditions:
+     *      `this` holds a copy of the characters of the given instance.
+     *      mode is the mode of the given instance.
+     *      Returns a reference to `this`.
+     *
+     * Assignment operator for the MyStringBuilder class.
+     */
+    MyStringBuilder& operator=(const MyStringBuilder&);
+
+    /*
+     * Pre-Conditions:
+     *      rvalue reference to a MyStringBuilder instance to move.
+     *
+     * Post-Conditions:
+     *      A MyStringBuilder instance is created,
+     *      holding the storage of the given instance.
+     *      mode is the mode of the given instance.
+     *      The given instance is empty, with the same mode.
+     *
+     * Move constructor of the MyStringBuilder class.
+     */
+    MyStringBuilder(MyStringBuilder&&) noexcept;
+
+    /*
+     * Pre-Conditions:
+     *      `this` & the given MyStringBuilder instances are initialized.
+     *
+     * Post-Conditions:
+     *      `this` holds the storage of the given instance.
+     *      mode is the mode of the given instance.
+     *      The given instance is empty, with the same mode.
+     *      Returns a reference to `this`.
+     *
+     * Move assignment operator for the MyStringBuilder class.
+     */
+    MyStringBuilder& operator=(MyStringBuilder&&) noexcept;
+
+    /*
+     * Pre-Conditions:
+     *      `this` MyStringBuilder instance is not destroyed.
+     *
+     * Post-Conditions:
+     *      `this` MyStringBuilder instance & its storage are destroyed.
+     *
+     * Destructor for the MyStringBuilder class.
+     */
+    ~MyStringBuilder();
 
     /*
      * Pre-Conditions:
@@ -123,6 +390,39 @@ public:
      */
     MyStringBuilder& insert(int, const MyStringBuilder&);
 
+    /*
+     * Pre-Conditions:
+     *      MyStringBuilder instance is initialized.
+     *      int position of the insertion, must be valid.
+     *      rvalue reference to a MyStringBuilder instance to insert.
+     *
+     * Post-Conditions:
+     *      The characters of the given
+     *      MyStringBuilder are inserted at the given position.
+     *      The given MyStringBuilder is empty.
+     *      A reference to `this` is returned.
+     *
+     * Moves the characters of the given MyStringBuilder into the
+     * given position.
+     */
+    MyStringBuilder& insert(int, MyStringBuilder&&);
+
+    /*
+     * Pre-Conditions:
+     *      MyStringBuilder instance is initialized.
+     *      int position of the insertion, must be valid.
+     *      string_view of the characters to insert, not viewing
+     *      the characters of `this`.
+     *
+     * Post-Conditions:
+     *      The characters of the given string_view are inserted
+     *      at the given position.
+     *      A reference to `this` is returned.
+     *
+     * Inserts a copy of the given characters into the given position.
+     */
+    MyStringBuilder& insert(int, std::string_view);
+
     /*
      * Pre-Conditions:
      *      MyStringBuilder instance is initialized.
@@ -139,6 +439,23 @@ public:
      */
     MyStringBuilder& append(const MyStringBuilder&);
 
+    /*
+     * Pre-Conditions:
+     *      MyStringBuilder instance is initialized.
+     *      rvalue reference to a MyStringBuilder instance to insert
+     *      at the end of `this` MyStringBuilder instance.
+     *
+     * Post-Conditions:
+     *      The characters of the given MyStringBuilder instance
+     *      are inserted at the end of `this`.
+     *      The given MyStringBuilder is empty.
+     *      A reference to `this` is returned.
+     *
+     * Moves the characters of the given MyStringBuilder instance
+     * into the end of `this` MyStringBuilder.
+     */
+    MyStringBuilder& append(MyStringBuilder&&);
+
     /*
      * Pre-Conditions:
      *      MyStringBuilder instance is initialized.
@@ -153,6 +470,169 @@ public:
      */
     MyStringBuilder& append(int);
 
+    /*
+     * Pre-Conditions:
+     *      MyStringBuilder instance is initialized.
+     *      unsigned int to append to the MyStringBuilder.
+     *
+     * Post-Conditions:
+     *      The decimal digits of the given unsigned int are inserted at
+     *      the end of `this`.
+     *      A reference to `this` is returned.
+     *
+     * Inserts the decimal digits of the given unsigned int into the end
+     * of `this` MyStringBuilder.
+     */
+    MyStringBuilder& append(unsigned);
+
+    /*
+     * Pre-Conditions:
+     *      MyStringBuilder instance is initialized.
+     *      long to append to the MyStringBuilder.
+     *
+     * Post-Conditions:
+     *      The decimal digits of the given long are inserted at
+     *      the end of `this`.
+     *      A reference to `this` is returned.
+     *
+     * Inserts the decimal digits of the given long into the end
+     * of `this` MyStringBuilder.
+     */
+    MyStringBuilder& append(long);
+
+    /*
+     * Pre-Conditions:
+     *      MyStringBuilder instance is initialized.
+     *      unsigned long to append to the MyStringBuilder.
+     *
+     * Post-Conditions:
+     *      The decimal digits of the given unsigned long are inserted at
+     *      the end of `this`.
+     *      A reference to `this` is returned.
+     *
+     * Inserts the decimal digits of the given unsigned long into the end
+     * of `this` MyStringBuilder.
+     */
+    MyStringBuilder& append(unsigned long);
+
+    /*
+     * Pre-Conditions:
+     *      MyStringBuilder instance is initialized.
+     *      long long to append to the MyStringBuilder.
+     *
+     * Post-Conditions:
+     *      The decimal digits of the given long long are inserted at
+     *      the end of `this`.
+     *      A reference to `this` is returned.
+     *
+     * Inserts the decimal digits of the given long long into the end
+     * of `this` MyStringBuilder.
+     */
+    MyStringBuilder& append(long long);
+
+    /*
+     * Pre-Conditions:
+     *      MyStringBuilder instance is initialized.
+     *      unsigned long long to append to the MyStringBuilder.
+     *
+     * Post-Conditions:
+     *      The decimal digits of the given unsigned long long are inserted at
+     *      the end of `this`.
+     *      A reference to `this` is returned.
+     *
+     * Inserts the decimal digits of the given unsigned long long into the end
+     * of `this` MyStringBuilder.
+     */
+    MyStringBuilder& append(unsigned long long);
+
+    /*
+     * Pre-Conditions:
+     *      MyStringBuilder instance is initialized.
+     *      double to append to the MyStringBuilder.
+     *
+     * Post-Conditions:
+     *      The shortest decimal form that reads back as the same double
+     *      is inserted at the end of `this`, "inf" & "nan" for the
+     *      special values.
+     *      A reference to `this` is returned.
+     *
+     * Inserts the shortest decimal form of the given double into the end
+     * of `this` MyStringBuilder.
+     */
+    MyStringBuilder& append(double);
+
+    /*
+     * Pre-Conditions:
+     *      MyStringBuilder instance is initialized.
+     *      float to append to the MyStringBuilder.
+     *
+     * Post-Conditions:
+     *      The shortest decimal form that reads back as the same float
+     *      is inserted at the end of `this`, "inf" & "nan" for the
+     *      special values.
+     *      A reference to `this` is returned.
+     *
+     * Inserts the shortest decimal form of the given float into the end
+     * of `this` MyStringBuilder.
+     */
+    MyStringBuilder& append(float);
+
+    /*
+     * Pre-Conditions:
+     *      MyStringBuilder instance is initialized.
+     *      char to append to the MyStringBuilder.
+     *
+     * Post-Conditions:
+     *      The given character is inserted at the end of `this`.
+     *      A reference to `this` is returned.
+     *
+     * Inserts the given character into the end of `this` MyStringBuilder.
+     */
+    MyStringBuilder& append(char);
+
+    /*
+     * Pre-Conditions:
+     *      MyStringBuilder instance is initialized.
+     *      bool to append to the MyStringBuilder.
+     *
+     * Post-Conditions:
+     *      "true" or "false" is inserted at the end of `this`.
+     *      A reference to `this` is returned.
+     *
+     * Inserts "true" or "false" into the end of `this` MyStringBuilder.
+     */
+    MyStringBuilder& append(bool);
+
+    /*
+     * Pre-Conditions:
+     *      MyStringBuilder instance is initialized.
+     *      string_view of the characters to append.
+     *
+     * Post-Conditions:
+     *      The characters of the given string_view are inserted at
+     *      the end of `this`.
+     *      A reference to `this` is returned.
+     *
+     * Inserts a copy of the given characters into the end
+     * of `this` MyStringBuilder.
+     */
+    MyStringBuilder& append(std::string_view);
+
+    /*
+     * Pre-Conditions:
+     *      MyStringBuilder instance is initialized.
+     *      Pointer to a null-terminated string, or nullptr.
+     *
+     * Post-Conditions:
+     *      The characters of the given string are inserted at
+     *      the end of `this`, "null" for nullptr.
+     *      A reference to `this` is returned.
+     *
+     * Inserts a copy of the given null-terminated string into the end
+     * of `this` MyStringBuilder.
+     */
+    MyStringBuilder& append(const char*);
+
     /*
      * Pre-Conditions:
      *      MyStringBuilder instance is initialized.
@@ -170,6 +650,81 @@ public:
     MyStringBuilder& replace(int /* begin */, int /* end */,
                              const MyStringBuilder&);
 
+    /*
+     * Pre-Conditions:
+     *      MyStringBuilder instance is initialized.
+     *      begin & end are valid indices.
+     *      end is greater than or equal to begin.
+     *      string_view of the replacement characters, not viewing
+     *      the characters of `this`.
+     *
+     * Post-Conditions:
+     *      The characters between begin (inclusive) & end (exclusive)
+     *      are replaced with the given characters.
+     *      A reference to `this` is returned.
+     *
+     * Replaces the substring from begin (inclusive) to
+     * end (exclusive) by a copy of the given characters.
+     */
+    MyStringBuilder& replace(int /* begin */, int /* end */, std::string_view);
+
+    /*
+     * Pre-Conditions:
+     *      MyStringBuilder instance is initialized.
+     *      const reference to an EditBatch, its positions are in the
+     *      current characters of `this`.
+     *
+     * Post-Conditions:
+     *      All the edits of the batch are applied, with the result of
+     *      applying them one by one.
+     *      An invalid_argument exception is thrown, with `this`
+     *      unchanged, if an edit ends past length() or two removed
+     *      ranges overlap.
+     *      A reference to `this` is returned.
+     *
+     * Applies all the edits of the given EditBatch at once.
+     */
+    MyStringBuilder& apply(const EditBatch&);
+
+    /*
+     * Pre-Conditions:
+     *      MyStringBuilder instance is initialized.
+     *      const reference to the target string.
+     *      const reference to the replacement string.
+     *
+     * Post-Conditions:
+     *      Every non-overlapping occurrence of the target, from left to
+     *      right, is replaced by the replacement.
+     *      Like Java, an empty target matches before each character &
+     *      at the end.
+     *      A reference to `this` is returned.
+     *
+     * Replaces every occurrence of the target by the replacement.
+     */
+    MyStringBuilder& replaceAll(const std::string& /* target */,
+                                const std::string& /* replacement */);
+
+    /*
+     * Pre-Conditions:
+     *      MyStringBuilder instance is initialized.
+     *      const reference to the target string.
+     *      const reference to the replacement string.
+     *      int of the most occurrences to replace (optional),
+     *      default is 1, must be at least 0.
+     *
+     * Post-Conditions:
+     *      The first count non-overlapping occurrences of the target,
+     *      from left to right, are replaced by the replacement.
+     *      An invalid_argument exception is thrown if count is negative.
+     *      A reference to `this` is returned.
+     *
+     * Replaces the first count occurrences of the target
+     * by the replacement.
+     */
+    MyStringBuilder& replaceFirst(const std::string& /* target */,
+                                  const std::string& /* replacement */,
+                                  int count = 1);
+
     /*
      * Pre-Conditions:
      *      MyStringBuilder instance is initialized.
@@ -183,6 +738,49 @@ public:
      */
     MyStringBuilder& toUpperCase();
 
+    /*
+     * Pre-Conditions:
+     *      MyStringBuilder instance is initialized.
+     *
+     * Post-Conditions:
+     *      The characters in `this` MyStringBuilder are all in lower case.
+     *      A reference to `this` is returned.
+     *
+     * Changes all the characters in the MyStringBuilder instance to
+     * lower case.
+     */
+    MyStringBuilder& toLowerCase();
+
+    /*
+     * Pre-Conditions:
+     *      MyStringBuilder instance is initialized.
+     *
+     * Post-Conditions:
+     *      Upper case characters in `this` are in lower case,
+     *      & lower case characters are in upper case.
+     *      A reference to `this` is returned.
+     *
+     * Swaps the case of all the characters in the MyStringBuilder
+     * instance.
+     */
+    MyStringBuilder& swapCase();
+
+    /*
+     * Pre-Conditions:
+     *      MyStringBuilder instance is initialized.
+     *      const reference to a table of 256 replacements,
+     *      indexed by the characters as unsigned char.
+     *
+     * Post-Conditions:
+     *      Each character c of `this` is replaced by
+     *      table[(unsigned char) c].
+     *      A reference to `this` is returned.
+     *
+     * Replaces each character of the MyStringBuilder instance by its
+     * entry in the given table.
+     */
+    MyStringBuilder& transform(const ByteTable&);
+
     /*
      * Pre-Conditions:
      *      MyStringBuilder instance is initialized.
@@ -208,6 +806,46 @@ public:
      */
     [[nodiscard]] char charAt(int) const;
 
+    /*
+     * Pre-Conditions:
+     *      MyStringBuilder instance is initialized.
+     *
+     * Post-Conditions:
+     *      An iterator at the first character is returned,
+     *      equal to end() if `this` is empty.
+     *      No changes to `this`.
+     *
+     * Returns an iterator at the first character.
+     */
+    [[nodiscard]] const_iterator begin() const;
+
+    /*
+     * Pre-Conditions:
+     *      MyStringBuilder instance is initialized.
+     *
+     * Post-Conditions:
+     *      An iterator past the last character is returned.
+     *      No changes to `this`.
+     *
+     * Returns an iterator past the last character.
+     */
+    [[nodiscard]] const_iterator end() const;
+
+    /*
+     * Pre-Conditions:
+     *      MyStringBuilder instance is initialized.
+     *      const reference to a ChunkVisitor, not changing `this`.
+     *
+     * Post-Conditions:
+     *      The visitor is called with each run of characters, in order,
+     *      until it returns false.
+     *      Returns false if the visitor stopped the visit.
+     *      No changes to `this`.
+     *
+     * Calls the visitor with each run of characters, in order.
+     */
+    bool forEachChunk(const Storage::ChunkVisitor&) const;
+
     /*
      * Pre-Conditions:
      *      MyStringBuilder instance is initialized.
@@ -242,6 +880,95 @@ public:
      */
     [[nodiscard]] MyStringBuilder substring(int /* begin */) const;
 
+    /*
+     * Pre-Conditions:
+     *      MyStringBuilder instance is initialized.
+     *      const reference to the string to search for.
+     *      int of the position to start from (optional), default is 0.
+     *
+     * Post-Conditions:
+     *      The position of the first occurrence starting at or after
+     *      fromIndex is returned, -1 if there is none.
+     *      No changes to `this`.
+     *
+     * Like Java, fromIndex is clamped to [0, length()].
+     * Returns the position of the first occurrence of the given string,
+     * starting the search at fromIndex.
+     */
+    [[nodiscard]] int indexOf(const std::string&, int fromIndex = 0) const;
+
+    /*
+     * Pre-Conditions:
+     *      MyStringBuilder instance is initialized.
+     *      const reference to the string to search for.
+     *
+     * Post-Conditions:
+     *      The position of the last occurrence is returned,
+     *      -1 if there is none.
+     *      No changes to `this`.
+     *
+     * Returns the position of the last occurrence of the given string.
+     */
+    [[nodiscard]] int lastIndexOf(const std::string&) const;
+
+    /*
+     * Pre-Conditions:
+     *      MyStringBuilder instance is initialized.
+     *      const reference to the string to search for.
+     *      int of the last position a match may start at.
+     *
+     * Post-Conditions:
+     *      The position of the last occurrence starting at or before
+     *      fromIndex is returned, -1 if there is none.
+     *      No changes to `this`.
+     *
+     * Like Java, a negative fromIndex finds nothing.
+     * Returns the position of the last occurrence of the given string,
+     * starting at or before fromIndex.
+     */
+    [[nodiscard]] int lastIndexOf(const std::string&, int fromIndex) const;
+
+    /*
+     * Pre-Conditions:
+     *      MyStringBuilder instance is initialized.
+     *      const reference to the string to search for.
+     *
+     * Post-Conditions:
+     *      Returns true if the string occurs in `this`.
+     *      No changes to `this`.
+     *
+     * Returns true if the given string occurs in the MyStringBuilder.
+     */
+    [[nodiscard]] bool contains(const std::string&) const;
+
+    /*
+     * Pre-Conditions:
+     *      MyStringBuilder instance is initialized.
+     *      const reference to the prefix to compare with.
+     *
+     * Post-Conditions:
+     *      Returns true if the first characters of `this` are equal to
+     *      the given string.
+     *      No changes to `this`.
+     *
+     * Returns true if the MyStringBuilder starts with the given string.
+     */
+    [[nodiscard]] bool startsWith(const std::string&) const;
+
+    /*
+     * Pre-Conditions:
+     *      MyStringBuilder instance is initialized.
+     *      const reference to the suffix to compare with.
+     *
+     * Post-Conditions:
+     *      Returns true if the last characters of `this` are equal to
+     *      the given string.
+     *      No changes to `this`.
+     *
+     * Returns true if the MyStringBuilder ends with the given string.
+     */
+    [[nodiscard]] bool endsWith(const std::string&) const;
+
     /*
      * Pre-Conditions:
      *      MyStringBuilder instance is initialized.
@@ -255,6 +982,20 @@ public:
      */
     [[nodiscard]] std::string toString() const;
 
+    /*
+     * Pre-Conditions:
+     *      MyStringBuilder instance is initialized.
+     *      begin & end are valid indices, begin <= end.
+     *
+     * Post-Conditions:
+     *      A string of the characters between begin (inclusive)
+     *      & end (exclusive) is returned.
+     *      No changes to `this`.
+     *
+     * Returns a string of the characters between begin & end.
+     */
+    [[nodiscard]] std::string toString(int /* begin */, int /* end */) const;
+
     /*
      * Pre-Conditions:
      *      begin & end valid indices range to clear.
@@ -262,47 +1003,174 @@ public:
      *
      * Post-Conditions:
      *      The MyStringBuilder is empty from begin to end.
-     *      first is nullptr.
-     *      size is 0.
+     *      length() is reduced by end - begin.
      *
      * Makes the range in the MyStringBuilder empty.
      */
     void clear(int /* begin */, int /* end */);
 
+    /*
+     * Pre-Conditions:
+     *      MyStringBuilder instance is initialized.
+     *
+     * Post-Conditions:
+     *      Storage mode of the builder is returned.
+     *      No changes to `this`.
+     *
+     * Returns the storage mode of the MyStringBuilder instance.
+     */
+    [[nodiscard]] Mode getMode() const;
+
+    /*
+     * Pre-Conditions:
+     *      MyStringBuilder instance is initialized.
+     *      Storage mode of the builder is kChain.
+     *
+     * Post-Conditions:
+     *      Counters of the Nodes made & released by the builder are returned.
+     *      A logic_error exception is thrown in any other mode.
+     *      No changes to `this`.
+     *
+     * Returns the allocation counters of the Nodes of a chain builder.
+     */
+    [[nodiscard]] NodeArena::Counters arenaCounters() const;
+
+    /*
+     * Pre-Conditions:
+     *      const reference to the path of a regular file.
+     *      long long of the offset of the window (optional),
+     *      default is 0.
+     *      long long of the length of the window (optional),
+     *      default is up to the end of the file.
+     *
+     * Post-Conditions:
+     *      A piece table MyStringBuilder over the characters of the file
+     *      from the offset, as many as the length or up to the end,
+     *      is returned, in O(1) whatever the size of the file.
+     *      The file must not be changed by others while in use.
+     *      An invalid_argument exception is thrown if the offset or
+     *      the length is negative, or the offset is past the end.
+     *      A system_error exception is thrown if the file cannot be
+     *      opened or mapped.
+     *      A length_error exception is thrown if the window holds more
+     *      than INT_MAX characters.
+     *
+     * Files past INT_MAX characters are opened window by window,
+     * saveTo writes the characters of the window only.
+     * Returns a MyStringBuilder over the characters of the given file,
+     * mapped instead of read.
+     */
+    [[nodiscard]] static MyStringBuilder fromFile(const std::string&,
+                                                  long long offset = 0,
+                                                  long long length = LLONG_MAX);
+
+    /*
+     * Pre-Conditions:
+     *      MyStringBuilder instance is initialized.
+     *      const reference to the path of the file to write.
+     *
+     * Post-Conditions:
+     *      The file holds the characters of `this`, it is replaced
+     *      only once completely written & flushed to the disk.
+     *      A replaced file keeps its permissions, a new one gets those
+     *      allowed by the umask.
+     *      A system_error exception is thrown if the file cannot be
+     *      written, the file is then unchanged.
+     *      No changes to `this`.
+     *
+     * Safe to call from several threads or processes on the same path,
+     * the last rename wins.
+     * Writes the characters of the MyStringBuilder to the given file.
+     */
+    void saveTo(const std::string&) const;
+
+    /*
+     * Pre-Conditions:
+     *      MyStringBuilder instance is initialized.
+     *      int of a file descriptor open for writing.
+     *
+     * Post-Conditions:
+     *      The characters of `this` are written to the descriptor,
+     *      retrying partial writes.
+     *      A system_error exception is thrown if a write fails.
+     *      No changes to `this`, the descriptor is left open.
+     *
+     * Writes the characters of the MyStringBuilder to the given
+     * file descriptor.
+     */
+    void writeTo(int) const;
+
+    /*
+     * Pre-Conditions:
+     *      MyStringBuilder instance is initialized.
+     *      const reference to the path of the file to write,
+     *      not the file `this` was opened from with fromFile.
+     *
+     * Post-Conditions:
+     *      The file is created or truncated, then holds the
+     *      characters of `this`.
+     *      A system_error exception is thrown if the file cannot be
+     *      written.
+     *      No changes to `this`.
+     *
+     * Writes the characters of the MyStringBuilder to the given file,
+     * in place.
+     */
+    void writeTo(const std::string&) const;
+
+    /*
+     * Pre-Conditions:
+     *      MyStringBuilder instance is initialized.
+     *      int of a file descriptor open for reading.
+     *
+     * Post-Conditions:
+     *      The characters read from the descriptor until its end are
+     *      appended to `this`.
+     *      A system_error exception is thrown if a read fails,
+     *      a length_error exception if `this` would exceed INT_MAX
+     *      characters, the characters read before are kept.
+     *      The descriptor is left open.
+     *      A reference to `this` is returned.
+     *
+     * Appends the characters read from the given file descriptor,
+     * until its end.
+     */
+    MyStringBuilder& readFrom(int);
+
+    /* Streams the chunks of the storage without building a string */
+    friend std::ostream& operator<<(std::ostream&, const MyStringBuilder&);
+
+    /* Transforms the chunks of the storage in place, from many threads */
+    friend class ParallelExecutor;
+
 private:
     /*
      * Pre-Conditions:
-     *      NodePtr to a char Node.
-     *      int of the number of Nodes.
+     *      Pointer to a heap allocated Storage.
+     *      Mode of the given Storage.
      *
      * Post-Conditions:
      *      A MyStringBuilder instance is created.
-     *      first is the given NodePtr.
-     *      size is the given size.
+     *      storage is the given Storage, owned by `this`.
+     *      mode is the given mode.
      *
      * Parameterized constructor of the MyStringBuilder class.
-     * Takes a Node pointer & a size parameter.
+     * Takes a Storage pointer & its mode.
      */
-    explicit MyStringBuilder(NodePtr, int);
+    explicit MyStringBuilder(Storage*, Mode);
 
     /*
      * Pre-Conditions:
-     *      MyStringBuilder instance is initialized.
-     *      Given start & end are valid indices.
-     *      end is greater than or equal to start.
+     *      The string whose characters the Storage holds.
+     *      Mode of the Storage to create.
      *
      * Post-Conditions:
-     *      A Node double pointer, pointing to the start
-     *      of a memory chunk containing 2 Node pointers.
-     *      The first of which is the start of the chain,
-     *      while the second is the end.
-     *      No changes to `this`.
+     *      A heap allocated Storage of the given mode is returned.
      *
-     * Returns a Node double pointer to the beginning of a Node chain
-     * that has the copies of characters of `this` MyStringBuilder instance
-     * from the given start (inclusive) to the given end (exclusive).
+     * Returns a new Storage of the given mode holding
+     * the characters of the given string.
      */
-    [[nodiscard]] NodePtr* copyChain(int start = 0, int end = 0) const;
+    [[nodiscard]] static Storage* makeStorage(std::string, Mode);
 
     /*
      * Pre-Conditions:
@@ -319,11 +1187,38 @@ private:
      */
     void checkIndex(int) const;
 
-    /* Node pointer to the first Node in MyStringBuilder */
-    NodePtr first;
+    /*
+     * Pre-Conditions:
+     *      MyStringBuilder instance is initialized.
+     *
+     * Post-Conditions:
+     *      const reference to the Storage of `this` is returned.
+     *      No changes to `this`.
+     *
+     * Returns the Storage of the characters, for reading.
+     */
+    [[nodiscard]] const Storage& readable() const;
+
+    /*
+     * Pre-Conditions:
+     *      MyStringBuilder instance is initialized.
+     *
+     * Post-Conditions:
+     *      Reference to the Storage of `this` is returned.
+     *      A moved-from instance gets a new empty Storage of its mode first.
+     *
+     * Returns the Storage of the characters, for editing.
+     */
+    Storage& editable();
+
+    /*
+     * Storage engine holding the characters of MyStringBuilder,
+     * nullptr once moved from, read through readable & editable
+     */
+    Storage *storage;
 
-    /* Number of Nodes in the string builder */
-    int size;
+    /* Mode of the storage engine */
+    Mode mode;
 };
 
 /*
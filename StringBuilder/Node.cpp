@@ -17,6 +17,10 @@
  *      Node(const DataType&)
  *          Parameterized constructor of the Node class.
  *
+ *      Node(const DataType*, int)
+ *          Parameterized constructor of the Node class,
+ *          that takes a block of data.
+ *
  *      Node& operator=(const Node&)
  *          Assignment operator for the Node class.
  *
@@ -26,25 +30,55 @@
  *      Node* getNext() const
  *          Returns the pointer to the next Node instance.
  *
- *      DataType getData() const
- *          Returns the data stored in the Node instance.
+ *      DataType getData(int index = 0) const
+ *          Returns the data stored at the given index of the block.
+ *
+ *      int getCount() const
+ *          Returns the number of data items stored in the block.
+ *
+ *      int getRoom() const
+ *          Returns the number of data items the block can still take.
+ *
+ *      const DataType* getBlock() const
+ *          Returns a pointer to the block of data.
+ *
+ *      DataType* getBlock()
+ *          Returns a writable pointer to the block of data.
  *
  *      void chain(Node*)
  *          Assigns the next Node instance.
  *
- *      void setData(const DataType&)
- *          Assigns the data field in the Node instance.
- *
- *      Node* unchain(int)
- *          Deletes a given number of Node instances following a Node instance.
- *          Returns a pointer to the new next Node instance.
+ *      void setData(const DataType&, int index = 0)
+ *          Assigns the data at the given index of the block.
  *
  *      Node* skip(int)
  *          Returns a pointer to a Node,
  *          after performing a given number of hops.
+ *
+ *      Node* find(int&)
+ *          Returns a pointer to the Node holding the given data position.
+ *
+ *      int insert(int, const DataType*, int)
+ *          Inserts as much of the given data as fits at the given index.
+ *
+ *      void erase(int begin, int end)
+ *          Removes the data between begin (inclusive) & end (exclusive).
+ *
+ *      Node* split(int, NodeArena&)
+ *          Moves the data after the given index into a new next Node.
+ *
+ *      bool absorb(NodeArena&)
+ *          Moves the data of the next Node into `this` if it fits,
+ *          then releases the next Node.
  */
 
+#include <algorithm>
+#include <cstring>
+
 #include "Node.h"
+#include "NodeArena.h"
+
+using std::min;
 
 
 /*
@@ -54,11 +88,12 @@
  * Post-Conditions:
  *      A default Node instance is created.
  *      next is initialized to nullptr.
- *      data is initialized to default value of the type.
+ *      count is initialized to 0.
  *
+ * The block itself is left uninitialized, only count items are read.
  * No-arg constructor of the Node class.
  */
-Node::Node(): data{}, next{nullptr} {}
+Node::Node(): next{nullptr}, count{0} {}
 
 /*
  * Pre-Conditions:
@@ -67,13 +102,32 @@ Node::Node(): data{}, next{nullptr} {}
  * Post-Conditions:
  *      A Node instance with the given data is created.
  *      next is initialized to nullptr.
- *      data is initialized to the given value.
+ *      count is initialized to 1.
  *
- * Marked explicit to prevent implicit conversions from char* to string.
+ * Marked explicit to prevent implicit conversions from char to Node.
  * Parameterized constructor of the Node class,
  * that takes the data to be stored.
  */
-Node::Node(const DataType& data): data{data}, next{nullptr} {}
+Node::Node(const DataType& value): next{nullptr}, count{1} {
+    data[0] = value;
+}
+
+/*
+ * Pre-Conditions:
+ *      Pointer to the data to copy.
+ *      int of the number of data items, at most kCapacity.
+ *
+ * Post-Conditions:
+ *      A Node instance with a copy of the given data is created.
+ *      next is initialized to nullptr.
+ *      count is initialized to the given count.
+ *
+ * Parameterized constructor of the Node class,
+ * that takes a block of data.
+ */
+Node::Node(const DataType *block, int size): next{nullptr}, count{size} {
+    memcpy(data, block, size * sizeof(DataType));
+}
 
 /*
  * Pre-Conditions:
@@ -97,7 +151,8 @@ Node& Node::operator=(const Node& other) {
         return *this;
     }
 
-    data = other.data;
+    memcpy(data, other.data, other.count * sizeof(DataType));
+    count = other.count;
     next = other.next;
 
     return *this;
@@ -109,15 +164,12 @@ Node& Node::operator=(const Node& other) {
  *
  * Post-Conditions:
  *      `this` Node instance is destroyed.
- *      next is nullptr
+ *      next is nullptr, the following Nodes are untouched.
  *
  * Destructor for the Node class.
- * Deletes all the following Node instances, till it reaches a nullptr.
+ * The Nodes are owned by a NodeArena, which releases each of them.
  */
 Node::~Node() {
-    /* Deleting nullptr has no effect */
-    delete next;
-
     /* Provides protection against illegal access */
     next = nullptr;
 }
@@ -141,6 +193,7 @@ Node* Node::getNext() const {
 /*
  * Pre-Conditions:
  *      `this` Node instance is initialized.
+ *      Index in the block (optional), default is 0, less than count.
  *
  * Post-Conditions:
  *      Data of type `DataType` is returned.
@@ -148,9 +201,64 @@ Node* Node::getNext() const {
  *
  * Marked [[nodiscard]] to allow the compiler to issue warnings in case of
  * wasteful calls. For example `node.getData();`.
- * Returns a copy of the data stored in the Node instance.
+ * Returns a copy of the data stored at the given index of the block.
+ */
+Node::DataType Node::getData(int index) const {
+    return data[index];
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` Node instance is initialized.
+ *
+ * Post-Conditions:
+ *      Number of data items in the block is returned.
+ *      No changes to this.
+ *
+ * Returns the number of data items stored in the block.
+ */
+int Node::getCount() const {
+    return count;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` Node instance is initialized.
+ *
+ * Post-Conditions:
+ *      Number of free slots in the block is returned.
+ *      No changes to this.
+ *
+ * Returns the number of data items the block can still take.
+ */
+int Node::getRoom() const {
+    return kCapacity - count;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` Node instance is initialized.
+ *
+ * Post-Conditions:
+ *      Pointer to the first data item of the block is returned.
+ *      No changes to this.
+ *
+ * Returns a pointer to the block of data.
+ */
+const Node::DataType* Node::getBlock() const {
+    return data;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` Node instance is initialized.
+ *
+ * Post-Conditions:
+ *      Writable pointer to the first data item of the block is returned.
+ *
+ * Returns a writable pointer to the block of data.
  */
-Node::DataType Node::getData() const {
+Node::DataType* Node::getBlock() {
     return data;
 }
 
@@ -184,35 +292,29 @@ Node* Node::skip(int n) {
 /*
  * Pre-Conditions:
  *      `this` Node instance is initialized.
- *      An int is given that represents the number of Nodes to delete,
- *      after this.
+ *      Reference to a data position, counted from the start of `this`.
  *
  * Post-Conditions:
- *      All n-Nodes following `this` are deleted.
- *      next points to the node after the last deleted node.
+ *      A pointer to the Node holding the position is returned,
+ *      the position is changed to an index in that Node's block.
+ *      If the position is past the end of the chain,
+ *      the last Node is returned with an index equal to its count.
  *
- * If the count is 0 or less, no changes occur, next is returned.
- * Deletes a given number of Node instances following a Node instance.
- * Returns a pointer to the new next Node instance.
+ * Marked [[nodiscard]] to allow the compiler to issue warnings in case of
+ * wasteful calls. For example `node.find(position);`.
+ * Walks one Node per block.
+ * Returns a pointer to the Node holding the given data position.
  */
-Node* Node::unchain(int count) {
-    if (count <= 0) {
-        return getNext();
-    }
-
-    /* Last node in the chain to be deleted */
-    Node *chain_end = skip(count);
-
-    /* First node in the chain to be deleted */
-    Node *chain_start = getNext();
-
-    chain(chain_end->getNext());
+Node* Node::find(int& position) {
+    Node *result = this;
 
-    /* Prevents the deletion of Nodes after the last Node */
-    chain_end->chain(nullptr);
-    delete chain_start;
+    /* Hop over whole blocks until the position falls inside one */
+    while (result->count <= position and result->next) {
+        position -= result->count;
+        result = result->next;
+    }
 
-    return getNext();
+    return result;
 }
 
 /*
@@ -233,13 +335,107 @@ void Node::chain(Node *newNext) {
  * Pre-Conditions:
  *      `this` Node instance is initialized.
  *      A const reference to a variable of type `DataType` is given.
+ *      Index in the block (optional), default is 0, less than count.
  *
  * Post-Conditions:
- *      data in the Node instance is a copy of the given data.
+ *      data at the given index is a copy of the given data.
  *
  * Uses the DataType assignment operator.
- * Assigns the data field in the Node instance.
+ * Assigns the data at the given index of the block.
+ */
+void Node::setData(const DataType& newData, int index) {
+    data[index] = newData;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` Node instance is initialized.
+ *      Index in the block, at most count.
+ *      Pointer to the data to insert & the number of data items.
+ *
+ * Post-Conditions:
+ *      Up to getRoom() data items are inserted at the given index.
+ *      Returns the number of inserted data items.
+ *
+ * Inserts as much of the given data as fits at the given index.
  */
-void Node::setData(const DataType& newData) {
-    data = newData;
+int Node::insert(int index, const DataType *block, int size) {
+    const int taken = min(size, getRoom());
+
+    /* Open a gap for the new data */
+    memmove(data + index + taken, data + index,
+            (count - index) * sizeof(DataType));
+    memcpy(data + index, block, taken * sizeof(DataType));
+
+    count += taken;
+    return taken;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` Node instance is initialized.
+ *      begin & end are indices in the block, begin <= end <= count.
+ *
+ * Post-Conditions:
+ *      The data between begin & end is removed,
+ *      the following data is moved back.
+ *
+ * Removes the data between begin (inclusive) & end (exclusive).
+ */
+void Node::erase(int begin, int end) {
+    memmove(data + begin, data + end, (count - end) * sizeof(DataType));
+    count -= end - begin;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` Node instance is initialized.
+ *      Index in the block, at most count.
+ *      Reference to the NodeArena that made `this`.
+ *
+ * Post-Conditions:
+ *      A new Node of the arena holding the data after the index
+ *      follows `this`.
+ *      Returns a pointer to the new Node.
+ *
+ * Moves the data after the given index into a new next Node.
+ */
+Node* Node::split(int index, NodeArena& arena) {
+    auto tail = arena.make(data + index, count - index);
+
+    tail->chain(next);
+    next = tail;
+    count = index;
+
+    return tail;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` Node instance is initialized.
+ *      Reference to the NodeArena that made `this` & the next Node.
+ *
+ * Post-Conditions:
+ *      If the data of the next Node fits in `this`,
+ *      it is moved to `this`, the next Node is released to the arena &
+ *      true is returned.
+ *
+ * Keeps the blocks of the chain filled after edits.
+ * Moves the data of the next Node into `this` if it fits,
+ * then releases the next Node.
+ */
+bool Node::absorb(NodeArena& arena) {
+    if (not next or getRoom() < next->count) {
+        return false;
+    }
+
+    Node *absorbed = next;
+
+    memcpy(data + count, absorbed->data, absorbed->count * sizeof(DataType));
+    count += absorbed->count;
+    next = absorbed->next;
+
+    arena.release(absorbed);
+
+    return true;
 }
@@ -9,7 +9,7 @@
  * Author:      Mahmoud Yaman Seraj Alddin
  *
  * Purpose:     Header file for the Node class,
- *              used in the MyStringBuilder class.
+ *              used in the ChainStorage class of MyStringBuilder.
  *
  * List of public Functions:
  *      Node()
@@ -18,6 +18,10 @@
  *      Node(const DataType&)
  *          Parameterized constructor of the Node class.
  *
+ *      Node(const DataType*, int)
+ *          Parameterized constructor of the Node class,
+ *          that takes a block of data.
+ *
  *      Node& operator=(const Node&)
  *          Assignment operator for the Node class.
  *
@@ -27,29 +31,57 @@
  *      Node* getNext() const
  *          Returns the pointer to the next Node instance.
  *
- *      DataType getData() const
- *          Returns the data stored in the Node instance.
+ *      DataType getData(int index = 0) const
+ *          Returns the data stored at the given index of the block.
+ *
+ *      int getCount() const
+ *          Returns the number of data items stored in the block.
+ *
+ *      int getRoom() const
+ *          Returns the number of data items the block can still take.
+ *
+ *      const DataType* getBlock() const
+ *          Returns a pointer to the block of data.
+ *
+ *      DataType* getBlock()
+ *          Returns a writable pointer to the block of data.
  *
  *      void chain(Node*)
  *          Assigns the next Node instance.
  *
- *      void setData(const DataType&)
- *          Assigns the data field in the Node instance.
- *
- *      Node* unchain(int)
- *          Deletes a given number of Node instances following a Node instance.
- *          Returns a pointer to the new next Node instance.
+ *      void setData(const DataType&, int index = 0)
+ *          Assigns the data at the given index of the block.
  *
  *      Node* skip(int)
  *          Returns a pointer to a Node,
  *          after performing a given number of hops.
+ *
+ *      Node* find(int&)
+ *          Returns a pointer to the Node holding the given data position.
+ *
+ *      int insert(int, const DataType*, int)
+ *          Inserts as much of the given data as fits at the given index.
+ *
+ *      void erase(int begin, int end)
+ *          Removes the data between begin (inclusive) & end (exclusive).
+ *
+ *      Node* split(int, NodeArena&)
+ *          Moves the data after the given index into a new next Node.
+ *
+ *      bool absorb(NodeArena&)
+ *          Moves the data of the next Node into `this` if it fits,
+ *          then releases the next Node.
  */
 
 #ifndef MYSTRINGBUILDER_NODE_H
 #define MYSTRINGBUILDER_NODE_H
 
+class NodeArena;
+
 /*
- * Node class used in MyStringBuilder class to manage single characters.
+ * Node class used in ChainStorage class to manage a block of characters.
+ * Each Node holds up to kCapacity characters inline,
+ * making the chain an unrolled linked list.
  */
 class Node {
 public:
@@ -60,6 +92,13 @@ public:
      */
     typedef char DataType;
 
+    /*
+     * Number of data items a single Node holds.
+     * Chosen so that a Node of chars spans exactly 2 cache lines (128 bytes).
+     */
+    static const int kCapacity = (128 - sizeof(void*) - sizeof(int))
+                                 / sizeof(DataType);
+
     /*
      * Pre-Conditions:
      *      No preconditions.
@@ -67,7 +106,7 @@ public:
      * Post-Conditions:
      *      A default Node instance is created.
      *      next is nullptr.
-     *      data is default value of the type.
+     *      count is 0.
      *
      * No-arg constructor of the Node class.
      */
@@ -80,13 +119,28 @@ public:
      * Post-Conditions:
      *      A Node instance with the given data is created.
      *      next is nullptr.
-     *      data is a copy of the given value.
+     *      count is 1.
      *
      * Parameterized constructor of the Node class,
      * that takes the data to be stored.
      */
     explicit Node(const DataType&);
 
+    /*
+     * Pre-Conditions:
+     *      Pointer to the data to copy.
+     *      int of the number of data items, at most kCapacity.
+     *
+     * Post-Conditions:
+     *      A Node instance with a copy of the given data is created.
+     *      next is nullptr.
+     *      count is the given count.
+     *
+     * Parameterized constructor of the Node class,
+     * that takes a block of data.
+     */
+    Node(const DataType*, int);
+
     /*
      * Pre-Conditions:
      *      `this` Node instance & the given Node instance are initialized.
@@ -94,6 +148,7 @@ public:
      *
      * Post-Conditions:
      *      data is a copy of the given Node's data.
+     *      count is a copy of the given Node's count.
      *      next is a copy of the given Node's next.
      *      Returns a reference to this.
      *
@@ -108,8 +163,9 @@ public:
      *
      * Post-Conditions:
      *      `this` Node instance is destroyed.
-     *      next is nullptr.
+     *      next is nullptr, the following Nodes are untouched.
      *
+     * Nodes live in the pages of a NodeArena, which destroys them.
      * Destructor for the Node class.
      */
     ~Node();
@@ -129,14 +185,62 @@ public:
     /*
      * Pre-Conditions:
      *      `this` Node instance is initialized.
+     *      Index in the block (optional), default is 0, less than count.
      *
      * Post-Conditions:
      *      Data of type `DataType` is returned.
      *      No changes to this.
      *
-     * Returns a copy of the data stored in the Node instance.
+     * Returns a copy of the data stored at the given index of the block.
+     */
+    [[nodiscard]] DataType getData(int index = 0) const;
+
+    /*
+     * Pre-Conditions:
+     *      `this` Node instance is initialized.
+     *
+     * Post-Conditions:
+     *      Number of data items in the block is returned.
+     *      No changes to this.
+     *
+     * Returns the number of data items stored in the block.
+     */
+    [[nodiscard]] int getCount() const;
+
+    /*
+     * Pre-Conditions:
+     *      `this` Node instance is initialized.
+     *
+     * Post-Conditions:
+     *      Number of free slots in the block is returned.
+     *      No changes to this.
+     *
+     * Returns the number of data items the block can still take.
      */
-    [[nodiscard]] DataType getData() const;
+    [[nodiscard]] int getRoom() const;
+
+    /*
+     * Pre-Conditions:
+     *      `this` Node instance is initialized.
+     *
+     * Post-Conditions:
+     *      Pointer to the first data item of the block is returned.
+     *      No changes to this.
+     *
+     * Returns a pointer to the block of data.
+     */
+    [[nodiscard]] const DataType* getBlock() const;
+
+    /*
+     * Pre-Conditions:
+     *      `this` Node instance is initialized.
+     *
+     * Post-Conditions:
+     *      Writable pointer to the first data item of the block is returned.
+     *
+     * Returns a writable pointer to the block of data.
+     */
+    [[nodiscard]] DataType* getBlock();
 
     /*
      * Pre-Conditions:
@@ -155,17 +259,18 @@ public:
     /*
      * Pre-Conditions:
      *      `this` Node instance is initialized.
-     *      An int is given that represents the number of Nodes to delete,
-     *      after this.
+     *      Reference to a data position, counted from the start of `this`.
      *
      * Post-Conditions:
-     *      All n-Nodes following `this` are deleted.
-     *      next points to the node after the last deleted node.
+     *      A pointer to the Node holding the position is returned,
+     *      the position is changed to an index in that Node's block.
+     *      If the position is past the end of the chain,
+     *      the last Node is returned with an index equal to its count.
      *
-     * Deletes a given number of Node instances following a Node instance.
-     * Returns a pointer to the new next Node instance.
+     * Walks one Node per block.
+     * Returns a pointer to the Node holding the given data position.
      */
-    Node* unchain(int);
+    [[nodiscard]] Node* find(int&);
 
     /*
      * Pre-Conditions:
@@ -183,13 +288,71 @@ public:
      * Pre-Conditions:
      *      `this` Node instance is initialized.
      *      A const reference to a variable of type `DataType` is given.
+     *      Index in the block (optional), default is 0, less than count.
      *
      * Post-Conditions:
-     *      data in the Node instance is a copy of the given data.
+     *      data at the given index is a copy of the given data.
      *
-     * Assigns the data field in the Node instance.
+     * Assigns the data at the given index of the block.
      */
-    void setData(const DataType&);
+    void setData(const DataType&, int index = 0);
+
+    /*
+     * Pre-Conditions:
+     *      `this` Node instance is initialized.
+     *      Index in the block, at most count.
+     *      Pointer to the data to insert & the number of data items.
+     *
+     * Post-Conditions:
+     *      Up to getRoom() data items are inserted at the given index.
+     *      Returns the number of inserted data items.
+     *
+     * Inserts as much of the given data as fits at the given index.
+     */
+    int insert(int, const DataType*, int);
+
+    /*
+     * Pre-Conditions:
+     *      `this` Node instance is initialized.
+     *      begin & end are indices in the block, begin <= end <= count.
+     *
+     * Post-Conditions:
+     *      The data between begin & end is removed,
+     *      the following data is moved back.
+     *
+     * Removes the data between begin (inclusive) & end (exclusive).
+     */
+    void erase(int /* begin */, int /* end */);
+
+    /*
+     * Pre-Conditions:
+     *      `this` Node instance is initialized.
+     *      Index in the block, at most count.
+     *      Reference to the NodeArena that made `this`.
+     *
+     * Post-Conditions:
+     *      A new Node of the arena holding the data after the index
+     *      follows `this`.
+     *      Returns a pointer to the new Node.
+     *
+     * Moves the data after the given index into a new next Node.
+     */
+    Node* split(int, NodeArena&);
+
+    /*
+     * Pre-Conditions:
+     *      `this` Node instance is initialized.
+     *      Reference to the NodeArena that made `this` & the next Node.
+     *
+     * Post-Conditions:
+     *      If the data of the next Node fits in `this`,
+     *      it is moved to `this`, the next Node is released to the arena &
+     *      true is returned.
+     *
+     * Moves the data of the next Node into `this` if it fits,
+     * then releases the next Node.
+     */
+    bool absorb(NodeArena&);
 
 private:
     /*
@@ -199,10 +362,16 @@ private:
     Node *next;
 
     /*
-     * Data stored in the Node instance.
-     * Initialized to the default value of the type.
+     * Number of data items stored in the block.
+     * Initialized to 0 by default.
+     */
+    int count;
+
+    /*
+     * Block of data stored in the Node instance.
+     * Only the first count items are meaningful.
      */
-    DataType data;
+    DataType data[kCapacity];
 };
 
 #endif /* MYSTRINGBUILDER_NODE_H */
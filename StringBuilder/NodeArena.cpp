@@ -0,0 +1,250 @@
+/*
+ * StringBuilder Project
+ *
+ *
+ * NodeArena.cpp
+ *
+ * Date:        17/10/2026
+ *
+ * Author:      Mahmoud Yaman Seraj Alddin
+ *
+ * Purpose:     Implementation of the NodeArena class,
+ *              described in NodeArena.h
+ *
+ * List of public Functions:
+ *      NodeArena()
+ *          No-arg constructor of the NodeArena class.
+ *
+ *      ~NodeArena()
+ *          Destructor for the NodeArena class.
+ *
+ *      Node* make(const Node::DataType* data = nullptr, int count = 0)
+ *          Returns a new Node holding a copy of the given data.
+ *
+ *      void release(Node*)
+ *          Destroys the given Node & keeps its memory for reuse.
+ *
+ *      void reset()
+ *          Releases all the pages of the arena.
+ *
+ *      void adopt(NodeArena&)
+ *          Takes the pages of the given arena, with the Nodes made by it.
+ *
+ *      const Counters& getCounters() const
+ *          Returns the allocation counters of the arena.
+ *
+ * List of private Functions:
+ *      void grow()
+ *          Allocates a new page of Nodes.
+ */
+
+#include <new>
+
+#include "NodeArena.h"
+
+using namespace std;
+
+/*
+ * Pre-Conditions:
+ *      No preconditions.
+ *
+ * Post-Conditions:
+ *      An empty NodeArena instance is created, without any page.
+ *      All the counters are initialized to 0.
+ *
+ * Pages are only allocated on the first make.
+ * No-arg constructor of the NodeArena class.
+ */
+NodeArena::NodeArena(): pages{nullptr}, oldest{nullptr}, cursor{nullptr},
+                        limit{nullptr}, freed{nullptr},
+                        pageNodes{kFirstPageNodes},
+                        counters{0, 0, 0, 0} {}
+
+/*
+ * Pre-Conditions:
+ *      `this` NodeArena instance is not destroyed.
+ *
+ * Post-Conditions:
+ *      `this` NodeArena instance & all its pages are destroyed,
+ *      Nodes made by `this` are no longer valid.
+ *
+ * The Nodes are not destroyed one by one, only their pages are freed.
+ * Destructor for the NodeArena class.
+ */
+NodeArena::~NodeArena() {
+    reset();
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` NodeArena instance is initialized.
+ *      Pointer to the data to copy (optional), default is nullptr.
+ *      int of the number of data items (optional), default is 0,
+ *      at most Node::kCapacity.
+ *
+ * Post-Conditions:
+ *      A Node holding a copy of the given data is returned.
+ *      next of the Node is nullptr.
+ *
+ * Released Nodes are reused first, most recently released first,
+ * since their memory is the most likely to be cached.
+ * Returns a new Node holding a copy of the given data.
+ */
+Node* NodeArena::make(const Node::DataType *data, int count) {
+    Slot *slot;
+
+    if (freed) {
+        slot = freed;
+        freed = freed->next;
+        counters.reused++;
+    } else {
+        if (cursor == limit) {
+            grow();
+        }
+
+        slot = cursor++;
+    }
+
+    counters.nodes++;
+
+    if (not count) {
+        return new (slot) Node();
+    }
+
+    return new (slot) Node(data, count);
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` NodeArena instance is initialized.
+ *      Pointer to a Node made by `this`, not in use anymore.
+ *
+ * Post-Conditions:
+ *      The Node is destroyed, without its following Nodes.
+ *      Its memory is at the head of the free list.
+ *
+ * Destroys the given Node & keeps its memory for reuse.
+ */
+void NodeArena::release(Node *node) {
+    node->~Node();
+
+    auto slot = reinterpret_cast<Slot*>(node);
+
+    slot->next = freed;
+    freed = slot;
+    counters.released++;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` NodeArena instance is initialized.
+ *      No Node made by `this` is in use.
+ *
+ * Post-Conditions:
+ *      All the pages are freed, the free list is empty.
+ *      The next page has kFirstPageNodes Nodes.
+ *      The counters are unchanged.
+ *
+ * Releases all the pages of the arena.
+ */
+void NodeArena::reset() {
+    while (pages) {
+        Slot *previous = pages->next;
+
+        delete[] pages;
+        pages = previous;
+    }
+
+    oldest = nullptr;
+    cursor = nullptr;
+    limit = nullptr;
+    freed = nullptr;
+    pageNodes = kFirstPageNodes;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` NodeArena instance is initialized.
+ *      Reference to a NodeArena other than `this`.
+ *
+ * Post-Conditions:
+ *      The pages of the given arena belong to `this`,
+ *      the Nodes made by the given arena may be released to `this`.
+ *      The counters of the given arena are added to those of `this`
+ *      & reset.
+ *      The given arena has no pages.
+ *
+ * The list of pages of the given arena is linked after the pages of
+ * `this`, O(1). Its unused Slots are not reused, only freed with the pages.
+ * Takes the pages of the given arena, with the Nodes made by it.
+ */
+void NodeArena::adopt(NodeArena& other) {
+    if (not other.pages) {
+        return;
+    }
+
+    if (oldest) {
+        oldest->next = other.pages;
+    } else {
+        pages = other.pages;
+    }
+
+    oldest = other.oldest;
+
+    /* The Nodes of the given arena are counted with those of `this` */
+    counters.nodes += other.counters.nodes;
+    counters.reused += other.counters.reused;
+    counters.released += other.counters.released;
+    counters.pages += other.counters.pages;
+    other.counters = Counters{};
+
+    other.pages = nullptr;
+    other.reset();
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` NodeArena instance is initialized.
+ *
+ * Post-Conditions:
+ *      const reference to the counters of `this` is returned.
+ *      No changes to `this`.
+ *
+ * Returns the allocation counters of the arena.
+ */
+const NodeArena::Counters& NodeArena::getCounters() const {
+    return counters;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` NodeArena instance is initialized.
+ *
+ * Post-Conditions:
+ *      A page of pageNodes Nodes is at the head of pages.
+ *      cursor & limit span the Nodes of the page.
+ *
+ * The page size doubles on each growth, so small builders stay small &
+ * large builders need O(log n) pages before reaching kMaxPageNodes.
+ * Allocates a new page of Nodes.
+ */
+void NodeArena::grow() {
+    /* The first Slot links the previous page */
+    auto page = new Slot[pageNodes + 1];
+
+    page->next = pages;
+    pages = page;
+
+    if (not oldest) {
+        oldest = page;
+    }
+
+    cursor = page + 1;
+    limit = page + 1 + pageNodes;
+
+    if (pageNodes < kMaxPageNodes) {
+        pageNodes *= 2;
+    }
+
+    counters.pages++;
+}
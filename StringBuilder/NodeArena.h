@@ -0,0 +1,226 @@
+/*
+ * StringBuilder Project
+ *
+ *
+ * NodeArena.h
+ *
+ * Date:        17/10/2026
+ *
+ * Author:      Mahmoud Yaman Seraj Alddin
+ *
+ * Purpose:     Header file for the NodeArena class,
+ *              the slab allocator of the Nodes of a ChainStorage.
+ *
+ * List of public Functions:
+ *      NodeArena()
+ *          No-arg constructor of the NodeArena class.
+ *
+ *      ~NodeArena()
+ *          Destructor for the NodeArena class.
+ *
+ *      Node* make(const Node::DataType* data = nullptr, int count = 0)
+ *          Returns a new Node holding a copy of the given data.
+ *
+ *      void release(Node*)
+ *          Destroys the given Node & keeps its memory for reuse.
+ *
+ *      void reset()
+ *          Releases all the pages of the arena.
+ *
+ *      void adopt(NodeArena&)
+ *          Takes the pages of the given arena, with the Nodes made by it.
+ *
+ *      const Counters& getCounters() const
+ *          Returns the allocation counters of the arena.
+ *
+ * List of private Functions:
+ *      void grow()
+ *          Allocates a new page of Nodes.
+ */
+
+#ifndef MYSTRINGBUILDER_NODEARENA_H
+#define MYSTRINGBUILDER_NODEARENA_H
+
+#include "Node.h"
+
+/*
+ * NodeArena allocates Nodes in large contiguous pages, each page holding
+ * twice the Nodes of the previous one, up to kMaxPageNodes.
+ * Released Nodes are kept in an intrusive free list & reused,
+ * destroying the arena frees all its Nodes in O(pages).
+ */
+class NodeArena {
+public:
+    /* Number of Nodes in the first page */
+    static const int kFirstPageNodes = 8;
+
+    /* Maximum number of Nodes in a page, 512KB of Nodes */
+    static const int kMaxPageNodes = 4096;
+
+    /*
+     * Allocation counters of a NodeArena.
+     */
+    struct Counters {
+        /* Number of Nodes made */
+        long long nodes;
+
+        /* Number of Nodes made from the memory of released Nodes */
+        long long reused;
+
+        /* Number of Nodes released */
+        long long released;
+
+        /* Number of pages allocated, the heap allocations of the arena */
+        long long pages;
+    };
+
+    /*
+     * Pre-Conditions:
+     *      No preconditions.
+     *
+     * Post-Conditions:
+     *      An empty NodeArena instance is created, without any page.
+     *      All the counters are 0.
+     *
+     * No-arg constructor of the NodeArena class.
+     */
+    NodeArena();
+
+    /*
+     * Copying an arena would free its pages twice.
+     */
+    NodeArena(const NodeArena&) = delete;
+
+    /*
+     * Copying an arena would free its pages twice.
+     */
+    NodeArena& operator=(const NodeArena&) = delete;
+
+    /*
+     * Pre-Conditions:
+     *      `this` NodeArena instance is not destroyed.
+     *
+     * Post-Conditions:
+     *      `this` NodeArena instance & all its pages are destroyed,
+     *      Nodes made by `this` are no longer valid.
+     *
+     * Destructor for the NodeArena class.
+     */
+    ~NodeArena();
+
+    /*
+     * Pre-Conditions:
+     *      `this` NodeArena instance is initialized.
+     *      Pointer to the data to copy (optional), default is nullptr.
+     *      int of the number of data items (optional), default is 0,
+     *      at most Node::kCapacity.
+     *
+     * Post-Conditions:
+     *      A Node holding a copy of the given data is returned.
+     *      next of the Node is nullptr.
+     *
+     * Returns a new Node holding a copy of the given data.
+     */
+    [[nodiscard]] Node* make(const Node::DataType* data = nullptr,
+                             int count = 0);
+
+    /*
+     * Pre-Conditions:
+     *      `this` NodeArena instance is initialized.
+     *      Pointer to a Node made by `this`, not in use anymore.
+     *
+     * Post-Conditions:
+     *      The Node is destroyed, without its following Nodes.
+     *      Its memory is at the head of the free list.
+     *
+     * Destroys the given Node & keeps its memory for reuse.
+     */
+    void release(Node*);
+
+    /*
+     * Pre-Conditions:
+     *      `this` NodeArena instance is initialized.
+     *      No Node made by `this` is in use.
+     *
+     * Post-Conditions:
+     *      All the pages are freed, the free list is empty.
+     *      The next page has kFirstPageNodes Nodes.
+     *      The counters are unchanged.
+     *
+     * Releases all the pages of the arena.
+     */
+    void reset();
+
+    /*
+     * Pre-Conditions:
+     *      `this` NodeArena instance is initialized.
+     *      Reference to a NodeArena other than `this`.
+     *
+     * Post-Conditions:
+     *      The pages of the given arena belong to `this`,
+     *      the Nodes made by the given arena may be released to `this`.
+     *      The counters of the given arena are added to those of `this`
+     *      & reset.
+     *      The given arena has no pages.
+     *
+     * Takes the pages of the given arena, with the Nodes made by it.
+     */
+    void adopt(NodeArena&);
+
+    /*
+     * Pre-Conditions:
+     *      `this` NodeArena instance is initialized.
+     *
+     * Post-Conditions:
+     *      const reference to the counters of `this` is returned.
+     *      No changes to `this`.
+     *
+     * Returns the allocation counters of the arena.
+     */
+    [[nodiscard]] const Counters& getCounters() const;
+
+private:
+    /*
+     * Memory of a single Node, linking the free list while not in use.
+     * The first Slot of each page links the previous page.
+     */
+    union Slot {
+        Slot *next;
+        alignas(Node) unsigned char bytes[sizeof(Node)];
+    };
+
+    /*
+     * Pre-Conditions:
+     *      `this` NodeArena instance is initialized.
+     *
+     * Post-Conditions:
+     *      A page of pageNodes Nodes is at the head of pages.
+     *      cursor & limit span the Nodes of the page.
+     *
+     * Allocates a new page of Nodes.
+     */
+    void grow();
+
+    /* Last allocated page, nullptr if there are no pages */
+    Slot *pages;
+
+    /* First allocated page, the end of the list of pages */
+    Slot *oldest;
+
+    /* Next never used Slot of the last page */
+    Slot *cursor;
+
+    /* End of the last page */
+    Slot *limit;
+
+    /* First Slot of the free list, nullptr if it is empty */
+    Slot *freed;
+
+    /* Number of Nodes in the next page */
+    int pageNodes;
+
+    /* Allocation counters */
+    Counters counters;
+};
+
+#endif /* MYSTRINGBUILDER_NODEARENA_H */
@@ -0,0 +1,747 @@
+/*
+ * StringBuilder Project
+ *
+ *
+ * ParallelExecutor.cpp
+ *
+ * Date:        17/10/2026
+ *
+ * Author:      Mahmoud Yaman Seraj Alddin
+ *
+ * Purpose:     Implementation of the ParallelExecutor class,
+ *              described in ParallelExecutor.h
+ *
+ * List of public Functions:
+ *      ParallelExecutor(int threads = 0, int serialLength = kSerialLength)
+ *          Parameterized constructor of the ParallelExecutor class.
+ *
+ *      ~ParallelExecutor()
+ *          Destructor for the ParallelExecutor class.
+ *
+ *      MyStringBuilder& toUpperCase(MyStringBuilder&)
+ *          Changes all the characters of the given MyStringBuilder to
+ *          upper case.
+ *
+ *      MyStringBuilder& toLowerCase(MyStringBuilder&)
+ *          Changes all the characters of the given MyStringBuilder to
+ *          lower case.
+ *
+ *      MyStringBuilder& swapCase(MyStringBuilder&)
+ *          Swaps the case of all the characters of the given
+ *          MyStringBuilder.
+ *
+ *      MyStringBuilder& transform(MyStringBuilder&, const ByteTable&)
+ *          Replaces each character of the given MyStringBuilder by its
+ *          entry in the given table.
+ *
+ *      long long count(const MyStringBuilder&, char)
+ *          Returns the number of occurrences of the given character.
+ *
+ *      unsigned long long hash(const MyStringBuilder&)
+ *          Returns the hash of the characters of the given MyStringBuilder.
+ *
+ *      int indexOf(const MyStringBuilder&, const std::string&,
+ *                  int fromIndex = 0)
+ *          Returns the position of the first occurrence of the given string,
+ *          starting the search at fromIndex.
+ *
+ *      std::string toString(const MyStringBuilder&)
+ *          Returns a string of the characters of the given MyStringBuilder.
+ *
+ *      int threadCount() const
+ *          Returns the number of threads running the ranges.
+ *
+ * List of private Functions:
+ *      void run(int, const std::function<void(int)>&)
+ *          Runs the given task for each index below the given count,
+ *          on the pool & the calling thread.
+ *
+ *      void work(Job&)
+ *          Runs the tasks of the given job until none is left.
+ *
+ *      void serve()
+ *          Body of the worker threads.
+ *
+ *      int rangeCount(int) const
+ *          Returns the number of ranges a builder of the given length
+ *          is split into.
+ *
+ *      MyStringBuilder& transformRanges(MyStringBuilder&,
+ *                                       const Storage::MutableChunkVisitor&)
+ *          Calls the given visitor with every chunk of the given
+ *          MyStringBuilder, from many threads.
+ *
+ *      static std::vector<Chunk> chunksOf(const MyStringBuilder&)
+ *          Returns the chunks of the given MyStringBuilder.
+ *
+ *      static bool visitRange(const std::vector<Chunk>&, int, int,
+ *                             const Storage::ChunkVisitor&)
+ *          Calls the visitor with the parts of the chunks between
+ *          the given positions.
+ *
+ * List of local Functions:
+ *      int boundary(int, int, int, int)
+ *          Returns the first position of the given range.
+ *
+ *      unsigned long long power(unsigned long long, int)
+ *          Returns the given base raised to the given exponent.
+ *
+ *      unsigned long long hashBytes(unsigned long long, const char*, int)
+ *          Continues the given hash over the given characters.
+ */
+
+#include <algorithm>
+#include <climits>
+#include <cstring>
+
+#include "ParallelExecutor.h"
+#include "Searcher.h"
+
+using namespace std;
+
+/*
+ * Pre-Conditions:
+ *      int of the first position & the length split into ranges.
+ *      int of the index of a range, at most the number of ranges.
+ *      int of the number of ranges, at least 1.
+ *
+ * Post-Conditions:
+ *      First position of the range is returned, the end of the last
+ *      range for the index equal to the number of ranges.
+ *
+ * The ranges differ in length by at most 1.
+ * Returns the first position of the given range.
+ */
+static int boundary(int begin, int length, int range, int ranges) {
+    return begin + (int) ((long long) length * range / ranges);
+}
+
+/*
+ * Pre-Conditions:
+ *      The base & the exponent, at least 0.
+ *
+ * Post-Conditions:
+ *      base^exponent modulo 2^64 is returned.
+ *
+ * Squares the base for each bit of the exponent, O(log exponent).
+ * Returns the given base raised to the given exponent.
+ */
+static unsigned long long power(unsigned long long base, int exponent) {
+    unsigned long long result = 1;
+
+    for (; exponent; exponent >>= 1) {
+        if (exponent & 1) {
+            result *= base;
+        }
+
+        base *= base;
+    }
+
+    return result;
+}
+
+/*
+ * Pre-Conditions:
+ *      The hash of the preceding characters.
+ *      Pointer to the characters to hash & their count.
+ *
+ * Post-Conditions:
+ *      The hash of the preceding characters followed by the given ones
+ *      is returned.
+ *
+ * Four characters are folded per multiplication by kHashBase^4,
+ * so the multiplications of the characters do not wait on each other.
+ * Continues the given hash over the given characters.
+ */
+static unsigned long long hashBytes(unsigned long long hash,
+                                    const char *data, int count) {
+    const unsigned long long base = ParallelExecutor::kHashBase;
+    const unsigned long long base2 = base * base;
+    const unsigned long long base3 = base2 * base;
+    const unsigned long long base4 = base2 * base2;
+    const auto bytes = reinterpret_cast<const unsigned char*>(data);
+    int i = 0;
+
+    for (; i + 4 <= count; i += 4) {
+        hash = hash * base4 + bytes[i] * base3 + bytes[i + 1] * base2
+               + bytes[i + 2] * base + bytes[i + 3];
+    }
+
+    for (; i < count; i++) {
+        hash = hash * base + bytes[i];
+    }
+
+    return hash;
+}
+
+/*
+ * Pre-Conditions:
+ *      int of the number of threads (optional), counting the calling
+ *      thread, 0 for one per core, default is 0.
+ *      int of the shortest builder split into ranges (optional),
+ *      default is kSerialLength.
+ *
+ * Post-Conditions:
+ *      A ParallelExecutor instance is created, its worker threads
+ *      started & waiting.
+ *
+ * The calling thread runs ranges too, so one thread less is started.
+ * Parameterized constructor of the ParallelExecutor class.
+ */
+ParallelExecutor::ParallelExecutor(int threads, int serialLength)
+        : serialLength{serialLength}, workers{}, dispatch{}, state{},
+          posted{}, finished{}, job{nullptr}, generation{0},
+          stopping{false} {
+    if (threads <= 0) {
+        threads = max(1, (int) thread::hardware_concurrency());
+    }
+
+    for (int i = 1; i < threads; i++) {
+        workers.emplace_back(&ParallelExecutor::serve, this);
+    }
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` ParallelExecutor instance is not destroyed.
+ *      No operation is running.
+ *
+ * Post-Conditions:
+ *      The worker threads are joined.
+ *      `this` ParallelExecutor instance is destroyed.
+ *
+ * Destructor for the ParallelExecutor class.
+ */
+ParallelExecutor::~ParallelExecutor() {
+    {
+        lock_guard<mutex> lock(state);
+
+        stopping = true;
+    }
+
+    posted.notify_all();
+
+    for (auto& worker: workers) {
+        worker.join();
+    }
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` ParallelExecutor instance is initialized.
+ *      Reference to the MyStringBuilder to change.
+ *
+ * Post-Conditions:
+ *      The characters of the MyStringBuilder are all in upper case.
+ *      A reference to the MyStringBuilder is returned.
+ *
+ * Each chunk is converted by the SIMD kernel of ByteTransform.
+ * Changes all the characters of the given MyStringBuilder to
+ * upper case.
+ */
+MyStringBuilder& ParallelExecutor::toUpperCase(MyStringBuilder& builder) {
+    return transformRanges(builder, upperCaseBytes);
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` ParallelExecutor instance is initialized.
+ *      Reference to the MyStringBuilder to change.
+ *
+ * Post-Conditions:
+ *      The characters of the MyStringBuilder are all in lower case.
+ *      A reference to the MyStringBuilder is returned.
+ *
+ * Each chunk is converted by the SIMD kernel of ByteTransform.
+ * Changes all the characters of the given MyStringBuilder to
+ * lower case.
+ */
+MyStringBuilder& ParallelExecutor::toLowerCase(MyStringBuilder& builder) {
+    return transformRanges(builder, lowerCaseBytes);
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` ParallelExecutor instance is initialized.
+ *      Reference to the MyStringBuilder to change.
+ *
+ * Post-Conditions:
+ *      The case of the letters of the MyStringBuilder is swapped.
+ *      A reference to the MyStringBuilder is returned.
+ *
+ * Each chunk is converted by the SIMD kernel of ByteTransform.
+ * Swaps the case of all the characters of the given MyStringBuilder.
+ */
+MyStringBuilder& ParallelExecutor::swapCase(MyStringBuilder& builder) {
+    return transformRanges(builder, swapCaseBytes);
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` ParallelExecutor instance is initialized.
+ *      Reference to the MyStringBuilder to change.
+ *      const reference to the table of replacements.
+ *
+ * Post-Conditions:
+ *      Each character c of the MyStringBuilder is replaced by
+ *      table[(unsigned char) c].
+ *      A reference to the MyStringBuilder is returned.
+ *
+ * The table is only read, all the threads share it.
+ * Replaces each character of the given MyStringBuilder by its
+ * entry in the given table.
+ */
+MyStringBuilder& ParallelExecutor::transform(MyStringBuilder& builder,
+                                             const ByteTable& table) {
+    return transformRanges(builder, [&table](char *data, int count) {
+        mapBytes(data, count, table);
+    });
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` ParallelExecutor instance is initialized.
+ *      const reference to the MyStringBuilder to scan.
+ *      The character to count.
+ *
+ * Post-Conditions:
+ *      Number of occurrences of the character is returned.
+ *      No changes to the MyStringBuilder.
+ *
+ * Each range counts into its own slot, the slots are summed after.
+ * Returns the number of occurrences of the given character.
+ */
+long long ParallelExecutor::count(const MyStringBuilder& builder, char c) {
+    const vector<Chunk> chunks = chunksOf(builder);
+    const int total = builder.length();
+    const int ranges = rangeCount(total);
+    vector<long long> counts(ranges, 0);
+
+    run(ranges, [&](int range) {
+        long long found = 0;
+
+        visitRange(chunks, boundary(0, total, range, ranges),
+                   boundary(0, total, range + 1, ranges),
+                   [&](const char *data, int size) {
+            found += std::count(data, data + size, c);
+            return true;
+        });
+
+        counts[range] = found;
+    });
+
+    long long result = 0;
+
+    for (long long found: counts) {
+        result += found;
+    }
+
+    return result;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` ParallelExecutor instance is initialized.
+ *      const reference to the MyStringBuilder to hash.
+ *
+ * Post-Conditions:
+ *      The polynomial hash of the characters, modulo 2^64, is returned.
+ *      Equal characters hash equally whatever the mode of the
+ *      builders & the number of threads.
+ *      No changes to the MyStringBuilder.
+ *
+ * The hash of c[0..n) is the sum of c[i] * kHashBase^(n - 1 - i),
+ * so each range is hashed from 0, then the hash of the ranges before it
+ * is shifted past it: hash(A + B) = hash(A) * kHashBase^|B| + hash(B).
+ * Returns the hash of the characters of the given MyStringBuilder.
+ */
+unsigned long long ParallelExecutor::hash(const MyStringBuilder& builder) {
+    const vector<Chunk> chunks = chunksOf(builder);
+    const int total = builder.length();
+    const int ranges = rangeCount(total);
+    vector<unsigned long long> hashes(ranges, 0);
+
+    run(ranges, [&](int range) {
+        unsigned long long hashed = 0;
+
+        visitRange(chunks, boundary(0, total, range, ranges),
+                   boundary(0, total, range + 1, ranges),
+                   [&](const char *data, int size) {
+            hashed = hashBytes(hashed, data, size);
+            return true;
+        });
+
+        hashes[range] = hashed;
+    });
+
+    unsigned long long result = 0;
+
+    for (int range = 0; range < ranges; range++) {
+        const int length = boundary(0, total, range + 1, ranges)
+                           - boundary(0, total, range, ranges);
+
+        result = result * power(kHashBase, length) + hashes[range];
+    }
+
+    return result;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` ParallelExecutor instance is initialized.
+ *      const reference to the MyStringBuilder to search.
+ *      const reference to the string to search for.
+ *      int of the position to start from (optional), default is 0.
+ *
+ * Post-Conditions:
+ *      The position of the first occurrence starting at or after
+ *      fromIndex is returned, -1 if there is none.
+ *      Like MyStringBuilder::indexOf, fromIndex is clamped to
+ *      [0, length()].
+ *      No changes to the MyStringBuilder.
+ *
+ * The positions a match may start at are split into ranges, each range
+ * is searched with the length() - 1 characters after it, so a match
+ * straddling two ranges is found by the first.
+ * The smallest match found wins, the ranges after a range holding
+ * a match stop early.
+ * Returns the position of the first occurrence of the given string,
+ * starting the search at fromIndex.
+ */
+int ParallelExecutor::indexOf(const MyStringBuilder& builder, const string& s,
+                              int fromIndex) {
+    const int total = builder.length();
+    const int count = (int) s.size();
+
+    fromIndex = min(max(fromIndex, 0), total);
+
+    if (not count) {
+        return fromIndex;
+    } else if (total - fromIndex < count) {
+        return -1;
+    }
+
+    const vector<Chunk> chunks = chunksOf(builder);
+    const Searcher searcher(s);
+    const int starts = total - fromIndex - count + 1;
+    const int ranges = rangeCount(total - fromIndex);
+    atomic<int> first{INT_MAX};
+
+    run(ranges, [&](int range) {
+        const int begin = boundary(fromIndex, starts, range, ranges);
+        const int end = boundary(fromIndex, starts, range + 1, ranges);
+
+        if (begin == end) {
+            return;
+        }
+
+        const int found = searcher.find(
+                [&](const Storage::ChunkVisitor& visitor) {
+            visitRange(chunks, begin, end + count - 1,
+                       [&](const char *data, int size) {
+                /* A match in an earlier range comes first */
+                return begin <= first.load(memory_order_relaxed)
+                       and visitor(data, size);
+            });
+        }, begin);
+
+        int seen = first.load();
+
+        while (0 <= found and found < seen
+               and not first.compare_exchange_weak(seen, found)) {}
+    });
+
+    return first == INT_MAX ? -1 : first.load();
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` ParallelExecutor instance is initialized.
+ *      const reference to the MyStringBuilder to copy.
+ *
+ * Post-Conditions:
+ *      A string of the characters of the MyStringBuilder is returned.
+ *      No changes to the MyStringBuilder.
+ *
+ * Each range copies its characters to its own part of the string.
+ * Returns a string of the characters of the given MyStringBuilder.
+ */
+string ParallelExecutor::toString(const MyStringBuilder& builder) {
+    const vector<Chunk> chunks = chunksOf(builder);
+    const int total = builder.length();
+    const int ranges = rangeCount(total);
+    string result(total, '\0');
+    char *target = result.data();
+
+    run(ranges, [&](int range) {
+        int position = boundary(0, total, range, ranges);
+
+        visitRange(chunks, position, boundary(0, total, range + 1, ranges),
+                   [&](const char *data, int size) {
+            memcpy(target + position, data, size);
+            position += size;
+            return true;
+        });
+    });
+
+    return result;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` ParallelExecutor instance is initialized.
+ *
+ * Post-Conditions:
+ *      Number of threads, the calling thread included, is returned.
+ *      No changes to `this`.
+ *
+ * Returns the number of threads running the ranges.
+ */
+int ParallelExecutor::threadCount() const {
+    return (int) workers.size() + 1;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` ParallelExecutor instance is initialized.
+ *      int of the number of tasks.
+ *      const reference to the task, called with each index.
+ *
+ * Post-Conditions:
+ *      The task is called once for each index from 0 to the count,
+ *      in any order, & all the calls are done.
+ *      The first exception thrown by a task is rethrown.
+ *
+ * A single task runs on the calling thread without waking the pool.
+ * The job lives on the stack of the caller, it is unposted only once
+ * every worker that took it has left it.
+ * Runs the given task for each index below the given count,
+ * on the pool & the calling thread.
+ */
+void ParallelExecutor::run(int tasks, const function<void(int)>& task) {
+    if (tasks <= 1 or workers.empty()) {
+        for (int i = 0; i < tasks; i++) {
+            task(i);
+        }
+
+        return;
+    }
+
+    lock_guard<mutex> serial(dispatch);
+    Job current{&task, tasks, {0}, 1, nullptr};
+
+    {
+        lock_guard<mutex> lock(state);
+
+        job = &current;
+        generation++;
+    }
+
+    posted.notify_all();
+    work(current);
+
+    unique_lock<mutex> lock(state);
+
+    current.users--;
+    finished.wait(lock, [&current]() { return not current.users; });
+    job = nullptr;
+
+    if (current.error) {
+        rethrow_exception(current.error);
+    }
+}
+
+/*
+ * Pre-Conditions:
+ *      Reference to the job posted by run.
+ *
+ * Post-Conditions:
+ *      Every index of the job is claimed, those claimed by the
+ *      calling thread are run.
+ *
+ * Runs the tasks of the given job until none is left.
+ */
+void ParallelExecutor::work(Job& current) {
+    for (int i = current.next++; i < current.tasks; i = current.next++) {
+        try {
+            (*current.task)(i);
+        } catch (...) {
+            lock_guard<mutex> lock(state);
+
+            if (not current.error) {
+                current.error = current_exception();
+            }
+        }
+    }
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` ParallelExecutor instance is initialized.
+ *
+ * Post-Conditions:
+ *      The jobs posted are helped with until `this` stops.
+ *
+ * A worker waking after its job was unposted waits for the next one.
+ * Body of the worker threads.
+ */
+void ParallelExecutor::serve() {
+    unsigned long long seen = 0;
+    unique_lock<mutex> lock(state);
+
+    for (;;) {
+        posted.wait(lock, [&]() {
+            return stopping or (job and generation != seen);
+        });
+
+        if (stopping) {
+            return;
+        }
+
+        Job& current = *job;
+
+        seen = generation;
+        current.users++;
+        lock.unlock();
+
+        work(current);
+
+        lock.lock();
+
+        if (not --current.users) {
+            finished.notify_all();
+        }
+    }
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` ParallelExecutor instance is initialized.
+ *      int of the length of a builder.
+ *
+ * Post-Conditions:
+ *      1 is returned below the serial length,
+ *      the number of threads otherwise.
+ *
+ * Returns the number of ranges a builder of the given length
+ * is split into.
+ */
+int ParallelExecutor::rangeCount(int length) const {
+    return length < serialLength ? 1 : threadCount();
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` ParallelExecutor instance is initialized.
+ *      Reference to the MyStringBuilder to change.
+ *      const reference to a MutableChunkVisitor, safe to call from
+ *      many threads at once.
+ *
+ * Post-Conditions:
+ *      The visitor is called with every character of the
+ *      MyStringBuilder exactly once, in chunks.
+ *      A reference to the MyStringBuilder is returned.
+ *
+ * The storage makes every chunk writable while they are listed,
+ * shared rope nodes are copied & original pieces moved to the add
+ * buffer, so the chunks stay valid until the next edit & the ranges
+ * write them without touching the storage.
+ * Calls the given visitor with every chunk of the given
+ * MyStringBuilder, from many threads.
+ */
+MyStringBuilder& ParallelExecutor::transformRanges(
+        MyStringBuilder& builder, const Storage::MutableChunkVisitor& visitor) {
+    const int total = builder.length();
+    const int ranges = rangeCount(total);
+
+    if (ranges == 1) {
+        builder.editable().forEachMutableChunk(0, total, visitor);
+        return builder;
+    }
+
+    vector<Chunk> chunks{};
+    int start = 0;
+
+    builder.editable().forEachMutableChunk(0, total, [&](char *data, int size) {
+        chunks.push_back(Chunk{data, size, start});
+        start += size;
+    });
+
+    run(ranges, [&](int range) {
+        visitRange(chunks, boundary(0, total, range, ranges),
+                   boundary(0, total, range + 1, ranges),
+                   [&visitor](const char *data, int size) {
+            /* Listed from writable chunks */
+            visitor(const_cast<char*>(data), size);
+            return true;
+        });
+    });
+
+    return builder;
+}
+
+/*
+ * Pre-Conditions:
+ *      const reference to the MyStringBuilder to list.
+ *
+ * Post-Conditions:
+ *      The chunks of the MyStringBuilder are returned in order,
+ *      valid until it changes.
+ *
+ * The chunks of the readers are never written through.
+ * Returns the chunks of the given MyStringBuilder.
+ */
+vector<ParallelExecutor::Chunk> ParallelExecutor::chunksOf(
+        const MyStringBuilder& builder) {
+    vector<Chunk> chunks{};
+    int start = 0;
+
+    builder.forEachChunk([&](const char *data, int size) {
+        chunks.push_back(Chunk{const_cast<char*>(data), size, start});
+        start += size;
+        return true;
+    });
+
+    return chunks;
+}
+
+/*
+ * Pre-Conditions:
+ *      const reference to the chunks of a builder.
+ *      begin & end are valid positions of the builder, begin <= end.
+ *      const reference to a ChunkVisitor.
+ *
+ * Post-Conditions:
+ *      The visitor is called, in order, with the parts of the chunks
+ *      between begin (inclusive) & end (exclusive), until it
+ *      returns false.
+ *      Returns false if the visitor stopped the visit.
+ *
+ * The chunk holding begin is found by binary search on the starts.
+ * Calls the visitor with the parts of the chunks between
+ * the given positions.
+ */
+bool ParallelExecutor::visitRange(const vector<Chunk>& chunks, int begin,
+                                  int end, const Storage::ChunkVisitor& visitor) {
+    auto chunk = upper_bound(chunks.begin(), chunks.end(), begin,
+                             [](int position, const Chunk& other) {
+        return position < other.start;
+    });
+
+    /* Empty chunks before begin are skipped, the one holding it is kept */
+    if (chunk != chunks.begin()) {
+        --chunk;
+    }
+
+    for (; chunk != chunks.end() and chunk->start < end; ++chunk) {
+        const int from = max(begin, chunk->start);
+        const int until = min(end, chunk->start + chunk->count);
+
+        if (from < until and not visitor(chunk->data + from - chunk->start,
+                                         until - from)) {
+            return false;
+        }
+    }
+
+    return true;
+}
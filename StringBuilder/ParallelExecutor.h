@@ -0,0 +1,437 @@
+/*
+ * StringBuilder Project
+ *
+ *
+ * ParallelExecutor.h
+ *
+ * Date:        17/10/2026
+ *
+ * Author:      Mahmoud Yaman Seraj Alddin
+ *
+ * Purpose:     Header file for the ParallelExecutor class,
+ *              a thread pool running the bulk transforms & scans of
+ *              large MyStringBuilder instances on all the cores.
+ *
+ * List of public Functions:
+ *      ParallelExecutor(int threads = 0, int serialLength = kSerialLength)
+ *          Parameterized constructor of the ParallelExecutor class.
+ *
+ *      ~ParallelExecutor()
+ *          Destructor for the ParallelExecutor class.
+ *
+ *      MyStringBuilder& toUpperCase(MyStringBuilder&)
+ *          Changes all the characters of the given MyStringBuilder to
+ *          upper case.
+ *
+ *      MyStringBuilder& toLowerCase(MyStringBuilder&)
+ *          Changes all the characters of the given MyStringBuilder to
+ *          lower case.
+ *
+ *      MyStringBuilder& swapCase(MyStringBuilder&)
+ *          Swaps the case of all the characters of the given
+ *          MyStringBuilder.
+ *
+ *      MyStringBuilder& transform(MyStringBuilder&, const ByteTable&)
+ *          Replaces each character of the given MyStringBuilder by its
+ *          entry in the given table.
+ *
+ *      long long count(const MyStringBuilder&, char)
+ *          Returns the number of occurrences of the given character.
+ *
+ *      unsigned long long hash(const MyStringBuilder&)
+ *          Returns the hash of the characters of the given MyStringBuilder.
+ *
+ *      int indexOf(const MyStringBuilder&, const std::string&,
+ *                  int fromIndex = 0)
+ *          Returns the position of the first occurrence of the given string,
+ *          starting the search at fromIndex.
+ *
+ *      std::string toString(const MyStringBuilder&)
+ *          Returns a string of the characters of the given MyStringBuilder.
+ *
+ *      int threadCount() const
+ *          Returns the number of threads running the ranges.
+ *
+ * List of private Functions:
+ *      void run(int, const std::function<void(int)>&)
+ *          Runs the given task for each index below the given count,
+ *          on the pool & the calling thread.
+ *
+ *      void work(Job&)
+ *          Runs the tasks of the given job until none is left.
+ *
+ *      void serve()
+ *          Body of the worker threads.
+ *
+ *      int rangeCount(int) const
+ *          Returns the number of ranges a builder of the given length
+ *          is split into.
+ *
+ *      MyStringBuilder& transformRanges(MyStringBuilder&,
+ *                                       const Storage::MutableChunkVisitor&)
+ *          Calls the given visitor with every chunk of the given
+ *          MyStringBuilder, from many threads.
+ *
+ *      static std::vector<Chunk> chunksOf(const MyStringBuilder&)
+ *          Returns the chunks of the given MyStringBuilder.
+ *
+ *      static bool visitRange(const std::vector<Chunk>&, int, int,
+ *                             const Storage::ChunkVisitor&)
+ *          Calls the visitor with the parts of the chunks between
+ *          the given positions.
+ */
+
+#ifndef MYSTRINGBUILDER_PARALLELEXECUTOR_H
+#define MYSTRINGBUILDER_PARALLELEXECUTOR_H
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "MyStringBuilder.h"
+
+/*
+ * ParallelExecutor splits a MyStringBuilder into as many ranges of
+ * equal length as it has threads, runs a transform or a scan on each
+ * range at once, then merges the results of the ranges in order.
+ * The chunks of the storage are listed once, by the calling thread,
+ * so the ranges are read without touching the storage, whatever its
+ * mode; the transforms only write inside their range.
+ * Builders shorter than the serial length are run on the calling
+ * thread alone, where starting the pool costs more than it saves.
+ * The pool runs one operation at a time, calls from many threads wait
+ * for each other.
+ */
+class ParallelExecutor {
+public:
+    /* Shortest builder split into ranges */
+    static const int kSerialLength = 1 << 20;
+
+    /* Odd multiplier of the polynomial hash */
+    static const unsigned long long kHashBase = 0x100000001B3ULL;
+
+    /*
+     * Pre-Conditions:
+     *      int of the number of threads (optional), counting the calling
+     *      thread, 0 for one per core, default is 0.
+     *      int of the shortest builder split into ranges (optional),
+     *      default is kSerialLength.
+     *
+     * Post-Conditions:
+     *      A ParallelExecutor instance is created, its worker threads
+     *      started & waiting.
+     *
+     * Parameterized constructor of the ParallelExecutor class.
+     */
+    explicit ParallelExecutor(int threads = 0,
+                              int serialLength = kSerialLength);
+
+    /* The workers keep a pointer to `this`, no copies */
+    ParallelExecutor(const ParallelExecutor&) = delete;
+
+    ParallelExecutor& operator=(const ParallelExecutor&) = delete;
+
+    /*
+     * Pre-Conditions:
+     *      `this` ParallelExecutor instance is not destroyed.
+     *      No operation is running.
+     *
+     * Post-Conditions:
+     *      The worker threads are joined.
+     *      `this` ParallelExecutor instance is destroyed.
+     *
+     * Destructor for the ParallelExecutor class.
+     */
+    ~ParallelExecutor();
+
+    /*
+     * Pre-Conditions:
+     *      `this` ParallelExecutor instance is initialized.
+     *      Reference to the MyStringBuilder to change.
+     *
+     * Post-Conditions:
+     *      The characters of the MyStringBuilder are all in upper case.
+     *      A reference to the MyStringBuilder is returned.
+     *
+     * Changes all the characters of the given MyStringBuilder to
+     * upper case.
+     */
+    MyStringBuilder& toUpperCase(MyStringBuilder&);
+
+    /*
+     * Pre-Conditions:
+     *      `this` ParallelExecutor instance is initialized.
+     *      Reference to the MyStringBuilder to change.
+     *
+     * Post-Conditions:
+     *      The characters of the MyStringBuilder are all in lower case.
+     *      A reference to the MyStringBuilder is returned.
+     *
+     * Changes all the characters of the given MyStringBuilder to
+     * lower case.
+     */
+    MyStringBuilder& toLowerCase(MyStringBuilder&);
+
+    /*
+     * Pre-Conditions:
+     *      `this` ParallelExecutor instance is initialized.
+     *      Reference to the MyStringBuilder to change.
+     *
+     * Post-Conditions:
+     *      The case of the letters of the MyStringBuilder is swapped.
+     *      A reference to the MyStringBuilder is returned.
+     *
+     * Swaps the case of all the characters of the given MyStringBuilder.
+     */
+    MyStringBuilder& swapCase(MyStringBuilder&);
+
+    /*
+     * Pre-Conditions:
+     *      `this` ParallelExecutor instance is initialized.
+     *      Reference to the MyStringBuilder to change.
+     *      const reference to the table of replacements.
+     *
+     * Post-Conditions:
+     *      Each character c of the MyStringBuilder is replaced by
+     *      table[(unsigned char) c].
+     *      A reference to the MyStringBuilder is returned.
+     *
+     * Replaces each character of the given MyStringBuilder by its
+     * entry in the given table.
+     */
+    MyStringBuilder& transform(MyStringBuilder&, const ByteTable&);
+
+    /*
+     * Pre-Conditions:
+     *      `this` ParallelExecutor instance is initialized.
+     *      const reference to the MyStringBuilder to scan.
+     *      The character to count.
+     *
+     * Post-Conditions:
+     *      Number of occurrences of the character is returned.
+     *      No changes to the MyStringBuilder.
+     *
+     * Returns the number of occurrences of the given character.
+     */
+    [[nodiscard]] long long count(const MyStringBuilder&, char);
+
+    /*
+     * Pre-Conditions:
+     *      `this` ParallelExecutor instance is initialized.
+     *      const reference to the MyStringBuilder to hash.
+     *
+     * Post-Conditions:
+     *      The polynomial hash of the characters, modulo 2^64, is returned.
+     *      Equal characters hash equally whatever the mode of the
+     *      builders & the number of threads.
+     *      No changes to the MyStringBuilder.
+     *
+     * Not a cryptographic hash.
+     * Returns the hash of the characters of the given MyStringBuilder.
+     */
+    [[nodiscard]] unsigned long long hash(const MyStringBuilder&);
+
+    /*
+     * Pre-Conditions:
+     *      `this` ParallelExecutor instance is initialized.
+     *      const reference to the MyStringBuilder to search.
+     *      const reference to the string to search for.
+     *      int of the position to start from (optional), default is 0.
+     *
+     * Post-Conditions:
+     *      The position of the first occurrence starting at or after
+     *      fromIndex is returned, -1 if there is none.
+     *      Like MyStringBuilder::indexOf, fromIndex is clamped to
+     *      [0, length()].
+     *      No changes to the MyStringBuilder.
+     *
+     * Returns the position of the first occurrence of the given string,
+     * starting the search at fromIndex.
+     */
+    [[nodiscard]] int indexOf(const MyStringBuilder&, const std::string&,
+                              int fromIndex = 0);
+
+    /*
+     * Pre-Conditions:
+     *      `this` ParallelExecutor instance is initialized.
+     *      const reference to the MyStringBuilder to copy.
+     *
+     * Post-Conditions:
+     *      A string of the characters of the MyStringBuilder is returned.
+     *      No changes to the MyStringBuilder.
+     *
+     * Returns a string of the characters of the given MyStringBuilder.
+     */
+    [[nodiscard]] std::string toString(const MyStringBuilder&);
+
+    /*
+     * Pre-Conditions:
+     *      `this` ParallelExecutor instance is initialized.
+     *
+     * Post-Conditions:
+     *      Number of threads, the calling thread included, is returned.
+     *      No changes to `this`.
+     *
+     * Returns the number of threads running the ranges.
+     */
+    [[nodiscard]] int threadCount() const;
+
+private:
+    /*
+     * Run of characters of a storage.
+     * start is the position of its first character in the builder.
+     */
+    struct Chunk {
+        char *data;
+        int count;
+        int start;
+    };
+
+    /*
+     * Operation handed to the pool.
+     * Each thread claims the next index until all are claimed.
+     * users counts the threads inside work, guarded by state.
+     */
+    struct Job {
+        const std::function<void(int)> *task;
+        int tasks;
+        std::atomic<int> next;
+        int users;
+        std::exception_ptr error;
+    };
+
+    /*
+     * Pre-Conditions:
+     *      `this` ParallelExecutor instance is initialized.
+     *      int of the number of tasks.
+     *      const reference to the task, called with each index.
+     *
+     * Post-Conditions:
+     *      The task is called once for each index from 0 to the count,
+     *      in any order, & all the calls are done.
+     *      The first exception thrown by a task is rethrown.
+     *
+     * Runs the given task for each index below the given count,
+     * on the pool & the calling thread.
+     */
+    void run(int, const std::function<void(int)>&);
+
+    /*
+     * Pre-Conditions:
+     *      Reference to the job posted by run.
+     *
+     * Post-Conditions:
+     *      Every index of the job is claimed, those claimed by the
+     *      calling thread are run.
+     *
+     * Runs the tasks of the given job until none is left.
+     */
+    void work(Job&);
+
+    /*
+     * Pre-Conditions:
+     *      `this` ParallelExecutor instance is initialized.
+     *
+     * Post-Conditions:
+     *      The jobs posted are helped with until `this` stops.
+     *
+     * Body of the worker threads.
+     */
+    void serve();
+
+    /*
+     * Pre-Conditions:
+     *      `this` ParallelExecutor instance is initialized.
+     *      int of the length of a builder.
+     *
+     * Post-Conditions:
+     *      1 is returned below the serial length,
+     *      the number of threads otherwise.
+     *
+     * Returns the number of ranges a builder of the given length
+     * is split into.
+     */
+    [[nodiscard]] int rangeCount(int) const;
+
+    /*
+     * Pre-Conditions:
+     *      `this` ParallelExecutor instance is initialized.
+     *      Reference to the MyStringBuilder to change.
+     *      const reference to a MutableChunkVisitor, safe to call from
+     *      many threads at once.
+     *
+     * Post-Conditions:
+     *      The visitor is called with every character of the
+     *      MyStringBuilder exactly once, in chunks.
+     *      A reference to the MyStringBuilder is returned.
+     *
+     * Calls the given visitor with every chunk of the given
+     * MyStringBuilder, from many threads.
+     */
+    MyStringBuilder& transformRanges(MyStringBuilder&,
+                                     const Storage::MutableChunkVisitor&);
+
+    /*
+     * Pre-Conditions:
+     *      const reference to the MyStringBuilder to list.
+     *
+     * Post-Conditions:
+     *      The chunks of the MyStringBuilder are returned in order,
+     *      valid until it changes.
+     *
+     * Returns the chunks of the given MyStringBuilder.
+     */
+    [[nodiscard]] static std::vector<Chunk> chunksOf(const MyStringBuilder&);
+
+    /*
+     * Pre-Conditions:
+     *      const reference to the chunks of a builder.
+     *      begin & end are valid positions of the builder, begin <= end.
+     *      const reference to a ChunkVisitor.
+     *
+     * Post-Conditions:
+     *      The visitor is called, in order, with the parts of the chunks
+     *      between begin (inclusive) & end (exclusive), until it
+     *      returns false.
+     *      Returns false if the visitor stopped the visit.
+     *
+     * Calls the visitor with the parts of the chunks between
+     * the given positions.
+     */
+    static bool visitRange(const std::vector<Chunk>&, int /* begin */,
+                           int /* end */, const Storage::ChunkVisitor&);
+
+    /* Shortest builder split into ranges */
+    const int serialLength;
+
+    /* Threads of the pool, the calling thread is not one of them */
+    std::vector<std::thread> workers;
+
+    /* Lets one operation at a time use the pool */
+    std::mutex dispatch;
+
+    /* Guards job, generation, stopping & the users of the jobs */
+    std::mutex state;
+
+    /* Signaled when a job is posted or `this` stops */
+    std::condition_variable posted;
+
+    /* Signaled when a worker leaves a job */
+    std::condition_variable finished;
+
+    /* Job being run, nullptr between jobs */
+    Job *job;
+
+    /* Number of jobs posted, tells the workers a job is new */
+    unsigned long long generation;
+
+    /* Set by the destructor to stop the workers */
+    bool stopping;
+};
+
+#endif /* MYSTRINGBUILDER_PARALLELEXECUTOR_H */
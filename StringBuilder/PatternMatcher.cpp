@@ -0,0 +1,352 @@
+/*
+ * StringBuilder Project
+ *
+ *
+ * PatternMatcher.cpp
+ *
+ * Date:        17/10/2026
+ *
+ * Author:      Mahmoud Yaman Seraj Alddin
+ *
+ * Purpose:     Implementation of the PatternMatcher class,
+ *              described in PatternMatcher.h
+ *
+ * List of public Functions:
+ *      PatternMatcher(const std::vector<std::string>&)
+ *          Parameterized constructor of the PatternMatcher class.
+ *
+ *      std::vector<Match> scan(const MyStringBuilder&) const
+ *          Returns the matches of all the patterns in the given
+ *          MyStringBuilder.
+ *
+ *      std::vector<BuilderMatch> scanAll(const Builders&,
+ *                                        bool parallel = false) const
+ *          Returns the matches of all the patterns in each of the
+ *          given MyStringBuilders.
+ *
+ *      int patternCount() const
+ *          Returns the number of patterns.
+ *
+ *      int stateCount() const
+ *          Returns the number of states of the automaton.
+ *
+ * List of private Functions:
+ *      void report(int, int, std::vector<Match>&) const
+ *          Appends the matches of the patterns ending in the given state.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <stdexcept>
+#include <thread>
+
+#include "PatternMatcher.h"
+
+using namespace std;
+
+/*
+ * Pre-Conditions:
+ *      const reference to the patterns, may hold duplicates.
+ *
+ * Post-Conditions:
+ *      A PatternMatcher instance for the given patterns is created.
+ *      Empty patterns are kept in the numbering but never match.
+ *      A length_error exception is thrown if the transition table
+ *      exceeds INT_MAX entries.
+ *
+ * The patterns are inserted in a trie, then the failure links are
+ * computed breadth first & folded into the missing transitions,
+ * so scanning takes exactly one table lookup per character.
+ * Parameterized constructor of the PatternMatcher class.
+ */
+PatternMatcher::PatternMatcher(const vector<string>& patterns)
+        : columns{}, width{1}, transitions{}, firstAccepting{0},
+          terminal{}, outputs{}, duplicates(patterns.size(), -1),
+          lengths(patterns.size()) {
+    /* Give a column to each byte used by a pattern */
+    for (const auto& pattern: patterns) {
+        for (const char c: pattern) {
+            int& column = columns[(unsigned char) c];
+
+            if (not column) {
+                column = width++;
+            }
+        }
+    }
+
+    /* Trie, 0 marks a missing child as the root is nobody's child */
+    vector<int> trie(width, 0);
+    terminal.push_back(-1);
+
+    for (int id = 0; id < (int) patterns.size(); id++) {
+        int state = 0;
+
+        lengths[id] = (int) patterns[id].size();
+
+        for (const char c: patterns[id]) {
+            const int column = columns[(unsigned char) c];
+
+            if (not trie[state * width + column]) {
+                /* Checked before growing, the indices would overflow int */
+                if ((long long) (terminal.size() + 1) * width > INT_MAX) {
+                    throw length_error("Too many patterns, the transition "
+                                       "table exceeds " + to_string(INT_MAX)
+                                       + " entries");
+                }
+
+                trie[state * width + column] = (int) terminal.size();
+                trie.resize(trie.size() + width, 0);
+                terminal.push_back(-1);
+            }
+
+            state = trie[state * width + column];
+        }
+
+        if (not state) {
+            continue;
+        }
+
+        /* Duplicates are chained after the first pattern, in order */
+        if (terminal[state] == -1) {
+            terminal[state] = id;
+        } else {
+            int last = terminal[state];
+
+            while (duplicates[last] != -1) {
+                last = duplicates[last];
+            }
+
+            duplicates[last] = id;
+        }
+    }
+
+    const int states = (int) terminal.size();
+    vector<int> failures(states, 0);
+    vector<int> order{0};
+
+    outputs.assign(states, 0);
+
+    /* Breadth first, a failure is always shallower than its state */
+    for (int i = 0; i < (int) order.size(); i++) {
+        const int state = order[i];
+
+        for (int column = 0; column < width; column++) {
+            int& next = trie[state * width + column];
+            const int fallback = state ? trie[failures[state] * width + column]
+                                       : 0;
+
+            if (not next) {
+                next = fallback;
+                continue;
+            }
+
+            failures[next] = fallback;
+            outputs[next] = terminal[fallback] != -1 ? fallback
+                                                     : outputs[fallback];
+            order.push_back(next);
+        }
+    }
+
+    /*
+     * Renumber the states breadth first, so the shallow states visited
+     * most are adjacent in memory, with the accepting states last,
+     * so a single comparison detects them.
+     */
+    vector<int> numbers(states);
+    vector<int> renumbered{};
+    int number = 0;
+
+    for (const bool accepting: {false, true}) {
+        for (const int state: order) {
+            if ((terminal[state] != -1 or outputs[state]) == accepting) {
+                numbers[state] = number++;
+                renumbered.push_back(state);
+            }
+        }
+
+        if (not accepting) {
+            firstAccepting = number * width;
+        }
+    }
+
+    transitions.resize(trie.size());
+
+    vector<int> terminals(states);
+    vector<int> links(states);
+
+    for (int state = 0; state < states; state++) {
+        const int old = renumbered[state];
+
+        for (int column = 0; column < width; column++) {
+            transitions[state * width + column] =
+                    numbers[trie[old * width + column]] * width;
+        }
+
+        terminals[state] = terminal[old];
+        links[state] = numbers[outputs[old]];
+    }
+
+    terminal = std::move(terminals);
+    outputs = std::move(links);
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` PatternMatcher instance is initialized.
+ *      const reference to the MyStringBuilder to scan.
+ *
+ * Post-Conditions:
+ *      The matches are returned ordered by their last character,
+ *      then by decreasing length.
+ *      No changes to `this` or the MyStringBuilder.
+ *
+ * The inner loop is one table lookup & one comparison per character,
+ * the matches are only decoded in the rare accepting states.
+ * Returns the matches of all the patterns in the given
+ * MyStringBuilder.
+ */
+vector<PatternMatcher::Match> PatternMatcher::scan(
+        const MyStringBuilder& builder) const {
+    vector<Match> result;
+    const int *table = transitions.data();
+    int row = 0;
+    int position = 0;
+
+    builder.forEachChunk([&](const char *data, int size) {
+        for (int i = 0; i < size; i++) {
+            row = table[row + columns[(unsigned char) data[i]]];
+
+            if (firstAccepting <= row) {
+                report(row / width, position + i, result);
+            }
+        }
+
+        position += size;
+        return true;
+    });
+
+    return result;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` PatternMatcher instance is initialized.
+ *      const reference to the MyStringBuilders to scan.
+ *      bool to scan the MyStringBuilders on all the cores
+ *      (optional), default is false.
+ *
+ * Post-Conditions:
+ *      The matches are returned grouped by MyStringBuilder, in the
+ *      order of the registry, each group ordered as by scan.
+ *      The result does not depend on parallel.
+ *      No changes to `this` or the MyStringBuilders.
+ *
+ * In parallel, each thread takes the next unscanned MyStringBuilder,
+ * so one MyStringBuilder is only read by one thread at a time.
+ * A single large MyStringBuilder is still scanned by one thread.
+ * Returns the matches of all the patterns in each of the
+ * given MyStringBuilders.
+ */
+vector<PatternMatcher::BuilderMatch> PatternMatcher::scanAll(
+        const Builders& builders, bool parallel) const {
+    vector<const Builders::value_type*> entries;
+
+    for (const auto& entry: builders) {
+        entries.push_back(&entry);
+    }
+
+    vector<vector<Match>> found(entries.size());
+    atomic<int> next{0};
+
+    auto work = [&]() {
+        for (int i = next++; i < (int) entries.size(); i = next++) {
+            found[i] = scan(entries[i]->second);
+        }
+    };
+
+    const int threads = parallel
+            ? min((int) entries.size(),
+                  max(1, (int) thread::hardware_concurrency()))
+            : 1;
+
+    vector<thread> workers;
+
+    for (int i = 1; i < threads; i++) {
+        workers.emplace_back(work);
+    }
+
+    work();
+
+    for (auto& worker: workers) {
+        worker.join();
+    }
+
+    vector<BuilderMatch> result;
+
+    for (int i = 0; i < (int) entries.size(); i++) {
+        for (const auto& match: found[i]) {
+            result.push_back({entries[i]->first, match.offset, match.pattern});
+        }
+    }
+
+    return result;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` PatternMatcher instance is initialized.
+ *
+ * Post-Conditions:
+ *      Number of patterns is returned, empty ones included.
+ *      No changes to `this`.
+ *
+ * Returns the number of patterns.
+ */
+int PatternMatcher::patternCount() const {
+    return (int) lengths.size();
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` PatternMatcher instance is initialized.
+ *
+ * Post-Conditions:
+ *      Number of states of the automaton is returned,
+ *      the root included.
+ *      No changes to `this`.
+ *
+ * Returns the number of states of the automaton.
+ */
+int PatternMatcher::stateCount() const {
+    return (int) terminal.size();
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` PatternMatcher instance is initialized.
+ *      int of an accepting state.
+ *      int of the position of the last character read.
+ *      Reference to the vector of matches.
+ *
+ * Post-Conditions:
+ *      The matches of the patterns ending in the state are appended,
+ *      longest first.
+ *      No changes to `this`.
+ *
+ * Follows the output links, which only visit states with a pattern,
+ * so the cost is proportional to the number of matches.
+ * Appends the matches of the patterns ending in the given state.
+ */
+void PatternMatcher::report(int state, int position,
+                            vector<Match>& result) const {
+    if (terminal[state] == -1) {
+        state = outputs[state];
+    }
+
+    for (; state; state = outputs[state]) {
+        for (int id = terminal[state]; id != -1; id = duplicates[id]) {
+            result.push_back({position - lengths[id] + 1, id});
+        }
+    }
+}
@@ -0,0 +1,206 @@
+/*
+ * StringBuilder Project
+ *
+ *
+ * PatternMatcher.h
+ *
+ * Date:        17/10/2026
+ *
+ * Author:      Mahmoud Yaman Seraj Alddin
+ *
+ * Purpose:     Header file for the PatternMatcher class,
+ *              an Aho-Corasick automaton finding many patterns
+ *              in MyStringBuilder instances at once.
+ *
+ * List of public Functions:
+ *      PatternMatcher(const std::vector<std::string>&)
+ *          Parameterized constructor of the PatternMatcher class.
+ *
+ *      std::vector<Match> scan(const MyStringBuilder&) const
+ *          Returns the matches of all the patterns in the given
+ *          MyStringBuilder.
+ *
+ *      std::vector<BuilderMatch> scanAll(const Builders&,
+ *                                        bool parallel = false) const
+ *          Returns the matches of all the patterns in each of the
+ *          given MyStringBuilders.
+ *
+ *      int patternCount() const
+ *          Returns the number of patterns.
+ *
+ *      int stateCount() const
+ *          Returns the number of states of the automaton.
+ *
+ * List of private Functions:
+ *      void report(int, int, std::vector<Match>&) const
+ *          Appends the matches of the patterns ending in the given state.
+ */
+
+#ifndef MYSTRINGBUILDER_PATTERNMATCHER_H
+#define MYSTRINGBUILDER_PATTERNMATCHER_H
+
+#include <array>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "MyStringBuilder.h"
+
+/*
+ * PatternMatcher compiles a dictionary of patterns into a deterministic
+ * Aho-Corasick automaton, then finds all their occurrences, overlapping
+ * ones included, in a single pass over the chunks of a MyStringBuilder.
+ * The state is carried from one chunk to the next, so the matches
+ * straddling chunks need no extra work.
+ * Bytes absent from every pattern share one column of the transition
+ * table, which keeps the table small for large dictionaries.
+ * An empty pattern is accepted so the indices of the others are kept,
+ * but it never matches, not even at offset 0.
+ * A compiled PatternMatcher is read-only, it may scan from many threads.
+ */
+class PatternMatcher {
+public:
+    /* Type alias for the registry of named MyStringBuilders of the CLI */
+    typedef std::map<std::string, MyStringBuilder> Builders;
+
+    /*
+     * Occurrence of a pattern in a MyStringBuilder.
+     * offset is the position of its first character,
+     * pattern its index in the dictionary.
+     */
+    struct Match {
+        int offset;
+        int pattern;
+    };
+
+    /*
+     * Occurrence of a pattern in one of the MyStringBuilders of a registry.
+     * builder is the identifier of the MyStringBuilder.
+     */
+    struct BuilderMatch {
+        std::string builder;
+        int offset;
+        int pattern;
+    };
+
+    /*
+     * Pre-Conditions:
+     *      const reference to the patterns, may hold duplicates.
+     *
+     * Post-Conditions:
+     *      A PatternMatcher instance for the given patterns is created.
+     *      Empty patterns are kept in the numbering but never match.
+     *      A length_error exception is thrown if the transition table
+     *      exceeds INT_MAX entries.
+     *
+     * Parameterized constructor of the PatternMatcher class.
+     */
+    explicit PatternMatcher(const std::vector<std::string>&);
+
+    /*
+     * Pre-Conditions:
+     *      `this` PatternMatcher instance is initialized.
+     *      const reference to the MyStringBuilder to scan.
+     *
+     * Post-Conditions:
+     *      The matches are returned ordered by their last character,
+     *      then by decreasing length.
+     *      No changes to `this` or the MyStringBuilder.
+     *
+     * Returns the matches of all the patterns in the given
+     * MyStringBuilder.
+     */
+    [[nodiscard]] std::vector<Match> scan(const MyStringBuilder&) const;
+
+    /*
+     * Pre-Conditions:
+     *      `this` PatternMatcher instance is initialized.
+     *      const reference to the MyStringBuilders to scan.
+     *      bool to scan the MyStringBuilders on all the cores
+     *      (optional), default is false.
+     *
+     * Post-Conditions:
+     *      The matches are returned grouped by MyStringBuilder, in the
+     *      order of the registry, each group ordered as by scan.
+     *      The result does not depend on parallel.
+     *      No changes to `this` or the MyStringBuilders.
+     *
+     * Returns the matches of all the patterns in each of the
+     * given MyStringBuilders.
+     */
+    [[nodiscard]] std::vector<BuilderMatch> scanAll(const Builders&,
+                                                    bool parallel = false) const;
+
+    /*
+     * Pre-Conditions:
+     *      `this` PatternMatcher instance is initialized.
+     *
+     * Post-Conditions:
+     *      Number of patterns is returned, empty ones included.
+     *      No changes to `this`.
+     *
+     * Returns the number of patterns.
+     */
+    [[nodiscard]] int patternCount() const;
+
+    /*
+     * Pre-Conditions:
+     *      `this` PatternMatcher instance is initialized.
+     *
+     * Post-Conditions:
+     *      Number of states of the automaton is returned,
+     *      the root included.
+     *      No changes to `this`.
+     *
+     * Returns the number of states of the automaton.
+     */
+    [[nodiscard]] int stateCount() const;
+
+private:
+    /*
+     * Pre-Conditions:
+     *      `this` PatternMatcher instance is initialized.
+     *      int of an accepting state.
+     *      int of the position of the last character read.
+     *      Reference to the vector of matches.
+     *
+     * Post-Conditions:
+     *      The matches of the patterns ending in the state are appended,
+     *      longest first.
+     *      No changes to `this`.
+     *
+     * Appends the matches of the patterns ending in the given state.
+     */
+    void report(int /* state */, int /* position */,
+                std::vector<Match>&) const;
+
+    /* Column of each byte in the transition table, indexed as unsigned char */
+    std::array<int, 256> columns;
+
+    /* Number of columns, bytes absent from every pattern share column 0 */
+    int width;
+
+    /*
+     * Transition table, row of a state then column of a byte.
+     * An entry holds the row offset of the next state, state * width.
+     * The states are numbered breadth first, accepting states last.
+     */
+    std::vector<int> transitions;
+
+    /* Row offset of the first accepting state */
+    int firstAccepting;
+
+    /* First pattern ending exactly at each state, -1 if none */
+    std::vector<int> terminal;
+
+    /* Nearest proper suffix state with a terminal pattern, 0 if none */
+    std::vector<int> outputs;
+
+    /* Next pattern equal to each pattern, -1 if none */
+    std::vector<int> duplicates;
+
+    /* Length of each pattern */
+    std::vector<int> lengths;
+};
+
+#endif /* MYSTRINGBUILDER_PATTERNMATCHER_H */
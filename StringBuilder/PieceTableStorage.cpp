@@ -0,0 +1,664 @@
+/*
+ * StringBuilder Project
+ *
+ *
+ * PieceTableStorage.cpp
+ *
+ * Date:        17/10/2026
+ *
+ * Author:      Mahmoud Yaman Seraj Alddin
+ *
+ * Purpose:     Implementation of the PieceTableStorage class,
+ *              described in PieceTableStorage.h
+ *
+ * List of public Functions:
+ *      PieceTableStorage()
+ *          No-arg constructor of the PieceTableStorage class.
+ *
+ *      PieceTableStorage(const char*, int)
+ *          Parameterized constructor of the PieceTableStorage class.
+ *
+ *      PieceTableStorage(std::string&&)
+ *          Parameterized constructor of the PieceTableStorage class.
+ *          Adopts the given string as the original buffer.
+ *
+ *      PieceTableStorage(std::shared_ptr<const MappedFile>)
+ *          Parameterized constructor of the PieceTableStorage class.
+ *          Uses the characters of the given file as the original buffer.
+ *
+ *      Storage* copy(int begin, int end) const
+ *          Returns a new PieceTableStorage holding a copy of the characters
+ *          between begin (inclusive) & end (exclusive).
+ *
+ *      int length() const
+ *          Returns the number of characters in the table.
+ *
+ *      char charAt(int) const
+ *          Returns the character at the given position.
+ *
+ *      void insert(int, const char*, int)
+ *          Inserts a copy of the given characters at the given position.
+ *
+ *      void insert(int, const Storage&)
+ *          Inserts a copy of the characters of the given Storage at the
+ *          given position.
+ *
+ *      void splice(int, Storage&)
+ *          Moves the characters of the given Storage to the given position,
+ *          leaving the given Storage empty.
+ *
+ *      void erase(int begin, int end)
+ *          Removes the characters between begin (inclusive)
+ *          & end (exclusive).
+ *
+ *      bool forEachChunk(int begin, int end, const ChunkVisitor&) const
+ *          Visits the characters between begin & end as contiguous chunks.
+ *
+ *      void forEachMutableChunk(int begin, int end,
+ *                               const MutableChunkVisitor&)
+ *          Visits the characters between begin & end as writable
+ *          contiguous chunks.
+ *
+ *      char* reserveTail(int&)
+ *          Returns the free room after the last character, or nullptr.
+ *
+ *      void commitTail(int)
+ *          Appends the given count of characters written to the
+ *          reserved tail.
+ *
+ * List of private Functions:
+ *      const char* text(const Piece&) const
+ *          Returns a pointer to the first character of the given piece.
+ *
+ *      std::pair<int, int> find(int) const
+ *          Returns the index of the piece holding the given position
+ *          & the offset of the position in that piece.
+ *
+ *      int splitAt(int)
+ *          Makes the given position fall on a piece boundary,
+ *          returns the index of the piece starting at it.
+ *
+ *      void append(int, int, int)
+ *          Inserts a piece of the add buffer at the given position.
+ */
+
+#include <algorithm>
+
+#include "PieceTableStorage.h"
+
+using namespace std;
+
+/*
+ * Pre-Conditions:
+ *      No preconditions.
+ *
+ * Post-Conditions:
+ *      An empty PieceTableStorage instance is created.
+ *      pieces is empty.
+ *      size is initialized to 0.
+ *
+ * No-arg constructor of the PieceTableStorage class.
+ */
+PieceTableStorage::PieceTableStorage():
+        mapping{}, pieces{}, size{0}, reserved{0} {}
+
+/*
+ * Pre-Conditions:
+ *      Pointer to the characters to copy & their count.
+ *
+ * Post-Conditions:
+ *      A PieceTableStorage instance is created.
+ *      original holds the given characters, as a single piece.
+ *
+ * The characters are copied once, into the original buffer,
+ * later edits never copy them again.
+ * Parameterized constructor of the PieceTableStorage class.
+ */
+PieceTableStorage::PieceTableStorage(const char *data, int count):
+        original(data, count), pieces{}, size{count}, reserved{0} {
+    if (0 < count) {
+        pieces.insert(0, Piece{false, 0, count}, count);
+    }
+}
+
+/*
+ * Pre-Conditions:
+ *      rvalue reference to the string to adopt.
+ *
+ * Post-Conditions:
+ *      A PieceTableStorage instance is created.
+ *      original is the given string, as a single piece,
+ *      its characters are not copied.
+ *      The given string is left empty.
+ *
+ * The original buffer is never written after construction,
+ * so the string is taken as is.
+ * Parameterized constructor of the PieceTableStorage class.
+ * Adopts the given string as the original buffer.
+ */
+PieceTableStorage::PieceTableStorage(string&& s):
+        original{std::move(s)}, pieces{}, size{0}, reserved{0} {
+    size = (int) original.size();
+    s.clear();
+
+    if (0 < size) {
+        pieces.insert(0, Piece{false, 0, size}, size);
+    }
+}
+
+/*
+ * Pre-Conditions:
+ *      Shared pointer to a MappedFile, not nullptr.
+ *
+ * Post-Conditions:
+ *      A PieceTableStorage instance is created.
+ *      The characters of the file are the original buffer,
+ *      as a single piece, they are not copied.
+ *
+ * The pages of the file are only read when visited, so the table
+ * is built in O(1) whatever the size of the file.
+ * Parameterized constructor of the PieceTableStorage class.
+ * Uses the characters of the given file as the original buffer.
+ */
+PieceTableStorage::PieceTableStorage(shared_ptr<const MappedFile> file):
+        mapping{std::move(file)}, pieces{}, size{0}, reserved{0} {
+    size = mapping->size();
+
+    if (0 < size) {
+        pieces.insert(0, Piece{false, 0, size}, size);
+    }
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` PieceTableStorage instance is initialized.
+ *      begin & end are valid positions, begin <= end.
+ *
+ * Post-Conditions:
+ *      A heap allocated PieceTableStorage is returned,
+ *      whose original buffer holds the copied characters,
+ *      or shares the mapped file of `this`.
+ *      No changes to `this`.
+ *
+ * A mapped table shares its file with the copy, only the pieces
+ * & the inserted characters in the range are copied.
+ * Returns a new PieceTableStorage holding a copy of the characters
+ * between begin (inclusive) & end (exclusive).
+ */
+Storage* PieceTableStorage::copy(int begin, int end) const {
+    auto result = new PieceTableStorage();
+
+    if (mapping) {
+        result->mapping = mapping;
+        result->size = end - begin;
+
+        if (end <= begin) {
+            return result;
+        }
+
+        const auto location = find(begin);
+        int offset = location.second;
+
+        pieces.forEach(location.first, [&](const Piece& piece) {
+            const int count = min(piece.length - offset, end - begin);
+            const int at = result->pieces.size();
+
+            if (piece.added) {
+                result->pieces.insert(
+                        at, Piece{true, (int) result->added.size(), count},
+                        count
+                );
+                result->added.append(text(piece) + offset, count);
+            } else {
+                result->pieces.insert(
+                        at, Piece{false, piece.offset + offset, count}, count
+                );
+            }
+
+            begin += count;
+            offset = 0;
+
+            return begin < end;
+        });
+
+        return result;
+    }
+
+    result->original.reserve(end - begin);
+
+    forEachChunk(begin, end, [result](const char *data, int count) {
+        result->original.append(data, count);
+        return true;
+    });
+
+    if (begin < end) {
+        result->pieces.insert(0, Piece{false, 0, end - begin}, end - begin);
+        result->size = end - begin;
+    }
+
+    return result;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` PieceTableStorage instance is initialized.
+ *
+ * Post-Conditions:
+ *      Number of characters in the table is returned.
+ *      No changes to `this`.
+ *
+ * Returns the number of characters in the table.
+ */
+int PieceTableStorage::length() const {
+    return size;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` PieceTableStorage instance is initialized.
+ *      Given int position is valid, less than length().
+ *
+ * Post-Conditions:
+ *      Character at the given position is returned.
+ *      No changes to `this`.
+ *
+ * Returns the character at the given position.
+ */
+char PieceTableStorage::charAt(int position) const {
+    int offset = position;
+    int index = 0;
+
+    return text(pieces.find(offset, index))[offset];
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` PieceTableStorage instance is initialized.
+ *      Given int position is valid.
+ *      Pointer to the characters to insert & their count.
+ *
+ * Post-Conditions:
+ *      The given characters are appended to the add buffer.
+ *      A piece of them is inserted at the given position.
+ *
+ * Inserts a copy of the given characters at the given position.
+ */
+void PieceTableStorage::insert(int position, const char *data, int count) {
+    if (count <= 0) {
+        return;
+    }
+
+    const int offset = (int) added.size();
+
+    added.append(data, count);
+    append(position, offset, count);
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` PieceTableStorage instance is initialized.
+ *      Given int position is valid.
+ *      const reference to a Storage other than `this`.
+ *
+ * Post-Conditions:
+ *      The characters of the given Storage are appended to the
+ *      add buffer.
+ *      A single piece of them is inserted at the given position.
+ *      No changes to the given Storage.
+ *
+ * Inserts a copy of the characters of the given Storage at the
+ * given position.
+ */
+void PieceTableStorage::insert(int position, const Storage& source) {
+    const int count = source.length();
+
+    if (count <= 0) {
+        return;
+    }
+
+    const int offset = (int) added.size();
+
+    added.reserve(offset + count);
+
+    source.forEachChunk(0, count, [this](const char *data, int length) {
+        added.append(data, length);
+        return true;
+    });
+
+    append(position, offset, count);
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` PieceTableStorage instance is initialized.
+ *      Given int position is valid.
+ *      Reference to a Storage other than `this`.
+ *
+ * Post-Conditions:
+ *      The characters of the given Storage are inserted
+ *      at the given position.
+ *      The given Storage is empty.
+ *
+ * If `this` is empty, the buffers & pieces of another PieceTableStorage
+ * are taken as they are, otherwise the characters are copied.
+ * Moves the characters of the given Storage to the given position,
+ * leaving the given Storage empty.
+ */
+void PieceTableStorage::splice(int position, Storage& source) {
+    auto table = dynamic_cast<PieceTableStorage*>(&source);
+
+    if (not table or size) {
+        Storage::splice(position, source);
+        return;
+    }
+
+    swap(original, table->original);
+    swap(mapping, table->mapping);
+    swap(added, table->added);
+    swap(pieces, table->pieces);
+    swap(size, table->size);
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` PieceTableStorage instance is initialized.
+ *      begin & end are valid positions, begin <= end.
+ *
+ * Post-Conditions:
+ *      The pieces covering the range are removed,
+ *      the buffers are unchanged.
+ *      If no piece is left, the buffers & the mapping are released.
+ *
+ * Only the pieces at the ends of the range are split, O(log pieces)
+ * plus O(log pieces) per piece removed.
+ * Removes the characters between begin (inclusive) & end (exclusive).
+ */
+void PieceTableStorage::erase(int begin, int end) {
+    if (end <= begin) {
+        return;
+    }
+
+    const int from = splitAt(begin);
+    const int until = splitAt(end);
+
+    pieces.erase(from, until);
+    size -= end - begin;
+
+    /* Nothing refers to the buffers anymore */
+    if (not pieces.size()) {
+        string().swap(original);
+        string().swap(added);
+        mapping.reset();
+    }
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` PieceTableStorage instance is initialized.
+ *      begin & end are valid positions, begin <= end.
+ *      const reference to a ChunkVisitor.
+ *
+ * Post-Conditions:
+ *      The visitor is called, in order, for each piece between
+ *      begin & end, until it returns false.
+ *      Returns false if the visitor stopped the visit.
+ *      No changes to `this`.
+ *
+ * Visits the characters between begin & end as contiguous chunks.
+ */
+bool PieceTableStorage::forEachChunk(int begin, int end,
+                                     const ChunkVisitor& visitor) const {
+    if (end <= begin) {
+        return true;
+    }
+
+    const auto location = find(begin);
+    int offset = location.second;
+    bool stopped = false;
+
+    pieces.forEach(location.first, [&](const Piece& piece) {
+        const int count = min(piece.length - offset, end - begin);
+
+        stopped = not visitor(text(piece) + offset, count);
+        begin += count;
+        offset = 0;
+
+        return not stopped and begin < end;
+    });
+
+    return not stopped;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` PieceTableStorage instance is initialized.
+ *      begin & end are valid positions, begin <= end.
+ *      const reference to a MutableChunkVisitor.
+ *
+ * Post-Conditions:
+ *      Pieces of the original buffer in the range are copied
+ *      to the add buffer.
+ *      The visitor is called, in order, for each piece between
+ *      begin & end.
+ *      Changes made by the visitor are stored in the add buffer.
+ *
+ * The original buffer is never written, its pieces are copied first,
+ * pieces of the add buffer never overlap so they are written in place.
+ * Visits the characters between begin & end as writable
+ * contiguous chunks.
+ */
+void PieceTableStorage::forEachMutableChunk(int begin, int end,
+                                            const MutableChunkVisitor& visitor) {
+    if (end <= begin) {
+        return;
+    }
+
+    const int from = splitAt(begin);
+    const int until = splitAt(end);
+
+    int remaining = until - from;
+
+    /* Move the original pieces to the add buffer before visiting */
+    pieces.forEach(from, [this, &remaining](Piece& piece) {
+        if (not piece.added) {
+            const int offset = (int) added.size();
+
+            added.append(text(piece), piece.length);
+            piece = Piece{true, offset, piece.length};
+        }
+
+        return 0 < --remaining;
+    });
+
+    remaining = until - from;
+
+    pieces.forEach(from, [this, &visitor, &remaining](const Piece& piece) {
+        visitor(&added[piece.offset], piece.length);
+
+        return 0 < --remaining;
+    });
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` PieceTableStorage instance is initialized.
+ *      Reference to the most characters wanted, at least 1,
+ *      at most INT_MAX - length().
+ *
+ * Post-Conditions:
+ *      Pointer to the free capacity of the add buffer is returned,
+ *      the given count is lowered to its size.
+ *      nullptr is returned if the add buffer is full.
+ *      length() is unchanged.
+ *
+ * The add buffer is append-only, so a reader fills its free capacity
+ * in place instead of going through a temporary buffer.
+ * The buffer is never grown here, a full buffer grows by the insertion
+ * of the reader.
+ * Returns the free room after the last character, or nullptr.
+ */
+char* PieceTableStorage::reserveTail(int& count) {
+    const int offset = (int) added.size();
+    const long long room = (long long) added.capacity() - offset;
+
+    if (room <= 0) {
+        return nullptr;
+    }
+
+    count = (int) min<long long>(count, room);
+    added.resize(offset + count);
+    reserved = count;
+
+    return &added[offset];
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` PieceTableStorage instance is initialized.
+ *      reserveTail returned room for at least the given count,
+ *      its first count characters are written.
+ *
+ * Post-Conditions:
+ *      A piece of the given count of reserved characters is
+ *      appended, the rest of the room is given back.
+ *
+ * Appends the given count of characters written to the
+ * reserved tail.
+ */
+void PieceTableStorage::commitTail(int count) {
+    const int offset = (int) added.size() - reserved;
+
+    added.resize(offset + count);
+    reserved = 0;
+
+    if (0 < count) {
+        append(size, offset, count);
+    }
+}
+
+/*
+ * Pre-Conditions:
+ *      const reference to a piece of `this` table.
+ *
+ * Post-Conditions:
+ *      Pointer to the first character of the piece is returned.
+ *      The pointer is invalidated by the next insertion.
+ *
+ * Returns a pointer to the first character of the given piece.
+ */
+const char* PieceTableStorage::text(const Piece& piece) const {
+    if (piece.added) {
+        return added.data() + piece.offset;
+    }
+
+    return (mapping ? mapping->data() : original.data()) + piece.offset;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` PieceTableStorage instance is initialized.
+ *      Given int position is valid.
+ *
+ * Post-Conditions:
+ *      A pair of the piece index & the offset in the piece is returned.
+ *      For the position length(), the index is the number of pieces.
+ *      No changes to `this`.
+ *
+ * One descent of the index, O(log pieces).
+ * Returns the index of the piece holding the given position
+ * & the offset of the position in that piece.
+ */
+pair<int, int> PieceTableStorage::find(int position) const {
+    if (position >= size) {
+        return {pieces.size(), 0};
+    }
+
+    int index = 0;
+
+    (void) pieces.find(position, index);
+
+    return {index, position};
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` PieceTableStorage instance is initialized.
+ *      Given int position is valid.
+ *
+ * Post-Conditions:
+ *      A piece starts exactly at the given position.
+ *      Returns the index of that piece,
+ *      the number of pieces for the position length().
+ *
+ * The piece holding the position is replaced by its two parts,
+ * O(log pieces).
+ * Makes the given position fall on a piece boundary,
+ * returns the index of the piece starting at it.
+ */
+int PieceTableStorage::splitAt(int position) {
+    const auto location = find(position);
+    const int index = location.first;
+    const int offset = location.second;
+
+    if (offset == 0) {
+        return index;
+    }
+
+    const Piece piece = pieces.at(index);
+    const Piece parts[] = {
+            Piece{piece.added, piece.offset, offset},
+            Piece{piece.added, piece.offset + offset, piece.length - offset}
+    };
+    int next = 0;
+
+    pieces.replace(index, index + 1,
+                   [&parts, &next](Piece& part, int& length) {
+        if (next == 2) {
+            return false;
+        }
+
+        part = parts[next++];
+        length = part.length;
+
+        return true;
+    });
+
+    return index + 1;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` PieceTableStorage instance is initialized.
+ *      Given int position is valid.
+ *      Range of the add buffer to insert, offset & count.
+ *
+ * Post-Conditions:
+ *      A piece of the given range is inserted at the given position,
+ *      or the piece ending at the position is extended over it.
+ *
+ * Consecutive insertions, as in typing or appending, extend the same
+ * piece instead of adding a new one, O(log pieces) either way.
+ * Inserts a piece of the add buffer at the given position.
+ */
+void PieceTableStorage::append(int position, int offset, int count) {
+    const auto location = find(position);
+    const int index = location.first;
+
+    if (location.second == 0 and 0 < index) {
+        Piece& before = pieces.at(index - 1);
+
+        /* The piece before ends right where the new characters start */
+        if (before.added and before.offset + before.length == offset) {
+            before.length += count;
+            pieces.setWeight(index - 1, before.length);
+            size += count;
+
+            return;
+        }
+    }
+
+    const int at = splitAt(position);
+
+    pieces.insert(at, Piece{true, offset, count}, count);
+    size += count;
+}
@@ -0,0 +1,425 @@
+/*
+ * StringBuilder Project
+ *
+ *
+ * PieceTableStorage.h
+ *
+ * Date:        17/10/2026
+ *
+ * Author:      Mahmoud Yaman Seraj Alddin
+ *
+ * Purpose:     Header file for the PieceTableStorage class,
+ *              the piece table storage of MyStringBuilder.
+ *
+ * List of public Functions:
+ *      PieceTableStorage()
+ *          No-arg constructor of the PieceTableStorage class.
+ *
+ *      PieceTableStorage(const char*, int)
+ *          Parameterized constructor of the PieceTableStorage class.
+ *
+ *      PieceTableStorage(std::string&&)
+ *          Parameterized constructor of the PieceTableStorage class.
+ *          Adopts the given string as the original buffer.
+ *
+ *      PieceTableStorage(std::shared_ptr<const MappedFile>)
+ *          Parameterized constructor of the PieceTableStorage class.
+ *          Uses the characters of the given file as the original buffer.
+ *
+ *      Storage* copy(int begin, int end) const
+ *          Returns a new PieceTableStorage holding a copy of the characters
+ *          between begin (inclusive) & end (exclusive).
+ *
+ *      int length() const
+ *          Returns the number of characters in the table.
+ *
+ *      char charAt(int) const
+ *          Returns the character at the given position.
+ *
+ *      void insert(int, const char*, int)
+ *          Inserts a copy of the given characters at the given position.
+ *
+ *      void insert(int, const Storage&)
+ *          Inserts a copy of the characters of the given Storage at the
+ *          given position.
+ *
+ *      void splice(int, Storage&)
+ *          Moves the characters of the given Storage to the given position,
+ *          leaving the given Storage empty.
+ *
+ *      void erase(int begin, int end)
+ *          Removes the characters between begin (inclusive)
+ *          & end (exclusive).
+ *
+ *      bool forEachChunk(int begin, int end, const ChunkVisitor&) const
+ *          Visits the characters between begin & end as contiguous chunks.
+ *
+ *      void forEachMutableChunk(int begin, int end,
+ *                               const MutableChunkVisitor&)
+ *          Visits the characters between begin & end as writable
+ *          contiguous chunks.
+ *
+ *      char* reserveTail(int&)
+ *          Returns the free room after the last character, or nullptr.
+ *
+ *      void commitTail(int)
+ *          Appends the given count of characters written to the
+ *          reserved tail.
+ *
+ * List of private Functions:
+ *      const char* text(const Piece&) const
+ *          Returns a pointer to the first character of the given piece.
+ *
+ *      std::pair<int, int> find(int) const
+ *          Returns the index of the piece holding the given position
+ *          & the offset of the position in that piece.
+ *
+ *      int splitAt(int)
+ *          Makes the given position fall on a piece boundary,
+ *          returns the index of the piece starting at it.
+ *
+ *      void append(int, int, int)
+ *          Inserts a piece of the add buffer at the given position.
+ */
+
+#ifndef MYSTRINGBUILDER_PIECETABLESTORAGE_H
+#define MYSTRINGBUILDER_PIECETABLESTORAGE_H
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "MappedFile.h"
+#include "PositionIndex.h"
+#include "Storage.h"
+
+/*
+ * PieceTableStorage keeps the original text in an immutable buffer &
+ * every inserted text in an append-only add buffer.
+ * The characters are described by a sequence of pieces of the buffers,
+ * so edits split pieces instead of copying characters.
+ * The pieces are kept in an order-statistic index weighted by their
+ * lengths, so finding, splitting, inserting or removing a piece is
+ * O(log pieces).
+ * The const functions never change `this`, so they are safe to call
+ * from many threads at once.
+ */
+class PieceTableStorage : public Storage {
+public:
+    /*
+     * Pre-Conditions:
+     *      No preconditions.
+     *
+     * Post-Conditions:
+     *      An empty PieceTableStorage instance is created.
+     *      pieces is empty.
+     *      size is 0.
+     *
+     * No-arg constructor of the PieceTableStorage class.
+     */
+    PieceTableStorage();
+
+    /*
+     * Pre-Conditions:
+     *      Pointer to the characters to copy & their count.
+     *
+     * Post-Conditions:
+     *      A PieceTableStorage instance is created.
+     *      original holds the given characters, as a single piece.
+     *
+     * Parameterized constructor of the PieceTableStorage class.
+     */
+    PieceTableStorage(const char*, int);
+
+    /*
+     * Pre-Conditions:
+     *      rvalue reference to the string to adopt.
+     *
+     * Post-Conditions:
+     *      A PieceTableStorage instance is created.
+     *      original is the given string, as a single piece,
+     *      its characters are not copied.
+     *      The given string is left empty.
+     *
+     * Parameterized constructor of the PieceTableStorage class.
+     * Adopts the given string as the original buffer.
+     */
+    explicit PieceTableStorage(std::string&&);
+
+    /*
+     * Pre-Conditions:
+     *      Shared pointer to a MappedFile, not nullptr.
+     *
+     * Post-Conditions:
+     *      A PieceTableStorage instance is created.
+     *      The characters of the file are the original buffer,
+     *      as a single piece, they are not copied.
+     *
+     * Parameterized constructor of the PieceTableStorage class.
+     * Uses the characters of the given file as the original buffer.
+     */
+    explicit PieceTableStorage(std::shared_ptr<const MappedFile>);
+
+    /*
+     * Pre-Conditions:
+     *      `this` PieceTableStorage instance is initialized.
+     *      begin & end are valid positions, begin <= end.
+     *
+     * Post-Conditions:
+     *      A heap allocated PieceTableStorage is returned,
+     *      whose original buffer holds the copied characters,
+     *      or shares the mapped file of `this`.
+     *      No changes to `this`.
+     *
+     * Returns a new PieceTableStorage holding a copy of the characters
+     * between begin (inclusive) & end (exclusive).
+     */
+    [[nodiscard]] Storage* copy(int /* begin */,
+                                int /* end */) const override;
+
+    /*
+     * Pre-Conditions:
+     *      `this` PieceTableStorage instance is initialized.
+     *
+     * Post-Conditions:
+     *      Number of characters in the table is returned.
+     *      No changes to `this`.
+     *
+     * Returns the number of characters in the table.
+     */
+    [[nodiscard]] int length() const override;
+
+    /*
+     * Pre-Conditions:
+     *      `this` PieceTableStorage instance is initialized.
+     *      Given int position is valid, less than length().
+     *
+     * Post-Conditions:
+     *      Character at the given position is returned.
+     *      No changes to `this`.
+     *
+     * Returns the character at the given position.
+     */
+    [[nodiscard]] char charAt(int) const override;
+
+    /*
+     * Pre-Conditions:
+     *      `this` PieceTableStorage instance is initialized.
+     *      Given int position is valid.
+     *      Pointer to the characters to insert & their count.
+     *
+     * Post-Conditions:
+     *      The given characters are appended to the add buffer.
+     *      A piece of them is inserted at the given position.
+     *
+     * Inserts a copy of the given characters at the given position.
+     */
+    void insert(int, const char*, int) override;
+
+    /*
+     * Pre-Conditions:
+     *      `this` PieceTableStorage instance is initialized.
+     *      Given int position is valid.
+     *      const reference to a Storage other than `this`.
+     *
+     * Post-Conditions:
+     *      The characters of the given Storage are appended to the
+     *      add buffer.
+     *      A single piece of them is inserted at the given position.
+     *      No changes to the given Storage.
+     *
+     * Inserts a copy of the characters of the given Storage at the
+     * given position.
+     */
+    void insert(int, const Storage&) override;
+
+    /*
+     * Pre-Conditions:
+     *      `this` PieceTableStorage instance is initialized.
+     *      Given int position is valid.
+     *      Reference to a Storage other than `this`.
+     *
+     * Post-Conditions:
+     *      The characters of the given Storage are inserted
+     *      at the given position.
+     *      The given Storage is empty.
+     *
+     * Moves the characters of the given Storage to the given position,
+     * leaving the given Storage empty.
+     */
+    void splice(int, Storage&) override;
+
+    /*
+     * Pre-Conditions:
+     *      `this` PieceTableStorage instance is initialized.
+     *      begin & end are valid positions, begin <= end.
+     *
+     * Post-Conditions:
+     *      The pieces covering the range are removed,
+     *      the buffers are unchanged.
+     *
+     * Removes the characters between begin (inclusive) & end (exclusive).
+     */
+    void erase(int /* begin */, int /* end */) override;
+
+    /*
+     * Pre-Conditions:
+     *      `this` PieceTableStorage instance is initialized.
+     *      begin & end are valid positions, begin <= end.
+     *      const reference to a ChunkVisitor.
+     *
+     * Post-Conditions:
+     *      The visitor is called, in order, for each piece between
+     *      begin & end, until it returns false.
+     *      Returns false if the visitor stopped the visit.
+     *      No changes to `this`.
+     *
+     * Visits the characters between begin & end as contiguous chunks.
+     */
+    bool forEachChunk(int /* begin */, int /* end */,
+                      const ChunkVisitor&) const override;
+
+    /*
+     * Pre-Conditions:
+     *      `this` PieceTableStorage instance is initialized.
+     *      begin & end are valid positions, begin <= end.
+     *      const reference to a MutableChunkVisitor.
+     *
+     * Post-Conditions:
+     *      Pieces of the original buffer in the range are copied
+     *      to the add buffer.
+     *      The visitor is called, in order, for each piece between
+     *      begin & end.
+     *      Changes made by the visitor are stored in the add buffer.
+     *
+     * Visits the characters between begin & end as writable
+     * contiguous chunks.
+     */
+    void forEachMutableChunk(int /* begin */, int /* end */,
+                             const MutableChunkVisitor&) override;
+
+    /*
+     * Pre-Conditions:
+     *      `this` PieceTableStorage instance is initialized.
+     *      Reference to the most characters wanted, at least 1,
+     *      at most INT_MAX - length().
+     *
+     * Post-Conditions:
+     *      Pointer to the free capacity of the add buffer is returned,
+     *      the given count is lowered to its size.
+     *      nullptr is returned if the add buffer is full.
+     *      length() is unchanged.
+     *
+     * Returns the free room after the last character, or nullptr.
+     */
+    [[nodiscard]] char* reserveTail(int&) override;
+
+    /*
+     * Pre-Conditions:
+     *      `this` PieceTableStorage instance is initialized.
+     *      reserveTail returned room for at least the given count,
+     *      its first count characters are written.
+     *
+     * Post-Conditions:
+     *      A piece of the given count of reserved characters is
+     *      appended, the rest of the room is given back.
+     *
+     * Appends the given count of characters written to the
+     * reserved tail.
+     */
+    void commitTail(int) override;
+
+private:
+    /*
+     * Piece of one of the buffers.
+     */
+    struct Piece {
+        /* true for a piece of the add buffer, false for the original */
+        bool added;
+
+        /* Position of the first character of the piece in its buffer */
+        int offset;
+
+        /* Number of characters in the piece */
+        int length;
+    };
+
+    /*
+     * Pre-Conditions:
+     *      const reference to a piece of `this` table.
+     *
+     * Post-Conditions:
+     *      Pointer to the first character of the piece is returned.
+     *      The pointer is invalidated by the next insertion.
+     *
+     * Returns a pointer to the first character of the given piece.
+     */
+    [[nodiscard]] const char* text(const Piece&) const;
+
+    /*
+     * Pre-Conditions:
+     *      `this` PieceTableStorage instance is initialized.
+     *      Given int position is valid.
+     *
+     * Post-Conditions:
+     *      A pair of the piece index & the offset in the piece is returned.
+     *      For the position length(), the index is the number of pieces.
+     *      No changes to `this`.
+     *
+     * Returns the index of the piece holding the given position
+     * & the offset of the position in that piece.
+     */
+    [[nodiscard]] std::pair<int, int> find(int) const;
+
+    /*
+     * Pre-Conditions:
+     *      `this` PieceTableStorage instance is initialized.
+     *      Given int position is valid.
+     *
+     * Post-Conditions:
+     *      A piece starts exactly at the given position.
+     *      Returns the index of that piece,
+     *      the number of pieces for the position length().
+     *
+     * Makes the given position fall on a piece boundary,
+     * returns the index of the piece starting at it.
+     */
+    int splitAt(int);
+
+    /*
+     * Pre-Conditions:
+     *      `this` PieceTableStorage instance is initialized.
+     *      Given int position is valid.
+     *      Range of the add buffer to insert, offset & count.
+     *
+     * Post-Conditions:
+     *      A piece of the given range is inserted at the given position,
+     *      or the piece ending at the position is extended over it.
+     *
+     * Inserts a piece of the add buffer at the given position.
+     */
+    void append(int /* position */, int /* offset */, int /* count */);
+
+    /* Immutable buffer of the original characters, unused if mapped */
+    std::string original;
+
+    /* Mapped file holding the original characters, if any */
+    std::shared_ptr<const MappedFile> mapping;
+
+    /* Append-only buffer of the inserted characters */
+    std::string added;
+
+    /*
+     * Sequence of pieces describing the characters, weighted by their
+     * lengths. The length of a piece is changed with its weight.
+     */
+    PositionIndex<Piece> pieces;
+
+    /* Number of characters in the table */
+    int size;
+
+    /* Characters at the end of the add buffer held by reserveTail */
+    int reserved;
+};
+
+#endif /* MYSTRINGBUILDER_PIECETABLESTORAGE_H */
@@ -0,0 +1,1279 @@
+/*
+ * StringBuilder Project
+ *
+ *
+ * PositionIndex.h
+ *
+ * Date:        17/10/2026
+ *
+ * Author:      Mahmoud Yaman Seraj Alddin
+ *
+ * Purpose:     Header file & implementation of the PositionIndex class
+ *              template, the order-statistic tree finding the entry of a
+ *              sequence (a Node, a piece) holding a character position.
+ *
+ * List of public Functions:
+ *      PositionIndex()
+ *          No-arg constructor of the PositionIndex class.
+ *
+ *      int size() const
+ *          Returns the number of entries.
+ *
+ *      int weight() const
+ *          Returns the number of characters covered by the entries.
+ *
+ *      const T& find(int&, int&) const
+ *          Returns the value of the entry holding the given position.
+ *
+ *      const T& at(int) const
+ *          Returns the value of the given entry.
+ *
+ *      T& at(int)
+ *          Returns the value of the given entry, for editing.
+ *
+ *      void insert(int, const T&, int)
+ *          Inserts an entry of the given value & weight before the
+ *          given entry.
+ *
+ *      void erase(int begin, int end)
+ *          Removes the entries between begin (inclusive)
+ *          & end (exclusive).
+ *
+ *      void replace(int begin, int end, Generator)
+ *          Replaces the entries between begin (inclusive)
+ *          & end (exclusive) by the generated ones.
+ *
+ *      void setWeight(int, int)
+ *          Changes the weight of the given entry.
+ *
+ *      void clear()
+ *          Removes all the entries.
+ *
+ *      bool forEach(int, Visitor) const
+ *          Visits the values from the given entry on, in order.
+ *
+ *      bool forEach(int, Visitor)
+ *          Visits the values from the given entry on, in order,
+ *          for editing.
+ *
+ * List of private Functions:
+ *      int make(bool)
+ *          Returns the slot of a new empty block.
+ *
+ *      void sum(int, int&, int&) const
+ *          Returns the number of entries & of characters of a block.
+ *
+ *      int insertInto(int, int, const T&, int, bool)
+ *          Inserts an entry in the given subtree, returns the block split
+ *          off it, if any.
+ *
+ *      int put(int, int, const T&, int, int)
+ *          Puts an entry or a child in a block, returns the block split
+ *          off it, if any.
+ *
+ *      int split(int, int)
+ *          Moves the entries of a full block past the given count
+ *          to a new block.
+ *
+ *      int eraseFrom(int, int)
+ *          Removes an entry of the given subtree, returns its weight.
+ *
+ *      bool rewrite(int, int, int, const T*, const int*, int, int&)
+ *          Replaces entries of a single leaf of the given subtree.
+ *
+ *      int reweigh(int, int, int)
+ *          Changes the weight of an entry of the given subtree,
+ *          returns the change.
+ *
+ *      bool visit(int, int, Visitor&) const
+ *          Visits the values of the given subtree from the given entry on.
+ */
+
+#ifndef MYSTRINGBUILDER_POSITIONINDEX_H
+#define MYSTRINGBUILDER_POSITIONINDEX_H
+
+#include <algorithm>
+#include <vector>
+
+/*
+ * PositionIndex keeps a sequence of values, each covering a number of
+ * characters (its weight), in a B+ tree counted by position: a block
+ * holds, for each of its children, their number of entries & of
+ * characters, so a position or an entry is found by scanning one small
+ * array per level.
+ * Finding the entry of a position, inserting, erasing or reweighting an
+ * entry are all O(log n), with few cache misses since a level is a
+ * single block.
+ * Emptied blocks are removed, underfull ones are not merged.
+ * The const functions never change the tree, so they are safe to call
+ * from many threads at once.
+ * The blocks are kept in a vector, linked by slot, their slots reused.
+ */
+template<typename T>
+class PositionIndex {
+public:
+    /*
+     * Pre-Conditions:
+     *      No preconditions.
+     *
+     * Post-Conditions:
+     *      An empty PositionIndex instance is created,
+     *      without any block.
+     *
+     * No-arg constructor of the PositionIndex class.
+     */
+    PositionIndex();
+
+    /*
+     * Pre-Conditions:
+     *      `this` PositionIndex instance is initialized.
+     *
+     * Post-Conditions:
+     *      Number of entries is returned.
+     *      No changes to `this`.
+     *
+     * Returns the number of entries.
+     */
+    [[nodiscard]] int size() const;
+
+    /*
+     * Pre-Conditions:
+     *      `this` PositionIndex instance is initialized.
+     *
+     * Post-Conditions:
+     *      Sum of the weights of the entries is returned.
+     *      No changes to `this`.
+     *
+     * Returns the number of characters covered by the entries.
+     */
+    [[nodiscard]] int weight() const;
+
+    /*
+     * Pre-Conditions:
+     *      `this` PositionIndex instance is initialized.
+     *      Reference to a position, less than weight().
+     *      Reference to an int receiving the entry.
+     *
+     * Post-Conditions:
+     *      const reference to the value of the entry holding the
+     *      position is returned, its index is stored in the given int.
+     *      The position is changed to an offset in that entry.
+     *      No changes to `this`.
+     *
+     * Returns the value of the entry holding the given position.
+     */
+    const T& find(int&, int&) const;
+
+    /*
+     * Pre-Conditions:
+     *      `this` PositionIndex instance is initialized.
+     *      Given int entry is valid, less than size().
+     *
+     * Post-Conditions:
+     *      const reference to the value of the entry is returned.
+     *      No changes to `this`.
+     *
+     * Returns the value of the given entry.
+     */
+    [[nodiscard]] const T& at(int) const;
+
+    /*
+     * Pre-Conditions:
+     *      `this` PositionIndex instance is initialized.
+     *      Given int entry is valid, less than size().
+     *
+     * Post-Conditions:
+     *      Reference to the value of the entry is returned.
+     *      Its weight is unchanged, see setWeight.
+     *
+     * Returns the value of the given entry, for editing.
+     */
+    [[nodiscard]] T& at(int);
+
+    /*
+     * Pre-Conditions:
+     *      `this` PositionIndex instance is initialized.
+     *      Given int entry is valid, at most size().
+     *      const reference to the value, int of its weight.
+     *
+     * Post-Conditions:
+     *      The new entry is at the given index, the entries from it on
+     *      are moved one index up.
+     *
+     * Inserts an entry of the given value & weight before the
+     * given entry.
+     */
+    void insert(int, const T&, int);
+
+    /*
+     * Pre-Conditions:
+     *      `this` PositionIndex instance is initialized.
+     *      begin & end are valid entries, begin <= end <= size().
+     *
+     * Post-Conditions:
+     *      The entries between begin & end are removed.
+     *
+     * Removes the entries between begin (inclusive) & end (exclusive).
+     */
+    void erase(int /* begin */, int /* end */);
+
+    /*
+     * Pre-Conditions:
+     *      `this` PositionIndex instance is initialized.
+     *      begin & end are valid entries, begin <= end <= size().
+     *      Generator callable with a T& & an int& of the weight,
+     *      returning false once it has no entry to give.
+     *
+     * Post-Conditions:
+     *      The entries between begin & end are replaced by the
+     *      generated ones, in order.
+     *
+     * Replaces the entries between begin (inclusive)
+     * & end (exclusive) by the generated ones.
+     */
+    template<typename Generator>
+    void replace(int /* begin */, int /* end */, Generator);
+
+    /*
+     * Pre-Conditions:
+     *      `this` PositionIndex instance is initialized.
+     *      Given int entry is valid, less than size().
+     *      int of the new weight.
+     *
+     * Post-Conditions:
+     *      The entry covers the given number of characters.
+     *
+     * Changes the weight of the given entry.
+     */
+    void setWeight(int, int);
+
+    /*
+     * Pre-Conditions:
+     *      `this` PositionIndex instance is initialized.
+     *
+     * Post-Conditions:
+     *      `this` is empty, its blocks are released.
+     *
+     * Removes all the entries.
+     */
+    void clear();
+
+    /*
+     * Pre-Conditions:
+     *      `this` PositionIndex instance is initialized.
+     *      Given int entry is valid, at most size().
+     *      Visitor callable with a const T&, returning bool.
+     *
+     * Post-Conditions:
+     *      The visitor is called with the values from the given entry
+     *      on, in order, until it returns false.
+     *      Returns false if the visitor stopped the visit.
+     *      No changes to `this`.
+     *
+     * Visits the values from the given entry on, in order.
+     */
+    template<typename Visitor>
+    bool forEach(int, Visitor) const;
+
+    /*
+     * Pre-Conditions:
+     *      `this` PositionIndex instance is initialized.
+     *      Given int entry is valid, at most size().
+     *      Visitor callable with a T&, returning bool.
+     *
+     * Post-Conditions:
+     *      The visitor is called with the values from the given entry
+     *      on, in order, until it returns false.
+     *      Returns false if the visitor stopped the visit.
+     *      The weights are unchanged, see setWeight.
+     *
+     * Visits the values from the given entry on, in order,
+     * for editing.
+     */
+    template<typename Visitor>
+    bool forEach(int, Visitor);
+
+private:
+    /* Number of children or entries a block holds, at most */
+    static const int kOrder = 32;
+
+    /* Slot of the missing blocks */
+    static const int kNone = -1;
+
+    /*
+     * Node of the tree.
+     * A leaf holds entries: their values & weights.
+     * A branch holds children: their slots, numbers of entries
+     * & numbers of characters (in weights).
+     */
+    struct Block {
+        /* Whether the block holds entries */
+        bool leaf;
+
+        /* Number of entries or children held */
+        int size;
+
+        /* Weight of each entry, or of each child */
+        int weights[kOrder];
+
+        /* Number of entries of each child, unused by leaves */
+        int counts[kOrder];
+
+        /* Slot of each child, unused by leaves */
+        int children[kOrder];
+
+        /* Value of each entry, unused by branches */
+        T values[kOrder];
+    };
+
+    /*
+     * Pre-Conditions:
+     *      bool of whether the block is a leaf.
+     *
+     * Post-Conditions:
+     *      The slot of a new empty block is returned.
+     *      References to the blocks are invalidated.
+     *
+     * Returns the slot of a new empty block.
+     */
+    int make(bool);
+
+    /*
+     * Pre-Conditions:
+     *      Slot of a block.
+     *      References to ints receiving the sums.
+     *
+     * Post-Conditions:
+     *      The numbers of entries & of characters of the block are
+     *      stored in the given ints.
+     *      No changes to `this`.
+     *
+     * Returns the number of entries & of characters of a block.
+     */
+    void sum(int, int&, int&) const;
+
+    /*
+     * Pre-Conditions:
+     *      Slot of a block.
+     *      int of an entry of its subtree, at most its entries.
+     *      const reference to the value, int of its weight.
+     *      bool, true if the entry is the number of entries.
+     *
+     * Post-Conditions:
+     *      The entry is inserted in the subtree.
+     *      If the block was full, it is split & the slot of the block
+     *      holding its upper half is returned, kNone otherwise.
+     *
+     * Inserts an entry in the given subtree, returns the block split
+     * off it, if any.
+     */
+    int insertInto(int, int, const T&, int, bool);
+
+    /*
+     * Pre-Conditions:
+     *      Slot of a block.
+     *      int of the index to put at, at most the size of the block.
+     *      const reference to the value & int of the weight of the
+     *      entry, for a leaf.
+     *      Slot of the child, for a branch.
+     *
+     * Post-Conditions:
+     *      The entry or child is put at the given index.
+     *      If the block was full, it is split & the slot of the block
+     *      holding its upper half is returned, kNone otherwise.
+     *
+     * Puts an entry or a child in a block, returns the block split
+     * off it, if any.
+     */
+    int put(int, int, const T&, int, int);
+
+    /*
+     * Pre-Conditions:
+     *      Slot of a full block.
+     *      int of the entries or children kept, at most kOrder.
+     *
+     * Post-Conditions:
+     *      The entries or children past the given count are moved to
+     *      a new block, whose slot is returned.
+     *      References to the blocks are invalidated.
+     *
+     * Moves the entries of a full block past the given count
+     * to a new block.
+     */
+    int split(int, int);
+
+    /*
+     * Pre-Conditions:
+     *      Slot of a block.
+     *      int of an entry of its subtree, less than its entries.
+     *
+     * Post-Conditions:
+     *      The entry is removed, emptied blocks below the given one are
+     *      released. The weight of the entry is returned.
+     *
+     * Removes an entry of the given subtree, returns its weight.
+     */
+    int eraseFrom(int, int);
+
+    /*
+     * Pre-Conditions:
+     *      Slot of a block.
+     *      int of an entry of its subtree & int of the number of entries
+     *      to replace from it, within its entries.
+     *      Arrays of the values & weights of the new entries & int of
+     *      their number.
+     *      Reference to an int receiving the change of weight.
+     *
+     * Post-Conditions:
+     *      If the entries to replace are in one leaf that can hold the
+     *      new ones without being emptied, they are replaced, the change
+     *      of weight is stored & true is returned.
+     *      Otherwise, false is returned, no changes to `this`.
+     *
+     * Replaces entries of a single leaf of the given subtree.
+     */
+    bool rewrite(int, int, int, const T*, const int*, int, int&);
+
+    /*
+     * Pre-Conditions:
+     *      Slot of a block.
+     *      int of an entry of its subtree, less than its entries.
+     *      int of the new weight.
+     *
+     * Post-Conditions:
+     *      The entry & the weights of the blocks above it are changed.
+     *      The change of weight is returned.
+     *
+     * Changes the weight of an entry of the given subtree,
+     * returns the change.
+     */
+    int reweigh(int, int, int);
+
+    /*
+     * Pre-Conditions:
+     *      Slot of a block.
+     *      int of the first entry of its subtree to visit.
+     *      Reference to a visitor callable with a const T&.
+     *
+     * Post-Conditions:
+     *      The visitor is called with the values of the subtree from
+     *      the entry on, until it returns false.
+     *      Returns false if the visitor stopped the visit.
+     *
+     * Visits the values of the given subtree from the given entry on.
+     */
+    template<typename Visitor>
+    bool visit(int, int, Visitor&) const;
+
+    /* Blocks of the tree, linked by slot */
+    std::vector<Block> blocks;
+
+    /* Slots free for new blocks */
+    std::vector<int> released;
+
+    /* Slot of the root block, kNone if there is no entry */
+    int root;
+
+    /* Number of entries */
+    int entries;
+
+    /* Number of characters covered by the entries */
+    int total;
+};
+
+/* Definitions of the constants, for the uses binding them to references */
+template<typename T>
+const int PositionIndex<T>::kOrder;
+
+template<typename T>
+const int PositionIndex<T>::kNone;
+
+/*
+ * Pre-Conditions:
+ *      No preconditions.
+ *
+ * Post-Conditions:
+ *      An empty PositionIndex instance is created,
+ *      without any block.
+ *
+ * No-arg constructor of the PositionIndex class.
+ */
+template<typename T>
+PositionIndex<T>::PositionIndex(): blocks{}, released{}, root{kNone},
+                                   entries{0}, total{0} {}
+
+/*
+ * Pre-Conditions:
+ *      `this` PositionIndex instance is initialized.
+ *
+ * Post-Conditions:
+ *      Number of entries is returned.
+ *      No changes to `this`.
+ *
+ * Returns the number of entries.
+ */
+template<typename T>
+int PositionIndex<T>::size() const {
+    return entries;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` PositionIndex instance is initialized.
+ *
+ * Post-Conditions:
+ *      Sum of the weights of the entries is returned.
+ *      No changes to `this`.
+ *
+ * Returns the number of characters covered by the entries.
+ */
+template<typename T>
+int PositionIndex<T>::weight() const {
+    return total;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` PositionIndex instance is initialized.
+ *      Reference to a position, less than weight().
+ *      Reference to an int receiving the entry.
+ *
+ * Post-Conditions:
+ *      const reference to the value of the entry holding the
+ *      position is returned, its index is stored in the given int.
+ *      The position is changed to an offset in that entry.
+ *      No changes to `this`.
+ *
+ * One scan of the weights per level, O(log n), entries of weight 0
+ * are skipped.
+ * Returns the value of the entry holding the given position.
+ */
+template<typename T>
+const T& PositionIndex<T>::find(int& position, int& entry) const {
+    const Block *block = &blocks[root];
+
+    entry = 0;
+
+    while (not block->leaf) {
+        int child = 0;
+
+        while (block->weights[child] <= position) {
+            position -= block->weights[child];
+            entry += block->counts[child];
+            child++;
+        }
+
+        block = &blocks[block->children[child]];
+    }
+
+    int slot = 0;
+
+    while (block->weights[slot] <= position) {
+        position -= block->weights[slot];
+        slot++;
+    }
+
+    entry += slot;
+    return block->values[slot];
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` PositionIndex instance is initialized.
+ *      Given int entry is valid, less than size().
+ *
+ * Post-Conditions:
+ *      const reference to the value of the entry is returned.
+ *      No changes to `this`.
+ *
+ * One scan of the counts per level, O(log n).
+ * Returns the value of the given entry.
+ */
+template<typename T>
+const T& PositionIndex<T>::at(int index) const {
+    const Block *block = &blocks[root];
+
+    while (not block->leaf) {
+        int child = 0;
+
+        while (block->counts[child] <= index) {
+            index -= block->counts[child];
+            child++;
+        }
+
+        block = &blocks[block->children[child]];
+    }
+
+    return block->values[index];
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` PositionIndex instance is initialized.
+ *      Given int entry is valid, less than size().
+ *
+ * Post-Conditions:
+ *      Reference to the value of the entry is returned.
+ *      Its weight is unchanged, see setWeight.
+ *
+ * Returns the value of the given entry, for editing.
+ */
+template<typename T>
+T& PositionIndex<T>::at(int index) {
+    const PositionIndex& self = *this;
+
+    return const_cast<T&>(self.at(index));
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` PositionIndex instance is initialized.
+ *      Given int entry is valid, at most size().
+ *      const reference to the value, int of its weight.
+ *
+ * Post-Conditions:
+ *      The new entry is at the given index, the entries from it on
+ *      are moved one index up.
+ *
+ * A full root is split under a new root, so the tree only grows at the
+ * top & stays balanced, O(log n).
+ * Inserts an entry of the given value & weight before the
+ * given entry.
+ */
+template<typename T>
+void PositionIndex<T>::insert(int index, const T& value, int weight) {
+    if (root == kNone) {
+        root = make(true);
+    }
+
+    const int sibling = insertInto(root, index, value, weight,
+                                   index == entries);
+
+    if (sibling != kNone) {
+        const int grown = make(false);
+        Block& block = blocks[grown];
+
+        block.size = 2;
+        block.children[0] = root;
+        block.children[1] = sibling;
+        sum(root, block.counts[0], block.weights[0]);
+        sum(sibling, block.counts[1], block.weights[1]);
+
+        root = grown;
+    }
+
+    entries++;
+    total += weight;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` PositionIndex instance is initialized.
+ *      begin & end are valid entries, begin <= end <= size().
+ *
+ * Post-Conditions:
+ *      The entries between begin & end are removed.
+ *
+ * A range inside one leaf is removed in one descent, O(log n), others
+ * cost O(log n) per entry removed, a root left with a single child is
+ * replaced by it.
+ * Removes the entries between begin (inclusive) & end (exclusive).
+ */
+template<typename T>
+void PositionIndex<T>::erase(int begin, int end) {
+    if (begin == 0 and end == entries) {
+        clear();
+        return;
+    }
+
+    int change = 0;
+
+    if (begin == end or
+        rewrite(root, begin, end - begin, nullptr, nullptr, 0, change)) {
+        entries -= end - begin;
+        total += change;
+
+        return;
+    }
+
+    for (int i = begin; i < end; i++) {
+        total -= eraseFrom(root, begin);
+        entries--;
+
+        while (not blocks[root].leaf and blocks[root].size == 1) {
+            released.push_back(root);
+            root = blocks[root].children[0];
+        }
+    }
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` PositionIndex instance is initialized.
+ *      begin & end are valid entries, begin <= end <= size().
+ *      Generator callable with a T& & an int& of the weight,
+ *      returning false once it has no entry to give.
+ *
+ * Post-Conditions:
+ *      The entries between begin & end are replaced by the
+ *      generated ones, in order.
+ *
+ * A few entries replaced inside one leaf cost a single descent,
+ * O(log n), others O(log n) per entry removed or generated.
+ * Replaces the entries between begin (inclusive)
+ * & end (exclusive) by the generated ones.
+ */
+template<typename T>
+template<typename Generator>
+void PositionIndex<T>::replace(int begin, int end, Generator generator) {
+    T values[kOrder];
+    int weights[kOrder];
+    int added = 0;
+
+    while (added < kOrder and generator(values[added], weights[added])) {
+        added++;
+    }
+
+    int change = 0;
+
+    if (added < kOrder and root != kNone and
+        rewrite(root, begin, end - begin, values, weights, added, change)) {
+        entries += added - (end - begin);
+        total += change;
+
+        return;
+    }
+
+    erase(begin, end);
+
+    for (int i = 0; i < added; i++) {
+        insert(begin + i, values[i], weights[i]);
+    }
+
+    /* The generator may have more entries than the buffer held */
+    T value{};
+    int weight = 0;
+
+    for (int index = begin + added;
+         added == kOrder and generator(value, weight); index++) {
+        insert(index, value, weight);
+    }
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` PositionIndex instance is initialized.
+ *      Given int entry is valid, less than size().
+ *      int of the new weight.
+ *
+ * Post-Conditions:
+ *      The entry covers the given number of characters.
+ *
+ * The weights are fixed along the path to the entry, O(log n).
+ * Changes the weight of the given entry.
+ */
+template<typename T>
+void PositionIndex<T>::setWeight(int index, int weight) {
+    total += reweigh(root, index, weight);
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` PositionIndex instance is initialized.
+ *
+ * Post-Conditions:
+ *      `this` is empty, its blocks are released.
+ *
+ * Removes all the entries.
+ */
+template<typename T>
+void PositionIndex<T>::clear() {
+    std::vector<Block>().swap(blocks);
+    std::vector<int>().swap(released);
+    root = kNone;
+    entries = 0;
+    total = 0;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` PositionIndex instance is initialized.
+ *      Given int entry is valid, at most size().
+ *      Visitor callable with a const T&, returning bool.
+ *
+ * Post-Conditions:
+ *      The visitor is called with the values from the given entry
+ *      on, in order, until it returns false.
+ *      Returns false if the visitor stopped the visit.
+ *      No changes to `this`.
+ *
+ * O(log n) to reach the first entry, amortized O(1) per entry after it.
+ * Visits the values from the given entry on, in order.
+ */
+template<typename T>
+template<typename Visitor>
+bool PositionIndex<T>::forEach(int index, Visitor visitor) const {
+    if (entries <= index) {
+        return true;
+    }
+
+    return visit(root, index, visitor);
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` PositionIndex instance is initialized.
+ *      Given int entry is valid, at most size().
+ *      Visitor callable with a T&, returning bool.
+ *
+ * Post-Conditions:
+ *      The visitor is called with the values from the given entry
+ *      on, in order, until it returns false.
+ *      Returns false if the visitor stopped the visit.
+ *      The weights are unchanged, see setWeight.
+ *
+ * Visits the values from the given entry on, in order,
+ * for editing.
+ */
+template<typename T>
+template<typename Visitor>
+bool PositionIndex<T>::forEach(int index, Visitor visitor) {
+    const PositionIndex& self = *this;
+
+    return self.forEach(index, [&visitor](const T& value) {
+        return visitor(const_cast<T&>(value));
+    });
+}
+
+/*
+ * Pre-Conditions:
+ *      bool of whether the block is a leaf.
+ *
+ * Post-Conditions:
+ *      The slot of a new empty block is returned.
+ *      References to the blocks are invalidated.
+ *
+ * Returns the slot of a new empty block.
+ */
+template<typename T>
+int PositionIndex<T>::make(bool leaf) {
+    int slot = 0;
+
+    if (released.empty()) {
+        slot = (int) blocks.size();
+        blocks.emplace_back();
+    } else {
+        slot = released.back();
+        released.pop_back();
+    }
+
+    blocks[slot].leaf = leaf;
+    blocks[slot].size = 0;
+
+    return slot;
+}
+
+/*
+ * Pre-Conditions:
+ *      Slot of a block.
+ *      References to ints receiving the sums.
+ *
+ * Post-Conditions:
+ *      The numbers of entries & of characters of the block are
+ *      stored in the given ints.
+ *      No changes to `this`.
+ *
+ * Returns the number of entries & of characters of a block.
+ */
+template<typename T>
+void PositionIndex<T>::sum(int slot, int& count, int& weight) const {
+    const Block& block = blocks[slot];
+
+    count = block.leaf ? block.size : 0;
+    weight = 0;
+
+    for (int i = 0; i < block.size; i++) {
+        count += block.leaf ? 0 : block.counts[i];
+        weight += block.weights[i];
+    }
+}
+
+/*
+ * Pre-Conditions:
+ *      Slot of a block.
+ *      int of an entry of its subtree, at most its entries.
+ *      const reference to the value, int of its weight.
+ *      bool, true if the entry is the number of entries.
+ *
+ * Post-Conditions:
+ *      The entry is inserted in the subtree.
+ *      If the block was full, it is split & the slot of the block
+ *      holding its upper half is returned, kNone otherwise.
+ *
+ * Blocks are split on the way back up, only full ones, so a split
+ * costs O(kOrder) & happens once per kOrder / 2 insertions at most.
+ * An entry after every other goes down the last children without
+ * scanning the counts, so appending Nodes one by one stays cheap.
+ * Inserts an entry in the given subtree, returns the block split
+ * off it, if any.
+ */
+template<typename T>
+int PositionIndex<T>::insertInto(int slot, int index, const T& value,
+                                 int weight, bool last) {
+    if (blocks[slot].leaf) {
+        return put(slot, index, value, weight, kNone);
+    }
+
+    const Block& block = blocks[slot];
+    int child = 0;
+
+    if (last) {
+        child = block.size - 1;
+        index = block.counts[child];
+    }
+
+    /* An index past the last child goes to the last child */
+    while (child < block.size - 1 and block.counts[child] < index) {
+        index -= block.counts[child];
+        child++;
+    }
+
+    const int below = insertInto(block.children[child], index, value, weight,
+                                 last);
+
+    /* blocks may have grown while splitting below */
+    Block& parent = blocks[slot];
+
+    if (below == kNone) {
+        parent.counts[child]++;
+        parent.weights[child] += weight;
+
+        return kNone;
+    }
+
+    sum(parent.children[child], parent.counts[child], parent.weights[child]);
+
+    return put(slot, child + 1, value, 0, below);
+}
+
+/*
+ * Pre-Conditions:
+ *      Slot of a block.
+ *      int of the index to put at, at most the size of the block.
+ *      const reference to the value & int of the weight of the
+ *      entry, for a leaf.
+ *      Slot of the child, for a branch.
+ *
+ * Post-Conditions:
+ *      The entry or child is put at the given index.
+ *      If the block was full, it is split & the slot of the block
+ *      holding its upper half is returned, kNone otherwise.
+ *
+ * Puts an entry or a child in a block, returns the block split
+ * off it, if any.
+ */
+template<typename T>
+int PositionIndex<T>::put(int slot, int index, const T& value, int weight,
+                          int child) {
+    int sibling = kNone;
+    int target = slot;
+
+    if (blocks[slot].size == kOrder) {
+        /* Appending keeps the block full, as the next appends follow */
+        const int kept = index == kOrder ? kOrder : kOrder / 2;
+
+        sibling = split(slot, kept);
+
+        if (kept < index or kept == kOrder) {
+            target = sibling;
+            index -= kept;
+        }
+    }
+
+    Block& block = blocks[target];
+
+    if (block.leaf) {
+        std::copy_backward(block.values + index, block.values + block.size,
+                           block.values + block.size + 1);
+        std::copy_backward(block.weights + index, block.weights + block.size,
+                           block.weights + block.size + 1);
+
+        block.values[index] = value;
+        block.weights[index] = weight;
+    } else {
+        std::copy_backward(block.children + index,
+                           block.children + block.size,
+                           block.children + block.size + 1);
+        std::copy_backward(block.counts + index, block.counts + block.size,
+                           block.counts + block.size + 1);
+        std::copy_backward(block.weights + index, block.weights + block.size,
+                           block.weights + block.size + 1);
+
+        block.children[index] = child;
+        sum(child, block.counts[index], block.weights[index]);
+    }
+
+    block.size++;
+
+    return sibling;
+}
+
+/*
+ * Pre-Conditions:
+ *      Slot of a full block.
+ *      int of the entries or children kept, at most kOrder.
+ *
+ * Post-Conditions:
+ *      The entries or children past the given count are moved to
+ *      a new block, whose slot is returned.
+ *      References to the blocks are invalidated.
+ *
+ * Moves the entries of a full block past the given count
+ * to a new block.
+ */
+template<typename T>
+int PositionIndex<T>::split(int slot, int kept) {
+    const int sibling = make(blocks[slot].leaf);
+    Block& block = blocks[slot];
+    Block& upper = blocks[sibling];
+
+    if (block.leaf) {
+        std::copy(block.values + kept, block.values + kOrder, upper.values);
+    } else {
+        std::copy(block.children + kept, block.children + kOrder,
+                  upper.children);
+        std::copy(block.counts + kept, block.counts + kOrder, upper.counts);
+    }
+
+    std::copy(block.weights + kept, block.weights + kOrder, upper.weights);
+
+    upper.size = kOrder - kept;
+    block.size = kept;
+
+    return sibling;
+}
+
+/*
+ * Pre-Conditions:
+ *      Slot of a block.
+ *      int of an entry of its subtree, less than its entries.
+ *
+ * Post-Conditions:
+ *      The entry is removed, emptied blocks below the given one are
+ *      released. The weight of the entry is returned.
+ *
+ * Removes an entry of the given subtree, returns its weight.
+ */
+template<typename T>
+int PositionIndex<T>::eraseFrom(int slot, int index) {
+    Block& block = blocks[slot];
+    int weight = 0;
+
+    if (block.leaf) {
+        weight = block.weights[index];
+
+        std::copy(block.values + index + 1, block.values + block.size,
+                  block.values + index);
+        std::copy(block.weights + index + 1, block.weights + block.size,
+                  block.weights + index);
+
+        block.size--;
+        return weight;
+    }
+
+    int child = 0;
+
+    while (block.counts[child] <= index) {
+        index -= block.counts[child];
+        child++;
+    }
+
+    weight = eraseFrom(block.children[child], index);
+    block.counts[child]--;
+    block.weights[child] -= weight;
+
+    if (block.counts[child]) {
+        return weight;
+    }
+
+    released.push_back(block.children[child]);
+
+    std::copy(block.children + child + 1, block.children + block.size,
+              block.children + child);
+    std::copy(block.counts + child + 1, block.counts + block.size,
+              block.counts + child);
+    std::copy(block.weights + child + 1, block.weights + block.size,
+              block.weights + child);
+
+    block.size--;
+    return weight;
+}
+
+/*
+ * Pre-Conditions:
+ *      Slot of a block.
+ *      int of an entry of its subtree & int of the number of entries
+ *      to replace from it, within its entries.
+ *      Arrays of the values & weights of the new entries & int of
+ *      their number.
+ *      Reference to an int receiving the change of weight.
+ *
+ * Post-Conditions:
+ *      If the entries to replace are in one leaf that can hold the
+ *      new ones without being emptied, they are replaced, the change
+ *      of weight is stored & true is returned.
+ *      Otherwise, false is returned, no changes to `this`.
+ *
+ * The blocks above the leaf are fixed on the way back up.
+ * Replaces entries of a single leaf of the given subtree.
+ */
+template<typename T>
+bool PositionIndex<T>::rewrite(int slot, int index, int count,
+                               const T *values, const int *weights,
+                               int added, int& change) {
+    Block& block = blocks[slot];
+
+    if (block.leaf) {
+        const int size = block.size - count + added;
+
+        if (block.size < index + count or kOrder < size or not size) {
+            return false;
+        }
+
+        change = 0;
+
+        for (int i = index; i < index + count; i++) {
+            change -= block.weights[i];
+        }
+
+        /* Move the entries after the range to their new place */
+        if (added < count) {
+            std::copy(block.values + index + count, block.values + block.size,
+                      block.values + index + added);
+            std::copy(block.weights + index + count,
+                      block.weights + block.size,
+                      block.weights + index + added);
+        } else {
+            std::copy_backward(block.values + index + count,
+                               block.values + block.size,
+                               block.values + size);
+            std::copy_backward(block.weights + index + count,
+                               block.weights + block.size,
+                               block.weights + size);
+        }
+
+        for (int i = 0; i < added; i++) {
+            block.values[index + i] = values[i];
+            block.weights[index + i] = weights[i];
+            change += weights[i];
+        }
+
+        block.size = size;
+        return true;
+    }
+
+    int child = 0;
+
+    /* An empty range may sit at the end of a child */
+    while (child < block.size - 1 and
+           (block.counts[child] < index or
+            (count and block.counts[child] == index))) {
+        index -= block.counts[child];
+        child++;
+    }
+
+    if (not rewrite(block.children[child], index, count, values, weights,
+                    added, change)) {
+        return false;
+    }
+
+    block.counts[child] += added - count;
+    block.weights[child] += change;
+
+    return true;
+}
+
+/*
+ * Pre-Conditions:
+ *      Slot of a block.
+ *      int of an entry of its subtree, less than its entries.
+ *      int of the new weight.
+ *
+ * Post-Conditions:
+ *      The entry & the weights of the blocks above it are changed.
+ *      The change of weight is returned.
+ *
+ * Changes the weight of an entry of the given subtree,
+ * returns the change.
+ */
+template<typename T>
+int PositionIndex<T>::reweigh(int slot, int index, int weight) {
+    Block& block = blocks[slot];
+
+    if (block.leaf) {
+        const int change = weight - block.weights[index];
+
+        block.weights[index] = weight;
+        return change;
+    }
+
+    int child = 0;
+
+    while (block.counts[child] <= index) {
+        index -= block.counts[child];
+        child++;
+    }
+
+    const int change = reweigh(block.children[child], index, weight);
+
+    block.weights[child] += change;
+    return change;
+}
+
+/*
+ * Pre-Conditions:
+ *      Slot of a block.
+ *      int of the first entry of its subtree to visit.
+ *      Reference to a visitor callable with a const T&.
+ *
+ * Post-Conditions:
+ *      The visitor is called with the values of the subtree from
+ *      the entry on, until it returns false.
+ *      Returns false if the visitor stopped the visit.
+ *
+ * Visits the values of the given subtree from the given entry on.
+ */
+template<typename T>
+template<typename Visitor>
+bool PositionIndex<T>::visit(int slot, int index, Visitor& visitor) const {
+    const Block& block = blocks[slot];
+
+    if (block.leaf) {
+        for (int i = index; i < block.size; i++) {
+            if (not visitor(block.values[i])) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    int child = 0;
+
+    while (block.counts[child] <= index) {
+        index -= block.counts[child];
+        child++;
+    }
+
+    for (; child < block.size; child++) {
+        if (not visit(block.children[child], index, visitor)) {
+            return false;
+        }
+
+        index = 0;
+    }
+
+    return true;
+}
+
+#endif /* MYSTRINGBUILDER_POSITIONINDEX_H */
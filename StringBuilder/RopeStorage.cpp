@@ -0,0 +1,976 @@
+/*
+ * StringBuilder Project
+ *
+ *
+ * RopeStorage.cpp
+ *
+ * Date:        17/10/2026
+ *
+ * Author:      Mahmoud Yaman Seraj Alddin
+ *
+ * Purpose:     Implementation of the RopeStorage class,
+ *              described in RopeStorage.h
+ *
+ * List of public Functions:
+ *      RopeStorage()
+ *          No-arg constructor of the RopeStorage class.
+ *
+ *      RopeStorage(const char*, int)
+ *          Parameterized constructor of the RopeStorage class.
+ *
+ *      ~RopeStorage()
+ *          Destructor for the RopeStorage class.
+ *
+ *      Storage* copy(int begin, int end) const
+ *          Returns a new RopeStorage holding a copy of the characters
+ *          between begin (inclusive) & end (exclusive).
+ *
+ *      int length() const
+ *          Returns the number of characters in the rope.
+ *
+ *      char charAt(int) const
+ *          Returns the character at the given position.
+ *
+ *      void insert(int, const char*, int)
+ *          Inserts a copy of the given characters at the given position.
+ *
+ *      void insert(int, const Storage&)
+ *          Inserts a copy of the characters of the given Storage at the
+ *          given position.
+ *
+ *      void splice(int, Storage&)
+ *          Moves the characters of the given Storage to the given position,
+ *          leaving the given Storage empty.
+ *
+ *      void erase(int begin, int end)
+ *          Removes the characters between begin (inclusive)
+ *          & end (exclusive).
+ *
+ *      bool forEachChunk(int begin, int end, const ChunkVisitor&) const
+ *          Visits the characters between begin & end as contiguous chunks.
+ *
+ *      void forEachMutableChunk(int begin, int end,
+ *                               const MutableChunkVisitor&)
+ *          Visits the characters between begin & end as writable
+ *          contiguous chunks.
+ *
+ * List of private Functions:
+ *      RopeStorage(RopeNode*)
+ *          Parameterized constructor of the RopeStorage class.
+ *          Takes a reference to the given tree.
+ *
+ *      static int height(const RopeNode*)
+ *          Returns the height of the given tree, -1 for nullptr.
+ *
+ *      static void update(RopeNode*)
+ *          Recomputes the length & height of the given branch.
+ *
+ *      static RopeNode* makeLeaf(const char*, int)
+ *          Returns a new leaf holding a copy of the given characters.
+ *
+ *      static RopeNode* makeBranch(RopeNode*, RopeNode*)
+ *          Returns a new branch with the given children.
+ *
+ *      static RopeNode* rotateLeft(RopeNode*)
+ *          Rotates the given branch to the left.
+ *
+ *      static RopeNode* rotateRight(RopeNode*)
+ *          Rotates the given branch to the right.
+ *
+ *      static RopeNode* rebalance(RopeNode*)
+ *          Restores the AVL balance of the given branch.
+ *
+ *      static RopeNode* join(RopeNode*, RopeNode*)
+ *          Returns a balanced tree of the left tree followed by the right.
+ *
+ *      static RopeNode* concat(RopeNode*, RopeNode*)
+ *          Same as join, but merges a single leaf into its neighbour leaf
+ *          when it has room.
+ *
+ *      static std::pair<RopeNode*, RopeNode*> split(RopeNode*, int)
+ *          Splits the given tree into the characters before & after the
+ *          given position.
+ *
+ *      static bool appendToLast(RopeNode*&, const char*, int)
+ *          Appends the given text to the last leaf of the tree,
+ *          if it has room.
+ *
+ *      static bool prependToFirst(RopeNode*&, const std::string&)
+ *          Prepends the given text to the first leaf of the tree,
+ *          if it has room.
+ *
+ *      static void pack(std::vector<RopeNode*>&, const char*, int)
+ *          Adds the given characters to a list of full leaves.
+ *
+ *      static RopeNode* build(const std::vector<RopeNode*>&, int, int)
+ *          Returns a balanced tree over the given leaves.
+ *
+ *      static bool visit(const RopeNode*, int, int, const ChunkVisitor&)
+ *          Visits the leaves of the tree between the given positions.
+ *
+ *      static void visitMutable(RopeNode*&, int, int,
+ *                               const MutableChunkVisitor&)
+ *          Visits the leaves of the tree between the given positions,
+ *          allowing changes.
+ *
+ *      static RopeNode* retain(RopeNode*)
+ *          Adds a reference to the given tree.
+ *
+ *      static RopeNode* own(RopeNode*)
+ *          Returns a node only referenced by the caller, with the content
+ *          of the given node.
+ *
+ *      static void release(RopeNode*)
+ *          Removes a reference to the given tree, deletes the nodes
+ *          that are no longer referenced.
+ */
+
+#include <algorithm>
+
+#include "RopeStorage.h"
+
+using namespace std;
+
+/*
+ * Pre-Conditions:
+ *      No preconditions.
+ *
+ * Post-Conditions:
+ *      An empty RopeStorage instance is created.
+ *      root is initialized to nullptr.
+ *
+ * No-arg constructor of the RopeStorage class.
+ */
+RopeStorage::RopeStorage(): root{nullptr} {}
+
+/*
+ * Pre-Conditions:
+ *      Pointer to the characters to copy & their count.
+ *
+ * Post-Conditions:
+ *      A RopeStorage instance holding the given characters is created.
+ *
+ * The leaves are filled to capacity & the tree is built bottom-up,
+ * so construction is O(n).
+ * Parameterized constructor of the RopeStorage class.
+ */
+RopeStorage::RopeStorage(const char *data, int count): root{nullptr} {
+    vector<RopeNode*> leaves;
+
+    pack(leaves, data, count);
+    root = build(leaves, 0, (int) leaves.size());
+}
+
+/*
+ * Pre-Conditions:
+ *      Pointer to a balanced tree, or nullptr.
+ *
+ * Post-Conditions:
+ *      A RopeStorage instance holding the given tree is created.
+ *
+ * Marked explicit to prevent implicit conversions from RopeNode*.
+ * Parameterized constructor of the RopeStorage class.
+ * Takes a reference to the given tree.
+ */
+RopeStorage::RopeStorage(RopeNode *tree): root{tree} {}
+
+/*
+ * Pre-Conditions:
+ *      `this` RopeStorage instance is not destroyed.
+ *
+ * Post-Conditions:
+ *      `this` RopeStorage instance is destroyed,
+ *      with the nodes not shared with another rope.
+ *
+ * Destructor for the RopeStorage class.
+ */
+RopeStorage::~RopeStorage() {
+    release(root);
+    root = nullptr;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` RopeStorage instance is initialized.
+ *      begin & end are valid positions, begin <= end.
+ *
+ * Post-Conditions:
+ *      A heap allocated RopeStorage is returned.
+ *      No changes to the characters of `this`.
+ *
+ * The copy shares the subtrees inside the range with `this`,
+ * only the nodes on the paths to begin & end are new, O(log n).
+ * A copy of the whole rope shares its root, O(1).
+ * Returns a new RopeStorage holding a copy of the characters
+ * between begin (inclusive) & end (exclusive).
+ */
+Storage* RopeStorage::copy(int begin, int end) const {
+    const auto head = split(retain(root), begin);
+    const auto tail = split(head.second, end - begin);
+
+    release(head.first);
+    release(tail.second);
+
+    return new RopeStorage(tail.first);
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` RopeStorage instance is initialized.
+ *
+ * Post-Conditions:
+ *      Number of characters in the rope is returned.
+ *      No changes to `this`.
+ *
+ * Returns the number of characters in the rope.
+ */
+int RopeStorage::length() const {
+    return root ? root->length : 0;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` RopeStorage instance is initialized.
+ *      Given int position is valid, less than length().
+ *
+ * Post-Conditions:
+ *      Character at the given position is returned.
+ *      No changes to `this`.
+ *
+ * Descends from the root, using the cached lengths to pick a child.
+ * Returns the character at the given position.
+ */
+char RopeStorage::charAt(int position) const {
+    const RopeNode *current = root;
+
+    /* Descend until the leaf holding the position is reached */
+    while (current->left) {
+        if (position < current->left->length) {
+            current = current->left;
+        } else {
+            position -= current->left->length;
+            current = current->right;
+        }
+    }
+
+    return current->text[position];
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` RopeStorage instance is initialized.
+ *      Given int position is valid.
+ *      Pointer to the characters to insert & their count.
+ *
+ * Post-Conditions:
+ *      The given characters are inserted at the given position.
+ *
+ * Appending to a last leaf with room writes into the leaf, without
+ * allocating, which keeps small appends such as numbers cheap.
+ * Otherwise the rope is split at the position, then joined around
+ * a tree built from the given characters.
+ * Inserts a copy of the given characters at the given position.
+ */
+void RopeStorage::insert(int position, const char *data, int count) {
+    if (count <= 0) {
+        return;
+    } else if (root and position == root->length
+               and appendToLast(root, data, count)) {
+        return;
+    }
+
+    vector<RopeNode*> leaves;
+    pack(leaves, data, count);
+
+    const auto parts = split(root, position);
+
+    root = concat(concat(parts.first, build(leaves, 0, (int) leaves.size())),
+                  parts.second);
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` RopeStorage instance is initialized.
+ *      Given int position is valid.
+ *      const reference to a Storage other than `this`.
+ *
+ * Post-Conditions:
+ *      The characters of the given Storage are inserted
+ *      at the given position.
+ *      No changes to the given Storage.
+ *
+ * The tree of another RopeStorage is shared, not copied.
+ * For other Storages, the copy is built as a separate tree first,
+ * so the rope is only split & joined once.
+ * Inserts a copy of the characters of the given Storage at the
+ * given position.
+ */
+void RopeStorage::insert(int position, const Storage& source) {
+    auto rope = dynamic_cast<const RopeStorage*>(&source);
+
+    if (rope) {
+        /* Retained before the split, the source may be `this` */
+        RopeNode *shared = retain(rope->root);
+        const auto parts = split(root, position);
+
+        root = concat(concat(parts.first, shared), parts.second);
+        return;
+    }
+
+    vector<RopeNode*> leaves;
+
+    source.forEachChunk(0, source.length(),
+                        [&leaves](const char *data, int count) {
+        pack(leaves, data, count);
+        return true;
+    });
+
+    if (leaves.empty()) {
+        return;
+    }
+
+    const auto parts = split(root, position);
+
+    root = concat(concat(parts.first, build(leaves, 0, (int) leaves.size())),
+                  parts.second);
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` RopeStorage instance is initialized.
+ *      Given int position is valid.
+ *      Reference to a Storage other than `this`.
+ *
+ * Post-Conditions:
+ *      The characters of the given Storage are inserted
+ *      at the given position.
+ *      The given Storage is empty.
+ *
+ * The tree of another RopeStorage is joined in as is, O(log n),
+ * other Storages are copied.
+ * Moves the characters of the given Storage to the given position,
+ * leaving the given Storage empty.
+ */
+void RopeStorage::splice(int position, Storage& source) {
+    auto rope = dynamic_cast<RopeStorage*>(&source);
+
+    if (not rope) {
+        Storage::splice(position, source);
+        return;
+    }
+
+    const auto parts = split(root, position);
+
+    root = concat(concat(parts.first, rope->root), parts.second);
+    rope->root = nullptr;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` RopeStorage instance is initialized.
+ *      begin & end are valid positions, begin <= end.
+ *
+ * Post-Conditions:
+ *      The characters between begin & end are removed.
+ *
+ * The rope is split around the range, the middle tree is deleted
+ * & the remaining trees are joined.
+ * Removes the characters between begin (inclusive) & end (exclusive).
+ */
+void RopeStorage::erase(int begin, int end) {
+    if (end <= begin) {
+        return;
+    }
+
+    const auto head = split(root, begin);
+    const auto tail = split(head.second, end - begin);
+
+    release(tail.first);
+    root = concat(head.first, tail.second);
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` RopeStorage instance is initialized.
+ *      begin & end are valid positions, begin <= end.
+ *      const reference to a ChunkVisitor.
+ *
+ * Post-Conditions:
+ *      The visitor is called, in order, for each leaf run between
+ *      begin & end, until it returns false.
+ *      Returns false if the visitor stopped the visit.
+ *      No changes to `this`.
+ *
+ * Visits the characters between begin & end as contiguous chunks.
+ */
+bool RopeStorage::forEachChunk(int begin, int end,
+                               const ChunkVisitor& visitor) const {
+    if (end <= begin) {
+        return true;
+    }
+
+    return visit(root, begin, end, visitor);
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` RopeStorage instance is initialized.
+ *      begin & end are valid positions, begin <= end.
+ *      const reference to a MutableChunkVisitor.
+ *
+ * Post-Conditions:
+ *      The visitor is called, in order, for each leaf run between
+ *      begin & end.
+ *      Changes made by the visitor are stored in the leaves.
+ *
+ * Visits the characters between begin & end as writable
+ * contiguous chunks.
+ */
+void RopeStorage::forEachMutableChunk(int begin, int end,
+                                      const MutableChunkVisitor& visitor) {
+    if (end <= begin) {
+        return;
+    }
+
+    visitMutable(root, begin, end, visitor);
+}
+
+/*
+ * Pre-Conditions:
+ *      Pointer to a tree, or nullptr.
+ *
+ * Post-Conditions:
+ *      Height of the tree is returned, -1 for nullptr.
+ *
+ * Returns the height of the given tree, -1 for nullptr.
+ */
+int RopeStorage::height(const RopeNode *node) {
+    return node ? node->height : -1;
+}
+
+/*
+ * Pre-Conditions:
+ *      Pointer to a branch with both children.
+ *
+ * Post-Conditions:
+ *      length & height of the branch match its children.
+ *
+ * Recomputes the length & height of the given branch.
+ */
+void RopeStorage::update(RopeNode *branch) {
+    branch->length = branch->left->length + branch->right->length;
+    branch->height = 1 + max(branch->left->height, branch->right->height);
+}
+
+/*
+ * Pre-Conditions:
+ *      Pointer to the characters to copy & their count.
+ *
+ * Post-Conditions:
+ *      A heap allocated leaf is returned.
+ *
+ * Returns a new leaf holding a copy of the given characters.
+ */
+RopeStorage::RopeNode* RopeStorage::makeLeaf(const char *data, int count) {
+    return new RopeNode{nullptr, nullptr, count, 0, 1, string(data, count)};
+}
+
+/*
+ * Pre-Conditions:
+ *      Pointers to two non-empty trees.
+ *
+ * Post-Conditions:
+ *      A heap allocated branch holding the references to both trees
+ *      is returned.
+ *
+ * Returns a new branch with the given children.
+ */
+RopeStorage::RopeNode* RopeStorage::makeBranch(RopeNode *left,
+                                               RopeNode *right) {
+    auto branch = new RopeNode{left, right, 0, 0, 1, {}};
+
+    update(branch);
+    return branch;
+}
+
+/*
+ * Pre-Conditions:
+ *      Pointer to an unshared branch whose right child is a branch.
+ *
+ * Post-Conditions:
+ *      The new root of the subtree is returned.
+ *
+ * Rotates the given branch to the left.
+ */
+RopeStorage::RopeNode* RopeStorage::rotateLeft(RopeNode *branch) {
+    RopeNode *pivot = own(branch->right);
+
+    branch->right = pivot->left;
+    update(branch);
+
+    pivot->left = branch;
+    update(pivot);
+
+    return pivot;
+}
+
+/*
+ * Pre-Conditions:
+ *      Pointer to an unshared branch whose left child is a branch.
+ *
+ * Post-Conditions:
+ *      The new root of the subtree is returned.
+ *
+ * Rotates the given branch to the right.
+ */
+RopeStorage::RopeNode* RopeStorage::rotateRight(RopeNode *branch) {
+    RopeNode *pivot = own(branch->left);
+
+    branch->left = pivot->right;
+    update(branch);
+
+    pivot->right = branch;
+    update(pivot);
+
+    return pivot;
+}
+
+/*
+ * Pre-Conditions:
+ *      Pointer to an unshared branch whose children differ in height
+ *      by 2 at most.
+ *
+ * Post-Conditions:
+ *      The root of the balanced subtree is returned.
+ *
+ * Restores the AVL balance of the given branch,
+ * using a single or a double rotation.
+ */
+RopeStorage::RopeNode* RopeStorage::rebalance(RopeNode *branch) {
+    update(branch);
+
+    const int balance = branch->left->height - branch->right->height;
+
+    if (1 < balance) {
+        /* Left heavy */
+        if (height(branch->left->left) < height(branch->left->right)) {
+            branch->left = rotateLeft(own(branch->left));
+        }
+
+        return rotateRight(branch);
+    } else if (balance < -1) {
+        /* Right heavy */
+        if (height(branch->right->right) < height(branch->right->left)) {
+            branch->right = rotateRight(own(branch->right));
+        }
+
+        return rotateLeft(branch);
+    }
+
+    return branch;
+}
+
+/*
+ * Pre-Conditions:
+ *      Pointers to two balanced trees, or nullptr.
+ *
+ * Post-Conditions:
+ *      The root of a balanced tree owning both trees is returned.
+ *
+ * Descends the spine of the taller tree until both heights are close,
+ * then rebalances on the way back up, O(height difference).
+ * Returns a balanced tree of the left tree followed by the right.
+ */
+RopeStorage::RopeNode* RopeStorage::join(RopeNode *left, RopeNode *right) {
+    if (not left) {
+        return right;
+    } else if (not right) {
+        return left;
+    }
+
+    if (right->height + 1 < left->height) {
+        left = own(left);
+        left->right = join(left->right, right);
+        return rebalance(left);
+    } else if (left->height + 1 < right->height) {
+        right = own(right);
+        right->left = join(left, right->left);
+        return rebalance(right);
+    }
+
+    /* Merge two adjacent leaves that fit in a single leaf */
+    if (not left->left and not right->left
+        and left->length + right->length <= kLeafCapacity) {
+        left = own(left);
+        left->text.append(right->text);
+        left->length += right->length;
+
+        release(right);
+        return left;
+    }
+
+    return makeBranch(left, right);
+}
+
+/*
+ * Pre-Conditions:
+ *      Pointers to two balanced trees, or nullptr.
+ *
+ * Post-Conditions:
+ *      The root of a balanced tree owning both trees is returned.
+ *
+ * Prevents a run of small appends or prepends from creating a leaf each.
+ * Same as join, but merges a single leaf into its neighbour leaf
+ * when it has room.
+ */
+RopeStorage::RopeNode* RopeStorage::concat(RopeNode *left, RopeNode *right) {
+    if (not left) {
+        return right;
+    } else if (not right) {
+        return left;
+    }
+
+    if (not right->left
+        and appendToLast(left, right->text.data(), right->length)) {
+        release(right);
+        return left;
+    } else if (not left->left and prependToFirst(right, left->text)) {
+        release(left);
+        return right;
+    }
+
+    return join(left, right);
+}
+
+/*
+ * Pre-Conditions:
+ *      Pointer to a balanced tree, or nullptr.
+ *      Position to split at.
+ *
+ * Post-Conditions:
+ *      The given tree is consumed.
+ *      A pair of balanced trees holding the characters before
+ *      & after the position is returned.
+ *
+ * Branches along the path to the position are released, the subtrees
+ * hanging off the path are joined back, O(log n).
+ * Only the shared nodes on the path are copied.
+ * Splits the given tree into the characters before & after the
+ * given position.
+ */
+pair<RopeStorage::RopeNode*, RopeStorage::RopeNode*>
+RopeStorage::split(RopeNode *node, int position) {
+    if (not node or position <= 0) {
+        return {nullptr, node};
+    } else if (node->length <= position) {
+        return {node, nullptr};
+    }
+
+    if (not node->left) {
+        /* Split the leaf itself */
+        RopeNode *tail = makeLeaf(node->text.data() + position,
+                                  node->length - position);
+
+        node = own(node);
+        node->text.resize(position);
+        node->length = position;
+
+        return {node, tail};
+    }
+
+    /* The children outlive the branch, if it is not shared */
+    RopeNode *left = retain(node->left), *right = retain(node->right);
+    release(node);
+
+    if (position < left->length) {
+        const auto parts = split(left, position);
+        return {parts.first, join(parts.second, right)};
+    } else if (position == left->length) {
+        return {left, right};
+    }
+
+    const auto parts = split(right, position - left->length);
+    return {join(left, parts.first), parts.second};
+}
+
+/*
+ * Pre-Conditions:
+ *      Reference to a pointer to a non-empty tree.
+ *      Pointer to the characters to append & their count.
+ *
+ * Post-Conditions:
+ *      Returns true if the text was appended to the last leaf,
+ *      the pointer is changed to the root of the changed tree.
+ *      lengths along the right spine are updated.
+ *
+ * The room of the last leaf is checked first, so the shared nodes of
+ * the right spine are only copied if the text is appended.
+ * Appends the given text to the last leaf of the tree, if it has room.
+ */
+bool RopeStorage::appendToLast(RopeNode*& node, const char *data,
+                               int count) {
+    const RopeNode *last = node;
+
+    while (last->left) {
+        last = last->right;
+    }
+
+    if (kLeafCapacity < last->length + count) {
+        return false;
+    }
+
+    node = own(node);
+
+    /* Descend the right spine, owning each node before changing it */
+    for (RopeNode *current = node;; current = current->right) {
+        current->length += count;
+
+        if (not current->left) {
+            current->text.append(data, count);
+            return true;
+        }
+
+        current->right = own(current->right);
+    }
+}
+
+/*
+ * Pre-Conditions:
+ *      Reference to a pointer to a non-empty tree.
+ *      const reference to the text to prepend.
+ *
+ * Post-Conditions:
+ *      Returns true if the text was prepended to the first leaf,
+ *      the pointer is changed to the root of the changed tree.
+ *      lengths along the left spine are updated.
+ *
+ * The room of the first leaf is checked first, so the shared nodes of
+ * the left spine are only copied if the text is prepended.
+ * Prepends the given text to the first leaf of the tree,
+ * if it has room.
+ */
+bool RopeStorage::prependToFirst(RopeNode*& node, const string& text) {
+    const int count = (int) text.size();
+    const RopeNode *first = node;
+
+    while (first->left) {
+        first = first->left;
+    }
+
+    if (kLeafCapacity < first->length + count) {
+        return false;
+    }
+
+    node = own(node);
+
+    /* Descend the left spine, owning each node before changing it */
+    for (RopeNode *current = node;; current = current->left) {
+        current->length += count;
+
+        if (not current->left) {
+            current->text.insert(0, text);
+            return true;
+        }
+
+        current->left = own(current->left);
+    }
+}
+
+/*
+ * Pre-Conditions:
+ *      Reference to a list of leaves not owned by any tree.
+ *      Pointer to the characters to copy & their count.
+ *
+ * Post-Conditions:
+ *      The characters are added to the last leaf until it is full,
+ *      then to new leaves.
+ *
+ * Adds the given characters to a list of full leaves.
+ */
+void RopeStorage::pack(vector<RopeNode*>& leaves,
+                       const char *data, int count) {
+    while (0 < count) {
+        if (leaves.empty() or leaves.back()->length == kLeafCapacity) {
+            leaves.push_back(makeLeaf(data, 0));
+            leaves.back()->text.reserve(kLeafCapacity);
+        }
+
+        RopeNode *last = leaves.back();
+        const int taken = min(count, kLeafCapacity - last->length);
+
+        last->text.append(data, taken);
+        last->length += taken;
+
+        data += taken;
+        count -= taken;
+    }
+}
+
+/*
+ * Pre-Conditions:
+ *      const reference to a list of leaves.
+ *      Range of the leaves to use, begin (inclusive) & end (exclusive).
+ *
+ * Post-Conditions:
+ *      The root of a balanced tree over the leaves is returned,
+ *      nullptr for an empty range.
+ *
+ * Halves the range recursively, so the heights of sibling subtrees
+ * differ by 1 at most.
+ * Returns a balanced tree over the given leaves.
+ */
+RopeStorage::RopeNode* RopeStorage::build(const vector<RopeNode*>& leaves,
+                                          int begin, int end) {
+    if (end <= begin) {
+        return nullptr;
+    } else if (end - begin == 1) {
+        return leaves[begin];
+    }
+
+    const int middle = begin + (end - begin) / 2;
+
+    return makeBranch(build(leaves, begin, middle),
+                      build(leaves, middle, end));
+}
+
+/*
+ * Pre-Conditions:
+ *      Pointer to a non-empty tree.
+ *      begin & end are valid positions in the tree, begin < end.
+ *      const reference to a ChunkVisitor.
+ *
+ * Post-Conditions:
+ *      Returns false if the visitor stopped the visit.
+ *
+ * Subtrees outside the range are not entered.
+ * Visits the leaves of the tree between the given positions.
+ */
+bool RopeStorage::visit(const RopeNode *node, int begin, int end,
+                        const ChunkVisitor& visitor) {
+    if (not node->left) {
+        return visitor(node->text.data() + begin, end - begin);
+    }
+
+    const int pivot = node->left->length;
+
+    if (begin < pivot
+        and not visit(node->left, begin, min(end, pivot), visitor)) {
+        return false;
+    }
+
+    if (pivot < end) {
+        return visit(node->right, max(begin - pivot, 0), end - pivot,
+                     visitor);
+    }
+
+    return true;
+}
+
+/*
+ * Pre-Conditions:
+ *      Reference to a pointer to a non-empty tree.
+ *      begin & end are valid positions in the tree, begin < end.
+ *      const reference to a MutableChunkVisitor.
+ *
+ * Post-Conditions:
+ *      Changes made by the visitor are stored in the leaves.
+ *      Shared nodes on the visited paths are replaced by copies,
+ *      the pointer is changed to the root of the changed tree.
+ *
+ * Subtrees outside the range are not entered, nor copied.
+ * Visits the leaves of the tree between the given positions,
+ * allowing changes.
+ */
+void RopeStorage::visitMutable(RopeNode*& node, int begin, int end,
+                               const MutableChunkVisitor& visitor) {
+    node = own(node);
+
+    if (not node->left) {
+        visitor(&node->text[begin], end - begin);
+        return;
+    }
+
+    const int pivot = node->left->length;
+
+    if (begin < pivot) {
+        visitMutable(node->left, begin, min(end, pivot), visitor);
+    }
+
+    if (pivot < end) {
+        visitMutable(node->right, max(begin - pivot, 0), end - pivot,
+                     visitor);
+    }
+}
+
+/*
+ * Pre-Conditions:
+ *      Pointer to a tree, or nullptr.
+ *
+ * Post-Conditions:
+ *      references of the root is increased by 1.
+ *      The given pointer is returned.
+ *
+ * Adds a reference to the given tree.
+ */
+RopeStorage::RopeNode* RopeStorage::retain(RopeNode *node) {
+    if (node) {
+        /* The caller already holds a reference, no ordering needed */
+        node->references.fetch_add(1, memory_order_relaxed);
+    }
+
+    return node;
+}
+
+/*
+ * Pre-Conditions:
+ *      Pointer to a node, whose reference is held by the caller.
+ *
+ * Post-Conditions:
+ *      A node with the same content & a single reference is returned.
+ *      If the given node is shared, it is copied & loses the
+ *      reference of the caller.
+ *
+ * The copy references the children of the node, so only the node
+ * itself is copied, not its subtree.
+ * Returns a node only referenced by the caller, with the content
+ * of the given node.
+ */
+RopeStorage::RopeNode* RopeStorage::own(RopeNode *node) {
+    /* Acquire, the other owners are done with the node before it changes */
+    if (node->references.load(memory_order_acquire) == 1) {
+        return node;
+    }
+
+    auto copy = new RopeNode{retain(node->left), retain(node->right),
+                             node->length, node->height, 1, node->text};
+
+    /* The other owners may have released the node meanwhile */
+    release(node);
+    return copy;
+}
+
+/*
+ * Pre-Conditions:
+ *      Pointer to a tree, or nullptr, whose reference is held
+ *      by the caller.
+ *
+ * Post-Conditions:
+ *      references of the root is decreased by 1.
+ *      Nodes that are no longer referenced are deleted.
+ *
+ * Recursion depth is bounded by the height of the tree,
+ * shared subtrees are not entered.
+ * Removes a reference to the given tree, deletes the nodes
+ * that are no longer referenced.
+ */
+void RopeStorage::release(RopeNode *node) {
+    if (not node
+        or 1 < node->references.fetch_sub(1, memory_order_acq_rel)) {
+        return;
+    }
+
+    release(node->left);
+    release(node->right);
+
+    delete node;
+}
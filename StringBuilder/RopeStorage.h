@@ -0,0 +1,605 @@
+/*
+ * StringBuilder Project
+ *
+ *
+ * RopeStorage.h
+ *
+ * Date:        17/10/2026
+ *
+ * Author:      Mahmoud Yaman Seraj Alddin
+ *
+ * Purpose:     Header file for the RopeStorage class,
+ *              the balanced rope storage of MyStringBuilder.
+ *
+ * List of public Functions:
+ *      RopeStorage()
+ *          No-arg constructor of the RopeStorage class.
+ *
+ *      RopeStorage(const char*, int)
+ *          Parameterized constructor of the RopeStorage class.
+ *
+ *      ~RopeStorage()
+ *          Destructor for the RopeStorage class.
+ *
+ *      Storage* copy(int begin, int end) const
+ *          Returns a new RopeStorage holding a copy of the characters
+ *          between begin (inclusive) & end (exclusive).
+ *
+ *      int length() const
+ *          Returns the number of characters in the rope.
+ *
+ *      char charAt(int) const
+ *          Returns the character at the given position.
+ *
+ *      void insert(int, const char*, int)
+ *          Inserts a copy of the given characters at the given position.
+ *
+ *      void insert(int, const Storage&)
+ *          Inserts a copy of the characters of the given Storage at the
+ *          given position.
+ *
+ *      void splice(int, Storage&)
+ *          Moves the characters of the given Storage to the given position,
+ *          leaving the given Storage empty.
+ *
+ *      void erase(int begin, int end)
+ *          Removes the characters between begin (inclusive)
+ *          & end (exclusive).
+ *
+ *      bool forEachChunk(int begin, int end, const ChunkVisitor&) const
+ *          Visits the characters between begin & end as contiguous chunks.
+ *
+ *      void forEachMutableChunk(int begin, int end,
+ *                               const MutableChunkVisitor&)
+ *          Visits the characters between begin & end as writable
+ *          contiguous chunks.
+ *
+ * List of private Functions:
+ *      RopeStorage(RopeNode*)
+ *          Parameterized constructor of the RopeStorage class.
+ *          Takes a reference to the given tree.
+ *
+ *      static int height(const RopeNode*)
+ *          Returns the height of the given tree, -1 for nullptr.
+ *
+ *      static void update(RopeNode*)
+ *          Recomputes the length & height of the given branch.
+ *
+ *      static RopeNode* makeLeaf(const char*, int)
+ *          Returns a new leaf holding a copy of the given characters.
+ *
+ *      static RopeNode* makeBranch(RopeNode*, RopeNode*)
+ *          Returns a new branch with the given children.
+ *
+ *      static RopeNode* rotateLeft(RopeNode*)
+ *          Rotates the given branch to the left.
+ *
+ *      static RopeNode* rotateRight(RopeNode*)
+ *          Rotates the given branch to the right.
+ *
+ *      static RopeNode* rebalance(RopeNode*)
+ *          Restores the AVL balance of the given branch.
+ *
+ *      static RopeNode* join(RopeNode*, RopeNode*)
+ *          Returns a balanced tree of the left tree followed by the right.
+ *
+ *      static RopeNode* concat(RopeNode*, RopeNode*)
+ *          Same as join, but merges a single leaf into its neighbour leaf
+ *          when it has room.
+ *
+ *      static std::pair<RopeNode*, RopeNode*> split(RopeNode*, int)
+ *          Splits the given tree into the characters before & after the
+ *          given position.
+ *
+ *      static bool appendToLast(RopeNode*&, const char*, int)
+ *          Appends the given text to the last leaf of the tree,
+ *          if it has room.
+ *
+ *      static bool prependToFirst(RopeNode*&, const std::string&)
+ *          Prepends the given text to the first leaf of the tree,
+ *          if it has room.
+ *
+ *      static void pack(std::vector<RopeNode*>&, const char*, int)
+ *          Adds the given characters to a list of full leaves.
+ *
+ *      static RopeNode* build(const std::vector<RopeNode*>&, int, int)
+ *          Returns a balanced tree over the given leaves.
+ *
+ *      static bool visit(const RopeNode*, int, int, const ChunkVisitor&)
+ *          Visits the leaves of the tree between the given positions.
+ *
+ *      static void visitMutable(RopeNode*&, int, int,
+ *                               const MutableChunkVisitor&)
+ *          Visits the leaves of the tree between the given positions,
+ *          allowing changes.
+ *
+ *      static RopeNode* retain(RopeNode*)
+ *          Adds a reference to the given tree.
+ *
+ *      static RopeNode* own(RopeNode*)
+ *          Returns a node only referenced by the caller, with the content
+ *          of the given node.
+ *
+ *      static void release(RopeNode*)
+ *          Removes a reference to the given tree, deletes the nodes
+ *          that are no longer referenced.
+ */
+
+#ifndef MYSTRINGBUILDER_ROPESTORAGE_H
+#define MYSTRINGBUILDER_ROPESTORAGE_H
+
+#include <atomic>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Storage.h"
+
+/*
+ * RopeStorage stores the characters in the leaves of an AVL balanced
+ * binary tree, each branch caching the number of characters below it.
+ * Positional operations are O(log n).
+ * Nodes are reference counted & shared between ropes, copies &
+ * insertions of other ropes share their subtrees, a shared node is
+ * copied on its first change (copy-on-write).
+ */
+class RopeStorage : public Storage {
+public:
+    /* Maximum number of characters stored in a single leaf */
+    static const int kLeafCapacity = 512;
+
+    /*
+     * Pre-Conditions:
+     *      No preconditions.
+     *
+     * Post-Conditions:
+     *      An empty RopeStorage instance is created.
+     *      root is nullptr.
+     *
+     * No-arg constructor of the RopeStorage class.
+     */
+    RopeStorage();
+
+    /*
+     * Pre-Conditions:
+     *      Pointer to the characters to copy & their count.
+     *
+     * Post-Conditions:
+     *      A RopeStorage instance holding the given characters is created.
+     *
+     * Parameterized constructor of the RopeStorage class.
+     */
+    RopeStorage(const char*, int);
+
+    /*
+     * Pre-Conditions:
+     *      `this` RopeStorage instance is not destroyed.
+     *
+     * Post-Conditions:
+     *      `this` RopeStorage instance & all its nodes are destroyed.
+     *
+     * Destructor for the RopeStorage class.
+     */
+    ~RopeStorage() override;
+
+    /*
+     * Pre-Conditions:
+     *      `this` RopeStorage instance is initialized.
+     *      begin & end are valid positions, begin <= end.
+     *
+     * Post-Conditions:
+     *      A heap allocated RopeStorage is returned.
+     *      No changes to the characters of `this`.
+     *
+     * The copy shares the nodes of `this`, O(log n).
+     * Returns a new RopeStorage holding a copy of the characters
+     * between begin (inclusive) & end (exclusive).
+     */
+    [[nodiscard]] Storage* copy(int /* begin */,
+                                int /* end */) const override;
+
+    /*
+     * Pre-Conditions:
+     *      `this` RopeStorage instance is initialized.
+     *
+     * Post-Conditions:
+     *      Number of characters in the rope is returned.
+     *      No changes to `this`.
+     *
+     * Returns the number of characters in the rope.
+     */
+    [[nodiscard]] int length() const override;
+
+    /*
+     * Pre-Conditions:
+     *      `this` RopeStorage instance is initialized.
+     *      Given int position is valid, less than length().
+     *
+     * Post-Conditions:
+     *      Character at the given position is returned.
+     *      No changes to `this`.
+     *
+     * Returns the character at the given position.
+     */
+    [[nodiscard]] char charAt(int) const override;
+
+    /*
+     * Pre-Conditions:
+     *      `this` RopeStorage instance is initialized.
+     *      Given int position is valid.
+     *      Pointer to the characters to insert & their count.
+     *
+     * Post-Conditions:
+     *      The given characters are inserted at the given position.
+     *
+     * Inserts a copy of the given characters at the given position.
+     */
+    void insert(int, const char*, int) override;
+
+    /*
+     * Pre-Conditions:
+     *      `this` RopeStorage instance is initialized.
+     *      Given int position is valid.
+     *      const reference to a Storage other than `this`.
+     *
+     * Post-Conditions:
+     *      The characters of the given Storage are inserted
+     *      at the given position.
+     *      No changes to the characters of the given Storage.
+     *
+     * The nodes of another RopeStorage are shared, O(log n).
+     * Inserts a copy of the characters of the given Storage at the
+     * given position.
+     */
+    void insert(int, const Storage&) override;
+
+    /*
+     * Pre-Conditions:
+     *      `this` RopeStorage instance is initialized.
+     *      Given int position is valid.
+     *      Reference to a Storage other than `this`.
+     *
+     * Post-Conditions:
+     *      The characters of the given Storage are inserted
+     *      at the given position.
+     *      The given Storage is empty.
+     *
+     * Moves the characters of the given Storage to the given position,
+     * leaving the given Storage empty.
+     */
+    void splice(int, Storage&) override;
+
+    /*
+     * Pre-Conditions:
+     *      `this` RopeStorage instance is initialized.
+     *      begin & end are valid positions, begin <= end.
+     *
+     * Post-Conditions:
+     *      The characters between begin & end are removed.
+     *
+     * Removes the characters between begin (inclusive) & end (exclusive).
+     */
+    void erase(int /* begin */, int /* end */) override;
+
+    /*
+     * Pre-Conditions:
+     *      `this` RopeStorage instance is initialized.
+     *      begin & end are valid positions, begin <= end.
+     *      const reference to a ChunkVisitor.
+     *
+     * Post-Conditions:
+     *      The visitor is called, in order, for each leaf run between
+     *      begin & end, until it returns false.
+     *      Returns false if the visitor stopped the visit.
+     *      No changes to `this`.
+     *
+     * Visits the characters between begin & end as contiguous chunks.
+     */
+    bool forEachChunk(int /* begin */, int /* end */,
+                      const ChunkVisitor&) const override;
+
+    /*
+     * Pre-Conditions:
+     *      `this` RopeStorage instance is initialized.
+     *      begin & end are valid positions, begin <= end.
+     *      const reference to a MutableChunkVisitor.
+     *
+     * Post-Conditions:
+     *      The visitor is called, in order, for each leaf run between
+     *      begin & end.
+     *      Changes made by the visitor are stored in the leaves.
+     *
+     * Visits the characters between begin & end as writable
+     * contiguous chunks.
+     */
+    void forEachMutableChunk(int /* begin */, int /* end */,
+                             const MutableChunkVisitor&) override;
+
+private:
+    /*
+     * Node of the rope tree.
+     * A leaf has no children & holds text,
+     * a branch has both children & an empty text.
+     */
+    struct RopeNode {
+        /* Left child, nullptr for leaves */
+        RopeNode *left;
+
+        /* Right child, nullptr for leaves */
+        RopeNode *right;
+
+        /* Number of characters in the subtree */
+        int length;
+
+        /* Height of the subtree, 0 for leaves */
+        int height;
+
+        /*
+         * Number of parents & ropes pointing to the node.
+         * Atomic, so ropes sharing the node may be copied & destroyed
+         * from different threads.
+         */
+        std::atomic<int> references;
+
+        /* Characters of a leaf */
+        std::string text;
+    };
+
+    /*
+     * Pre-Conditions:
+     *      Pointer to a balanced tree, or nullptr.
+     *
+     * Post-Conditions:
+     *      A RopeStorage instance holding the given tree is created.
+     *
+     * Parameterized constructor of the RopeStorage class.
+     * Takes a reference to the given tree.
+     */
+    explicit RopeStorage(RopeNode*);
+
+    /*
+     * Pre-Conditions:
+     *      Pointer to a tree, or nullptr.
+     *
+     * Post-Conditions:
+     *      Height of the tree is returned, -1 for nullptr.
+     *
+     * Returns the height of the given tree, -1 for nullptr.
+     */
+    [[nodiscard]] static int height(const RopeNode*);
+
+    /*
+     * Pre-Conditions:
+     *      Pointer to a branch with both children.
+     *
+     * Post-Conditions:
+     *      length & height of the branch match its children.
+     *
+     * Recomputes the length & height of the given branch.
+     */
+    static void update(RopeNode*);
+
+    /*
+     * Pre-Conditions:
+     *      Pointer to the characters to copy & their count.
+     *
+     * Post-Conditions:
+     *      A heap allocated leaf is returned.
+     *
+     * Returns a new leaf holding a copy of the given characters.
+     */
+    [[nodiscard]] static RopeNode* makeLeaf(const char*, int);
+
+    /*
+     * Pre-Conditions:
+     *      Pointers to two non-empty trees.
+     *
+     * Post-Conditions:
+     *      A heap allocated branch owning both trees is returned.
+     *
+     * Returns a new branch with the given children.
+     */
+    [[nodiscard]] static RopeNode* makeBranch(RopeNode*, RopeNode*);
+
+    /*
+     * Pre-Conditions:
+     *      Pointer to a branch whose right child is a branch.
+     *
+     * Post-Conditions:
+     *      The new root of the subtree is returned.
+     *
+     * Rotates the given branch to the left.
+     */
+    [[nodiscard]] static RopeNode* rotateLeft(RopeNode*);
+
+    /*
+     * Pre-Conditions:
+     *      Pointer to a branch whose left child is a branch.
+     *
+     * Post-Conditions:
+     *      The new root of the subtree is returned.
+     *
+     * Rotates the given branch to the right.
+     */
+    [[nodiscard]] static RopeNode* rotateRight(RopeNode*);
+
+    /*
+     * Pre-Conditions:
+     *      Pointer to a branch whose children differ in height by 2 at most.
+     *
+     * Post-Conditions:
+     *      The root of the balanced subtree is returned.
+     *
+     * Restores the AVL balance of the given branch.
+     */
+    [[nodiscard]] static RopeNode* rebalance(RopeNode*);
+
+    /*
+     * Pre-Conditions:
+     *      Pointers to two balanced trees, or nullptr.
+     *
+     * Post-Conditions:
+     *      The root of a balanced tree owning both trees is returned.
+     *
+     * Returns a balanced tree of the left tree followed by the right.
+     */
+    [[nodiscard]] static RopeNode* join(RopeNode*, RopeNode*);
+
+    /*
+     * Pre-Conditions:
+     *      Pointers to two balanced trees, or nullptr.
+     *
+     * Post-Conditions:
+     *      The root of a balanced tree owning both trees is returned.
+     *
+     * Same as join, but merges a single leaf into its neighbour leaf
+     * when it has room.
+     */
+    [[nodiscard]] static RopeNode* concat(RopeNode*, RopeNode*);
+
+    /*
+     * Pre-Conditions:
+     *      Pointer to a balanced tree, or nullptr.
+     *      Position to split at.
+     *
+     * Post-Conditions:
+     *      The given tree is consumed.
+     *      A pair of balanced trees holding the characters before
+     *      & after the position is returned.
+     *
+     * Splits the given tree into the characters before & after the
+     * given position.
+     */
+    [[nodiscard]] static std::pair<RopeNode*, RopeNode*> split(RopeNode*,
+                                                               int);
+
+    /*
+     * Pre-Conditions:
+     *      Reference to a pointer to a non-empty tree.
+     *      Pointer to the characters to append & their count.
+     *
+     * Post-Conditions:
+     *      Returns true if the text was appended to the last leaf,
+     *      the pointer is changed to the root of the changed tree.
+     *
+     * Appends the given text to the last leaf of the tree, if it has room.
+     */
+    static bool appendToLast(RopeNode*&, const char*, int);
+
+    /*
+     * Pre-Conditions:
+     *      Reference to a pointer to a non-empty tree.
+     *      const reference to the text to prepend.
+     *
+     * Post-Conditions:
+     *      Returns true if the text was prepended to the first leaf,
+     *      the pointer is changed to the root of the changed tree.
+     *
+     * Prepends the given text to the first leaf of the tree,
+     * if it has room.
+     */
+    static bool prependToFirst(RopeNode*&, const std::string&);
+
+    /*
+     * Pre-Conditions:
+     *      Reference to a list of leaves not owned by any tree.
+     *      Pointer to the characters to copy & their count.
+     *
+     * Post-Conditions:
+     *      The characters are added to the last leaf until it is full,
+     *      then to new leaves.
+     *
+     * Adds the given characters to a list of full leaves.
+     */
+    static void pack(std::vector<RopeNode*>&, const char*, int);
+
+    /*
+     * Pre-Conditions:
+     *      const reference to a list of leaves.
+     *      Range of the leaves to use, begin (inclusive) & end (exclusive).
+     *
+     * Post-Conditions:
+     *      The root of a balanced tree over the leaves is returned,
+     *      nullptr for an empty range.
+     *
+     * Returns a balanced tree over the given leaves.
+     */
+    [[nodiscard]] static RopeNode* build(const std::vector<RopeNode*>&,
+                                         int /* begin */, int /* end */);
+
+    /*
+     * Pre-Conditions:
+     *      Pointer to a non-empty tree.
+     *      begin & end are valid positions in the tree, begin < end.
+     *      const reference to a ChunkVisitor.
+     *
+     * Post-Conditions:
+     *      Returns false if the visitor stopped the visit.
+     *
+     * Visits the leaves of the tree between the given positions.
+     */
+    static bool visit(const RopeNode*, int /* begin */, int /* end */,
+                      const ChunkVisitor&);
+
+    /*
+     * Pre-Conditions:
+     *      Reference to a pointer to a non-empty tree.
+     *      begin & end are valid positions in the tree, begin < end.
+     *      const reference to a MutableChunkVisitor.
+     *
+     * Post-Conditions:
+     *      Changes made by the visitor are stored in the leaves.
+     *      Shared nodes on the visited paths are replaced by copies,
+     *      the pointer is changed to the root of the changed tree.
+     *
+     * Visits the leaves of the tree between the given positions,
+     * allowing changes.
+     */
+    static void visitMutable(RopeNode*&, int /* begin */, int /* end */,
+                             const MutableChunkVisitor&);
+
+    /*
+     * Pre-Conditions:
+     *      Pointer to a tree, or nullptr.
+     *
+     * Post-Conditions:
+     *      references of the root is increased by 1.
+     *      The given pointer is returned.
+     *
+     * Adds a reference to the given tree.
+     */
+    static RopeNode* retain(RopeNode*);
+
+    /*
+     * Pre-Conditions:
+     *      Pointer to a node, whose reference is held by the caller.
+     *
+     * Post-Conditions:
+     *      A node with the same content & a single reference is returned.
+     *      If the given node is shared, it is copied & loses the
+     *      reference of the caller.
+     *
+     * Returns a node only referenced by the caller, with the content
+     * of the given node.
+     */
+    [[nodiscard]] static RopeNode* own(RopeNode*);
+
+    /*
+     * Pre-Conditions:
+     *      Pointer to a tree, or nullptr, whose reference is held
+     *      by the caller.
+     *
+     * Post-Conditions:
+     *      references of the root is decreased by 1.
+     *      Nodes that are no longer referenced are deleted.
+     *
+     * Removes a reference to the given tree, deletes the nodes
+     * that are no longer referenced.
+     */
+    static void release(RopeNode*);
+
+    /* Root of the rope tree, nullptr if empty */
+    RopeNode *root;
+};
+
+#endif /* MYSTRINGBUILDER_ROPESTORAGE_H */
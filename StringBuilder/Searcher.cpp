@@ -0,0 +1,508 @@
+/*
+ * StringBuilder Project
+ *
+ *
+ * Searcher.cpp
+ *
+ * Date:        17/10/2026
+ *
+ * Author:      Mahmoud Yaman Seraj Alddin
+ *
+ * Purpose:     Implementation of the Searcher class,
+ *              described in Searcher.h
+ *
+ * List of public Functions:
+ *      Searcher(std::string)
+ *          Parameterized constructor of the Searcher class.
+ *
+ *      int find(const Storage&, int begin, int end) const
+ *          Returns the position of the first match between begin & end.
+ *
+ *      int find(const ChunkSource&, int) const
+ *          Returns the position of the first match in the given chunks.
+ *
+ *      int findLast(const Storage&, int begin, int end) const
+ *          Returns the position of the last match between begin & end.
+ *
+ *      bool matchesAt(const Storage&, int) const
+ *          Returns true if the pattern is found at the given position.
+ *
+ *      int copyReplacing(const Storage&, int, Storage&,
+ *                        const std::string&, int) const
+ *          Appends the characters of the source from the given position
+ *          to the target, replacing the first matches.
+ *
+ *      int length() const
+ *          Returns the number of characters in the pattern.
+ *
+ * List of private Functions:
+ *      int findInBlock(const char*, int) const
+ *          Returns the index of the first match inside the given block.
+ *
+ * List of local Functions:
+ *      int filterSse2(const char*, int, const std::string&)
+ *          Returns the index of the first match of the pattern,
+ *          filtering 16 positions at a time.
+ */
+
+#include <algorithm>
+#include <cstring>
+
+#include "Searcher.h"
+
+/* SSE2 is part of x86-64 */
+#if defined(__x86_64__) and (defined(__GNUC__) or defined(__clang__))
+#define MYSTRINGBUILDER_X86_KERNELS
+#include <immintrin.h>
+#endif
+
+using namespace std;
+
+#ifdef MYSTRINGBUILDER_X86_KERNELS
+/*
+ * Pre-Conditions:
+ *      Pointer to a block of characters & their count.
+ *      const reference to the pattern, of at least 2 characters,
+ *      not longer than the block.
+ *
+ * Post-Conditions:
+ *      The index of the first match fully inside the block is
+ *      returned, -1 if there is none.
+ *
+ * The first & last characters of the pattern are compared with 16
+ * positions at once, only the positions matching both are compared
+ * in full, so a frequent first character does not stop the scan.
+ * Returns the index of the first match of the pattern,
+ * filtering 16 positions at a time.
+ */
+static int filterSse2(const char *data, int size, const string& pattern) {
+    const int count = (int) pattern.size();
+    const int positions = size - count + 1;
+    const __m128i first = _mm_set1_epi8(pattern[0]);
+    const __m128i last = _mm_set1_epi8(pattern[count - 1]);
+
+    int i = 0;
+
+    for (; i + 16 <= positions; i += 16) {
+        const __m128i head = _mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(data + i));
+        const __m128i tail = _mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(data + i + count - 1));
+        unsigned mask = _mm_movemask_epi8(
+                _mm_and_si128(_mm_cmpeq_epi8(head, first),
+                              _mm_cmpeq_epi8(tail, last)));
+
+        while (mask) {
+            const int candidate = i + __builtin_ctz(mask);
+
+            if (not memcmp(data + candidate + 1, pattern.data() + 1,
+                           count - 2)) {
+                return candidate;
+            }
+
+            mask &= mask - 1;
+        }
+    }
+
+    for (; i < positions; i++) {
+        if (data[i] == pattern[0]
+            and not memcmp(data + i + 1, pattern.data() + 1, count - 1)) {
+            return i;
+        }
+    }
+
+    return -1;
+}
+#endif /* MYSTRINGBUILDER_X86_KERNELS */
+
+/*
+ * Pre-Conditions:
+ *      The pattern to search for, may be empty.
+ *
+ * Post-Conditions:
+ *      A Searcher instance for the given pattern is created.
+ *      The shift table of the pattern is computed.
+ *
+ * Characters absent from the pattern shift by the whole pattern length.
+ * Parameterized constructor of the Searcher class.
+ */
+Searcher::Searcher(string s): pattern{std::move(s)}, shifts{} {
+    const int count = length();
+
+    shifts.fill(count);
+
+    /* The last character is excluded, a shift is never 0 */
+    for (int i = 0; i + 1 < count; i++) {
+        shifts[(unsigned char) pattern[i]] = count - 1 - i;
+    }
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` Searcher instance is initialized.
+ *      const reference to the Storage to search.
+ *      begin & end are valid positions of the Storage, begin <= end.
+ *
+ * Post-Conditions:
+ *      The position of the first match lying between begin (inclusive)
+ *      & end (exclusive) is returned, -1 if there is none.
+ *      An empty pattern matches at begin.
+ *      No changes to `this` or the Storage.
+ *
+ * The chunks of the range are searched by the ChunkSource overload.
+ * Returns the position of the first match between begin & end.
+ */
+int Searcher::find(const Storage& storage, int begin, int end) const {
+    if (length() and end - begin < length()) {
+        return -1;
+    }
+
+    return find([&](const Storage::ChunkVisitor& visitor) {
+        storage.forEachChunk(begin, end, visitor);
+    }, begin);
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` Searcher instance is initialized.
+ *      const reference to the ChunkSource of the characters to search.
+ *      int of the position of their first character.
+ *
+ * Post-Conditions:
+ *      The position of the first match in the chunks is returned,
+ *      counting from the given position, -1 if there is none.
+ *      An empty pattern matches at the given position.
+ *      No changes to `this`.
+ *
+ * Each chunk is searched in place. The last length() - 1 characters
+ * before the chunk are kept in a small buffer, which is searched with
+ * the first length() - 1 characters of the chunk before the chunk itself,
+ * so the matches straddling chunks are found in order without reading
+ * any character twice from the Storage.
+ * Returns the position of the first match in the given chunks.
+ */
+int Searcher::find(const ChunkSource& chunks, int begin) const {
+    const int count = length();
+
+    if (not count) {
+        return begin;
+    }
+
+    const int overlap = count - 1;
+    int result = -1;
+    int position = begin;
+    string carried{};
+    string seam{};
+
+    chunks([&](const char *data, int size) {
+        /* A match in the seam always starts in the carried characters */
+        if (not carried.empty()) {
+            seam.assign(carried);
+            seam.append(data, min(size, overlap));
+
+            const int found = findInBlock(seam.data(), (int) seam.size());
+
+            if (0 <= found) {
+                result = position - (int) carried.size() + found;
+                return false;
+            }
+        }
+
+        const int found = findInBlock(data, size);
+
+        if (0 <= found) {
+            result = position + found;
+            return false;
+        }
+
+        if (overlap <= size) {
+            carried.assign(data + size - overlap, overlap);
+        } else {
+            carried.append(data, size);
+            carried.erase(0, max(0, (int) carried.size() - overlap));
+        }
+
+        position += size;
+        return true;
+    });
+
+    return result;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` Searcher instance is initialized.
+ *      const reference to the Storage to search.
+ *      begin & end are valid positions of the Storage, begin <= end.
+ *
+ * Post-Conditions:
+ *      The position of the last match lying between begin (inclusive)
+ *      & end (exclusive) is returned, -1 if there is none.
+ *      An empty pattern matches at end.
+ *      No changes to `this` or the Storage.
+ *
+ * The range is searched in windows of kWindow characters from its end,
+ * so a match near the end is found without scanning the whole range.
+ * Consecutive windows overlap by length() - 1 characters.
+ * Returns the position of the last match between begin & end.
+ */
+int Searcher::findLast(const Storage& storage, int begin, int end) const {
+    const int count = length();
+
+    if (not count) {
+        return end;
+    }
+
+    const int window = kWindow < 2 * count ? 2 * count : kWindow;
+
+    for (int windowEnd = end; count <= windowEnd - begin;) {
+        const int windowStart = max(begin, windowEnd - window);
+        int last = -1;
+
+        for (int found = find(storage, windowStart, windowEnd); 0 <= found;
+             found = find(storage, found + 1, windowEnd)) {
+            last = found;
+        }
+
+        if (0 <= last or windowStart == begin) {
+            return last;
+        }
+
+        /* Matches starting before the window may end inside it */
+        windowEnd = windowStart + count - 1;
+    }
+
+    return -1;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` Searcher instance is initialized.
+ *      const reference to the Storage to compare with.
+ *      Given int position is valid.
+ *
+ * Post-Conditions:
+ *      Returns true if the characters from the given position are
+ *      equal to the pattern.
+ *      No changes to `this` or the Storage.
+ *
+ * The chunks are compared with memcmp until the first difference.
+ * Returns true if the pattern is found at the given position.
+ */
+bool Searcher::matchesAt(const Storage& storage, int position) const {
+    if (storage.length() - position < length()) {
+        return false;
+    }
+
+    int offset = 0;
+
+    return storage.forEachChunk(position, position + length(),
+                                [this, &offset](const char *data, int size) {
+        const bool same = not memcmp(data, pattern.data() + offset, size);
+
+        offset += size;
+        return same;
+    });
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` Searcher instance is initialized.
+ *      const reference to the source Storage.
+ *      int of a valid position of the source, no match of the
+ *      pattern may start before it.
+ *      Reference to the target Storage, other than the source.
+ *      const reference to the replacement.
+ *      int of the most matches to replace, at least 0.
+ *
+ * Post-Conditions:
+ *      The characters of the source from the given position are
+ *      appended to the target, with the first `limit`
+ *      non-overlapping matches, from left to right, replaced by
+ *      the replacement.
+ *      Like Java, an empty pattern matches before each character &
+ *      at the end.
+ *      Returns the number of replaced matches.
+ *      No changes to `this` or the source.
+ *
+ * A single pass over the chunks of the source, searching & copying
+ * together. As in find, the last length() - 1 characters of a chunk are
+ * carried to the next one, they are only copied once no match can start
+ * in them. The output is gathered in kFlushLength characters before each
+ * insertion, so the target is not walked once per match.
+ * Appends the characters of the source from the given position
+ * to the target, replacing the first matches.
+ */
+int Searcher::copyReplacing(const Storage& source, int begin, Storage& target,
+                            const string& replacement, int limit) const {
+    const int count = length();
+    const int overlap = max(count - 1, 0);
+    int replaced = 0;
+    string buffer{};
+    string carried{};
+    string seam{};
+
+    auto flush = [&]() {
+        target.insert(target.length(), buffer.data(), (int) buffer.size());
+        buffer.clear();
+    };
+
+    auto emit = [&](const char *data, int size) {
+        buffer.append(data, size);
+
+        if (kFlushLength <= (int) buffer.size()) {
+            flush();
+        }
+    };
+
+    auto substitute = [&]() {
+        emit(replacement.data(), (int) replacement.size());
+        replaced++;
+    };
+
+    source.forEachChunk(begin, source.length(),
+                        [&](const char *data, int size) {
+        int offset = 0;
+
+        if (replaced == limit) {
+            emit(carried.data(), (int) carried.size());
+            emit(data, size);
+            carried.clear();
+            return true;
+        }
+
+        /* The empty pattern matches before each character */
+        if (not count) {
+            for (; offset < size and replaced < limit; offset++) {
+                substitute();
+                emit(data + offset, 1);
+            }
+
+            emit(data + offset, size - offset);
+            return true;
+        }
+
+        /* A match in the seam always starts in the carried characters */
+        if (not carried.empty()) {
+            seam.assign(carried);
+            seam.append(data, min(size, overlap));
+
+            const int found = findInBlock(seam.data(), (int) seam.size());
+
+            if (0 <= found) {
+                emit(carried.data(), found);
+                substitute();
+                offset = found + count - (int) carried.size();
+            } else if (size < overlap) {
+                /* A match may still start in the carried characters */
+                carried.append(data, size);
+
+                const int settled = (int) carried.size() - overlap;
+
+                if (0 < settled) {
+                    emit(carried.data(), settled);
+                    carried.erase(0, settled);
+                }
+
+                return true;
+            } else {
+                emit(carried.data(), (int) carried.size());
+            }
+
+            carried.clear();
+        }
+
+        while (replaced < limit) {
+            const int found = findInBlock(data + offset, size - offset);
+
+            if (found < 0) {
+                break;
+            }
+
+            emit(data + offset, found);
+            substitute();
+            offset += found + count;
+        }
+
+        /* Once the limit is reached no character is carried */
+        const int kept = replaced < limit ? min(overlap, size - offset) : 0;
+
+        emit(data + offset, size - offset - kept);
+        carried.assign(data + size - kept, kept);
+        return true;
+    });
+
+    emit(carried.data(), (int) carried.size());
+
+    /* The empty pattern also matches at the end */
+    if (not count and replaced < limit) {
+        substitute();
+    }
+
+    flush();
+    return replaced;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` Searcher instance is initialized.
+ *
+ * Post-Conditions:
+ *      Number of characters in the pattern is returned.
+ *      No changes to `this`.
+ *
+ * Returns the number of characters in the pattern.
+ */
+int Searcher::length() const {
+    return (int) pattern.size();
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` Searcher instance is initialized, the pattern is
+ *      not empty.
+ *      Pointer to a block of characters & their count.
+ *
+ * Post-Conditions:
+ *      The index of the first match fully inside the block is
+ *      returned, -1 if there is none.
+ *      No changes to `this`.
+ *
+ * Single characters are found with memchr, which is vectorized by the
+ * C library. Patterns of up to kFilterLength characters are found by
+ * comparing their first & last characters with 16 positions at once,
+ * longer patterns use Boyer-Moore-Horspool, skipping up to length()
+ * characters after each mismatch of the last character.
+ * Returns the index of the first match inside the given block.
+ */
+int Searcher::findInBlock(const char *data, int size) const {
+    const int count = length();
+
+    if (size < count) {
+        return -1;
+    } else if (count == 1) {
+        auto hit = static_cast<const char*>(memchr(data, pattern[0], size));
+
+        return hit ? (int) (hit - data) : -1;
+    }
+
+#ifdef MYSTRINGBUILDER_X86_KERNELS
+    if (count <= kFilterLength) {
+        return filterSse2(data, size, pattern);
+    }
+#endif
+
+    const char last = pattern[count - 1];
+
+    for (int i = 0; i <= size - count;) {
+        const char c = data[i + count - 1];
+
+        if (c == last and not memcmp(data + i, pattern.data(), count - 1)) {
+            return i;
+        }
+
+        i += shifts[(unsigned char) c];
+    }
+
+    return -1;
+}
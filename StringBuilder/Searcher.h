@@ -0,0 +1,222 @@
+/*
+ * StringBuilder Project
+ *
+ *
+ * Searcher.h
+ *
+ * Date:        17/10/2026
+ *
+ * Author:      Mahmoud Yaman Seraj Alddin
+ *
+ * Purpose:     Header file for the Searcher class,
+ *              the substring search over the chunks of a Storage.
+ *
+ * List of public Functions:
+ *      Searcher(std::string)
+ *          Parameterized constructor of the Searcher class.
+ *
+ *      int find(const Storage&, int begin, int end) const
+ *          Returns the position of the first match between begin & end.
+ *
+ *      int find(const ChunkSource&, int) const
+ *          Returns the position of the first match in the given chunks.
+ *
+ *      int findLast(const Storage&, int begin, int end) const
+ *          Returns the position of the last match between begin & end.
+ *
+ *      bool matchesAt(const Storage&, int) const
+ *          Returns true if the pattern is found at the given position.
+ *
+ *      int copyReplacing(const Storage&, int, Storage&,
+ *                        const std::string&, int) const
+ *          Appends the characters of the source from the given position
+ *          to the target, replacing the first matches.
+ *
+ *      int length() const
+ *          Returns the number of characters in the pattern.
+ *
+ * List of private Functions:
+ *      int findInBlock(const char*, int) const
+ *          Returns the index of the first match inside the given block.
+ */
+
+#ifndef MYSTRINGBUILDER_SEARCHER_H
+#define MYSTRINGBUILDER_SEARCHER_H
+
+#include <array>
+#include <functional>
+#include <string>
+
+#include "Storage.h"
+
+/*
+ * Searcher finds a pattern in the characters of a Storage, without
+ * copying the Storage into a string.
+ * Each chunk is searched in place, with memchr for single characters,
+ * a SIMD filter on the first & last characters for short patterns
+ * & Boyer-Moore-Horspool for longer ones.
+ * Matches straddling two or more chunks are found in a small buffer
+ * holding the end of the previous chunks & the start of the next one.
+ */
+class Searcher {
+public:
+    /*
+     * Type alias for a sequence of chunks, passing each of them in order
+     * to the given visitor until it returns false.
+     */
+    typedef std::function<void(const Storage::ChunkVisitor&)> ChunkSource;
+
+    /* Characters searched at once by findLast, from the end backwards */
+    static const int kWindow = 1 << 16;
+
+    /* Longest pattern found by filtering its first & last characters */
+    static const int kFilterLength = 16;
+
+    /* Characters gathered by copyReplacing before inserting them at once */
+    static const int kFlushLength = 1 << 16;
+
+    /*
+     * Pre-Conditions:
+     *      The pattern to search for, may be empty.
+     *
+     * Post-Conditions:
+     *      A Searcher instance for the given pattern is created.
+     *      The shift table of the pattern is computed.
+     *
+     * Parameterized constructor of the Searcher class.
+     */
+    explicit Searcher(std::string);
+
+    /*
+     * Pre-Conditions:
+     *      `this` Searcher instance is initialized.
+     *      const reference to the Storage to search.
+     *      begin & end are valid positions of the Storage, begin <= end.
+     *
+     * Post-Conditions:
+     *      The position of the first match lying between begin (inclusive)
+     *      & end (exclusive) is returned, -1 if there is none.
+     *      An empty pattern matches at begin.
+     *      No changes to `this` or the Storage.
+     *
+     * Returns the position of the first match between begin & end.
+     */
+    [[nodiscard]] int find(const Storage&, int /* begin */,
+                           int /* end */) const;
+
+    /*
+     * Pre-Conditions:
+     *      `this` Searcher instance is initialized.
+     *      const reference to the ChunkSource of the characters to search.
+     *      int of the position of their first character.
+     *
+     * Post-Conditions:
+     *      The position of the first match in the chunks is returned,
+     *      counting from the given position, -1 if there is none.
+     *      An empty pattern matches at the given position.
+     *      No changes to `this`.
+     *
+     * Lets the callers search chunks gathered from a Storage,
+     * such as one range of it.
+     * Returns the position of the first match in the given chunks.
+     */
+    [[nodiscard]] int find(const ChunkSource&, int) const;
+
+    /*
+     * Pre-Conditions:
+     *      `this` Searcher instance is initialized.
+     *      const reference to the Storage to search.
+     *      begin & end are valid positions of the Storage, begin <= end.
+     *
+     * Post-Conditions:
+     *      The position of the last match lying between begin (inclusive)
+     *      & end (exclusive) is returned, -1 if there is none.
+     *      An empty pattern matches at end.
+     *      No changes to `this` or the Storage.
+     *
+     * Returns the position of the last match between begin & end.
+     */
+    [[nodiscard]] int findLast(const Storage&, int /* begin */,
+                               int /* end */) const;
+
+    /*
+     * Pre-Conditions:
+     *      `this` Searcher instance is initialized.
+     *      const reference to the Storage to compare with.
+     *      Given int position is valid.
+     *
+     * Post-Conditions:
+     *      Returns true if the characters from the given position are
+     *      equal to the pattern.
+     *      No changes to `this` or the Storage.
+     *
+     * Returns true if the pattern is found at the given position.
+     */
+    [[nodiscard]] bool matchesAt(const Storage&, int) const;
+
+    /*
+     * Pre-Conditions:
+     *      `this` Searcher instance is initialized.
+     *      const reference to the source Storage.
+     *      int of a valid position of the source, no match of the
+     *      pattern may start before it.
+     *      Reference to the target Storage, other than the source.
+     *      const reference to the replacement.
+     *      int of the most matches to replace, at least 0.
+     *
+     * Post-Conditions:
+     *      The characters of the source from the given position are
+     *      appended to the target, with the first `limit`
+     *      non-overlapping matches, from left to right, replaced by
+     *      the replacement.
+     *      Like Java, an empty pattern matches before each character &
+     *      at the end.
+     *      Returns the number of replaced matches.
+     *      No changes to `this` or the source.
+     *
+     * Appends the characters of the source from the given position
+     * to the target, replacing the first matches.
+     */
+    int copyReplacing(const Storage&, int, Storage&,
+                      const std::string&, int /* limit */) const;
+
+    /*
+     * Pre-Conditions:
+     *      `this` Searcher instance is initialized.
+     *
+     * Post-Conditions:
+     *      Number of characters in the pattern is returned.
+     *      No changes to `this`.
+     *
+     * Returns the number of characters in the pattern.
+     */
+    [[nodiscard]] int length() const;
+
+private:
+    /*
+     * Pre-Conditions:
+     *      `this` Searcher instance is initialized, the pattern is
+     *      not empty.
+     *      Pointer to a block of characters & their count.
+     *
+     * Post-Conditions:
+     *      The index of the first match fully inside the block is
+     *      returned, -1 if there is none.
+     *      No changes to `this`.
+     *
+     * Returns the index of the first match inside the given block.
+     */
+    [[nodiscard]] int findInBlock(const char*, int) const;
+
+    /* Characters to search for */
+    std::string pattern;
+
+    /*
+     * Horspool shift of each character, indexed as unsigned char.
+     * Distance from the last occurrence of the character in the pattern,
+     * excluding its last character, to the end of the pattern.
+     */
+    std::array<int, 256> shifts;
+};
+
+#endif /* MYSTRINGBUILDER_SEARCHER_H */
@@ -0,0 +1,458 @@
+/*
+ * StringBuilder Project
+ *
+ *
+ * SharedBuilder.cpp
+ *
+ * Date:        17/10/2026
+ *
+ * Author:      Mahmoud Yaman Seraj Alddin
+ *
+ * Purpose:     Implementation of the SharedBuilder class,
+ *              described in SharedBuilder.h
+ *
+ * List of public Functions:
+ *      SharedBuilder(std::string)
+ *          Parameterized constructor of the SharedBuilder class.
+ *
+ *      ~SharedBuilder()
+ *          Destructor for the SharedBuilder class.
+ *
+ *      SharedBuilder& insert(int, std::string_view)
+ *          Inserts a copy of the given characters into the given position.
+ *
+ *      SharedBuilder& append(std::string_view)
+ *          Inserts a copy of the given characters into the end.
+ *
+ *      SharedBuilder& replace(int begin, int end, std::string_view)
+ *          Replaces the characters from begin (inclusive) to
+ *          end (exclusive) by a copy of the given characters.
+ *
+ *      void clear(int begin, int end)
+ *          Makes the range empty.
+ *
+ *      int length() const
+ *          Returns the number of characters in the current version.
+ *
+ *      char charAt(int) const
+ *          Returns the character at the given index in the current version.
+ *
+ *      MyStringBuilder substring(int begin, int end) const
+ *          Returns a new MyStringBuilder instance from the characters
+ *          of the current version between begin (inclusive)
+ *          & end (exclusive).
+ *
+ *      std::string toString() const
+ *          Returns a string of the characters of the current version.
+ *
+ *      std::string toString(int begin, int end) const
+ *          Returns a string of the characters of the current version
+ *          between begin & end.
+ *
+ *      MyStringBuilder snapshot() const
+ *          Returns a MyStringBuilder sharing the characters of the
+ *          current version.
+ *
+ * List of private Functions:
+ *      Reader& localReader() const
+ *          Returns the epoch slot of the calling thread.
+ *
+ *      void publish()
+ *          Makes the edited characters the current version.
+ *
+ *      void reclaim()
+ *          Deletes the retired versions no reader may still see.
+ */
+
+#include <utility>
+
+#include "SharedBuilder.h"
+
+using namespace std;
+
+atomic<unsigned long long> SharedBuilder::nextId{1};
+
+thread_local SharedBuilder::Binding SharedBuilder::binding{0, nullptr};
+
+/*
+ * Pre-Conditions:
+ *      string of the initial characters.
+ *
+ * Post-Conditions:
+ *      A SharedBuilder instance holding the given characters
+ *      is created, as its first version.
+ *
+ * The rope is the only mode whose copies share their characters,
+ * so publishing a version is O(1).
+ * Parameterized constructor of the SharedBuilder class.
+ */
+SharedBuilder::SharedBuilder(string s)
+        : id{nextId++}, writer{},
+          edited(std::move(s), MyStringBuilder::Mode::kRope),
+          current{new MyStringBuilder(edited)}, epoch{1}, retired{},
+          registry{}, readers{}, owners{} {}
+
+/*
+ * Pre-Conditions:
+ *      `this` SharedBuilder instance is not destroyed.
+ *      No thread is reading or editing.
+ *
+ * Post-Conditions:
+ *      `this` SharedBuilder instance & its versions are destroyed.
+ *      The snapshots & substrings returned keep their characters.
+ *
+ * The bindings of the threads keep the identifier of `this`,
+ * which no later builder receives.
+ * Destructor for the SharedBuilder class.
+ */
+SharedBuilder::~SharedBuilder() {
+    for (const Retired& version: retired) {
+        delete version.version;
+    }
+
+    for (Reader *reader: readers) {
+        delete reader;
+    }
+
+    delete current.load();
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` SharedBuilder instance is initialized.
+ *      int of a valid position.
+ *      string_view of the characters to insert.
+ *
+ * Post-Conditions:
+ *      The characters are inserted at the given position & published.
+ *      A reference to `this` is returned.
+ *      An invalid_argument exception is thrown if the position is invalid,
+ *      nothing is published.
+ *
+ * Inserts a copy of the given characters into the given position.
+ */
+SharedBuilder& SharedBuilder::insert(int position, string_view s) {
+    lock_guard<mutex> lock(writer);
+
+    edited.insert(position, s);
+    publish();
+
+    return *this;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` SharedBuilder instance is initialized.
+ *      string_view of the characters to append.
+ *
+ * Post-Conditions:
+ *      The characters are appended & published.
+ *      A reference to `this` is returned.
+ *
+ * Inserts a copy of the given characters into the end.
+ */
+SharedBuilder& SharedBuilder::append(string_view s) {
+    lock_guard<mutex> lock(writer);
+
+    edited.append(s);
+    publish();
+
+    return *this;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` SharedBuilder instance is initialized.
+ *      begin & end are valid positions, begin <= end.
+ *      string_view of the replacement.
+ *
+ * Post-Conditions:
+ *      The range is replaced by the given characters & published.
+ *      A reference to `this` is returned.
+ *      An invalid_argument exception is thrown if the range is invalid,
+ *      nothing is published.
+ *
+ * The readers see the characters before or after the replacement,
+ * never the range removed without the new characters.
+ * Replaces the characters from begin (inclusive) to
+ * end (exclusive) by a copy of the given characters.
+ */
+SharedBuilder& SharedBuilder::replace(int begin, int end, string_view s) {
+    lock_guard<mutex> lock(writer);
+
+    edited.replace(begin, end, s);
+    publish();
+
+    return *this;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` SharedBuilder instance is initialized.
+ *      begin & end are valid positions, begin <= end.
+ *
+ * Post-Conditions:
+ *      The range is removed & published.
+ *      An invalid_argument exception is thrown if the range is invalid,
+ *      nothing is published.
+ *
+ * Makes the range empty.
+ */
+void SharedBuilder::clear(int begin, int end) {
+    lock_guard<mutex> lock(writer);
+
+    edited.clear(begin, end);
+    publish();
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` SharedBuilder instance is initialized.
+ *
+ * Post-Conditions:
+ *      Number of characters of the current version is returned.
+ *      No changes to `this`.
+ *
+ * Returns the number of characters in the current version.
+ */
+int SharedBuilder::length() const {
+    const Guard guard(*this);
+
+    return guard.version().length();
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` SharedBuilder instance is initialized.
+ *      int of a valid index of the current version.
+ *
+ * Post-Conditions:
+ *      Character at the given index is returned.
+ *      An invalid_argument exception is thrown if the index is invalid.
+ *      No changes to `this`.
+ *
+ * Returns the character at the given index in the current version.
+ */
+char SharedBuilder::charAt(int position) const {
+    const Guard guard(*this);
+
+    return guard.version().charAt(position);
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` SharedBuilder instance is initialized.
+ *      begin & end are valid indices of the current version,
+ *      begin <= end.
+ *
+ * Post-Conditions:
+ *      A MyStringBuilder of the characters of the range is returned,
+ *      unaffected by later edits.
+ *      An invalid_argument exception is thrown if the range is invalid.
+ *      No changes to `this`.
+ *
+ * The substring shares the nodes inside the range with the version,
+ * so it stays valid after the version is deleted.
+ * Returns a new MyStringBuilder instance from the characters
+ * of the current version between begin (inclusive)
+ * & end (exclusive).
+ */
+MyStringBuilder SharedBuilder::substring(int begin, int end) const {
+    const Guard guard(*this);
+
+    return guard.version().substring(begin, end);
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` SharedBuilder instance is initialized.
+ *
+ * Post-Conditions:
+ *      A string of the characters of the current version is returned.
+ *      No changes to `this`.
+ *
+ * Returns a string of the characters of the current version.
+ */
+string SharedBuilder::toString() const {
+    const Guard guard(*this);
+
+    return guard.version().toString();
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` SharedBuilder instance is initialized.
+ *      begin & end are valid indices of the current version,
+ *      begin <= end.
+ *
+ * Post-Conditions:
+ *      A string of the characters between begin (inclusive)
+ *      & end (exclusive) is returned.
+ *      An invalid_argument exception is thrown if the range is invalid.
+ *      No changes to `this`.
+ *
+ * Returns a string of the characters of the current version
+ * between begin & end.
+ */
+string SharedBuilder::toString(int begin, int end) const {
+    const Guard guard(*this);
+
+    return guard.version().toString(begin, end);
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` SharedBuilder instance is initialized.
+ *
+ * Post-Conditions:
+ *      A MyStringBuilder holding the characters of the current version
+ *      is returned, unaffected by later edits.
+ *      No changes to `this`.
+ *
+ * The copy shares the root of the version, O(1), & keeps its nodes
+ * alive on its own, so it may be iterated for as long as needed.
+ * Returns a MyStringBuilder sharing the characters of the
+ * current version.
+ */
+MyStringBuilder SharedBuilder::snapshot() const {
+    const Guard guard(*this);
+
+    return guard.version();
+}
+
+/*
+ * Pre-Conditions:
+ *      const reference to an initialized SharedBuilder.
+ *
+ * Post-Conditions:
+ *      The epoch slot of the calling thread holds the current epoch,
+ *      the current version is loaded.
+ *
+ * The epoch is announced before the version is loaded, both sequentially
+ * consistent, so a writer that retires the version after the load
+ * sees the announcement.
+ * Constructor of the Guard class.
+ */
+SharedBuilder::Guard::Guard(const SharedBuilder& builder)
+        : reader{builder.localReader()}, current{nullptr} {
+    reader.epoch.store(builder.epoch.load());
+    current = builder.current.load();
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` Guard instance is not destroyed.
+ *
+ * Post-Conditions:
+ *      The epoch slot of the calling thread is idle.
+ *
+ * Release, the reads of the version happen before its deletion.
+ * Destructor for the Guard class.
+ */
+SharedBuilder::Guard::~Guard() {
+    reader.epoch.store(0, memory_order_release);
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` Guard instance is initialized.
+ *
+ * Post-Conditions:
+ *      Reference to the version loaded by `this` is returned,
+ *      valid as long as `this`.
+ *
+ * Returns the version read by the calling thread.
+ */
+const MyStringBuilder& SharedBuilder::Guard::version() const {
+    return *current;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` SharedBuilder instance is initialized.
+ *
+ * Post-Conditions:
+ *      Reference to the epoch slot of the calling thread is returned,
+ *      created on its first read.
+ *
+ * The thread local binding answers without a lock while the thread
+ * keeps reading the same builder, the registry is only locked
+ * when it switches builders.
+ * Returns the epoch slot of the calling thread.
+ */
+SharedBuilder::Reader& SharedBuilder::localReader() const {
+    if (binding.builder == id) {
+        return *binding.reader;
+    }
+
+    lock_guard<mutex> lock(registry);
+    Reader *&reader = owners[this_thread::get_id()];
+
+    if (not reader) {
+        reader = new Reader{{0}};
+        readers.push_back(reader);
+    }
+
+    binding = Binding{id, reader};
+    return *reader;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` SharedBuilder instance is initialized.
+ *      The writer mutex is held.
+ *
+ * Post-Conditions:
+ *      A copy of the edited rope is the current version,
+ *      the previous one is retired.
+ *
+ * The version is retired in the epoch before the increment, the readers
+ * that announce a later epoch load the new version.
+ * The copy shares the nodes of the edited rope, the next edit copies
+ * the shared nodes on its path, O(log n).
+ * Makes the edited characters the current version.
+ */
+void SharedBuilder::publish() {
+    const MyStringBuilder *replaced = current.exchange(
+            new MyStringBuilder(edited)
+    );
+
+    retired.push_back(Retired{replaced, epoch.fetch_add(1)});
+    reclaim();
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` SharedBuilder instance is initialized.
+ *      The writer mutex is held.
+ *
+ * Post-Conditions:
+ *      The retired versions older than the epoch of every reading
+ *      thread are deleted.
+ *
+ * A reader that announced an epoch up to the one a version was retired
+ * in may have loaded it, the later readers cannot.
+ * Deleting a version only releases the nodes no other version or
+ * snapshot shares.
+ * Deletes the retired versions no reader may still see.
+ */
+void SharedBuilder::reclaim() {
+    unsigned long long oldest = epoch.load();
+
+    {
+        lock_guard<mutex> lock(registry);
+
+        for (const Reader *reader: readers) {
+            const unsigned long long announced = reader->epoch.load();
+
+            if (announced and announced < oldest) {
+                oldest = announced;
+            }
+        }
+    }
+
+    while (not retired.empty() and retired.front().epoch < oldest) {
+        delete retired.front().version;
+        retired.pop_front();
+    }
+}
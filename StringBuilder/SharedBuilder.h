@@ -0,0 +1,398 @@
+/*
+ * StringBuilder Project
+ *
+ *
+ * SharedBuilder.h
+ *
+ * Date:        17/10/2026
+ *
+ * Author:      Mahmoud Yaman Seraj Alddin
+ *
+ * Purpose:     Header file for the SharedBuilder class,
+ *              a MyStringBuilder read by many threads while it is edited.
+ *
+ * List of public Functions:
+ *      SharedBuilder(std::string)
+ *          Parameterized constructor of the SharedBuilder class.
+ *
+ *      ~SharedBuilder()
+ *          Destructor for the SharedBuilder class.
+ *
+ *      SharedBuilder& insert(int, std::string_view)
+ *          Inserts a copy of the given characters into the given position.
+ *
+ *      SharedBuilder& append(std::string_view)
+ *          Inserts a copy of the given characters into the end.
+ *
+ *      SharedBuilder& replace(int begin, int end, std::string_view)
+ *          Replaces the characters from begin (inclusive) to
+ *          end (exclusive) by a copy of the given characters.
+ *
+ *      void clear(int begin, int end)
+ *          Makes the range empty.
+ *
+ *      int length() const
+ *          Returns the number of characters in the current version.
+ *
+ *      char charAt(int) const
+ *          Returns the character at the given index in the current version.
+ *
+ *      MyStringBuilder substring(int begin, int end) const
+ *          Returns a new MyStringBuilder instance from the characters
+ *          of the current version between begin (inclusive)
+ *          & end (exclusive).
+ *
+ *      std::string toString() const
+ *          Returns a string of the characters of the current version.
+ *
+ *      std::string toString(int begin, int end) const
+ *          Returns a string of the characters of the current version
+ *          between begin & end.
+ *
+ *      MyStringBuilder snapshot() const
+ *          Returns a MyStringBuilder sharing the characters of the
+ *          current version.
+ *
+ * List of private Functions:
+ *      Reader& localReader() const
+ *          Returns the epoch slot of the calling thread.
+ *
+ *      void publish()
+ *          Makes the edited characters the current version.
+ *
+ *      void reclaim()
+ *          Deletes the retired versions no reader may still see.
+ */
+
+#ifndef MYSTRINGBUILDER_SHAREDBUILDER_H
+#define MYSTRINGBUILDER_SHAREDBUILDER_H
+
+#include <atomic>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "MyStringBuilder.h"
+
+/*
+ * SharedBuilder keeps a rope edited by the writers & an immutable copy
+ * of it, the current version, read by the readers.
+ * Every edit publishes a new version, an O(1) copy sharing the nodes
+ * of the rope, whose shared nodes the later edits copy instead of
+ * changing, so a reader sees the characters of one version until it is
+ * done, without any lock.
+ * The replaced versions are retired, then deleted by the writer once
+ * no reader may still see them: each reader announces the epoch it
+ * started in, & a version retired in an epoch is deleted once every
+ * reading thread started in a later one.
+ * Edits are serialized by a mutex, readers never take it.
+ */
+class SharedBuilder {
+public:
+    /*
+     * Pre-Conditions:
+     *      string of the initial characters.
+     *
+     * Post-Conditions:
+     *      A SharedBuilder instance holding the given characters
+     *      is created, as its first version.
+     *
+     * Parameterized constructor of the SharedBuilder class.
+     */
+    explicit SharedBuilder(std::string);
+
+    /* Readers keep pointers to the epoch slots, no copies */
+    SharedBuilder(const SharedBuilder&) = delete;
+
+    SharedBuilder& operator=(const SharedBuilder&) = delete;
+
+    /*
+     * Pre-Conditions:
+     *      `this` SharedBuilder instance is not destroyed.
+     *      No thread is reading or editing.
+     *
+     * Post-Conditions:
+     *      `this` SharedBuilder instance & its versions are destroyed.
+     *      The snapshots & substrings returned keep their characters.
+     *
+     * Destructor for the SharedBuilder class.
+     */
+    ~SharedBuilder();
+
+    /*
+     * Pre-Conditions:
+     *      `this` SharedBuilder instance is initialized.
+     *      int of a valid position.
+     *      string_view of the characters to insert.
+     *
+     * Post-Conditions:
+     *      The characters are inserted at the given position & published.
+     *      A reference to `this` is returned.
+     *      An invalid_argument exception is thrown if the position is invalid,
+     *      nothing is published.
+     *
+     * Inserts a copy of the given characters into the given position.
+     */
+    SharedBuilder& insert(int, std::string_view);
+
+    /*
+     * Pre-Conditions:
+     *      `this` SharedBuilder instance is initialized.
+     *      string_view of the characters to append.
+     *
+     * Post-Conditions:
+     *      The characters are appended & published.
+     *      A reference to `this` is returned.
+     *
+     * Inserts a copy of the given characters into the end.
+     */
+    SharedBuilder& append(std::string_view);
+
+    /*
+     * Pre-Conditions:
+     *      `this` SharedBuilder instance is initialized.
+     *      begin & end are valid positions, begin <= end.
+     *      string_view of the replacement.
+     *
+     * Post-Conditions:
+     *      The range is replaced by the given characters & published.
+     *      A reference to `this` is returned.
+     *      An invalid_argument exception is thrown if the range is invalid,
+     *      nothing is published.
+     *
+     * Replaces the characters from begin (inclusive) to
+     * end (exclusive) by a copy of the given characters.
+     */
+    SharedBuilder& replace(int /* begin */, int /* end */, std::string_view);
+
+    /*
+     * Pre-Conditions:
+     *      `this` SharedBuilder instance is initialized.
+     *      begin & end are valid positions, begin <= end.
+     *
+     * Post-Conditions:
+     *      The range is removed & published.
+     *      An invalid_argument exception is thrown if the range is invalid,
+     *      nothing is published.
+     *
+     * Makes the range empty.
+     */
+    void clear(int /* begin */, int /* end */);
+
+    /*
+     * Pre-Conditions:
+     *      `this` SharedBuilder instance is initialized.
+     *
+     * Post-Conditions:
+     *      Number of characters of the current version is returned.
+     *      No changes to `this`.
+     *
+     * Safe to call from many threads at once, & while editing.
+     * Returns the number of characters in the current version.
+     */
+    [[nodiscard]] int length() const;
+
+    /*
+     * Pre-Conditions:
+     *      `this` SharedBuilder instance is initialized.
+     *      int of a valid index of the current version.
+     *
+     * Post-Conditions:
+     *      Character at the given index is returned.
+     *      An invalid_argument exception is thrown if the index is invalid.
+     *      No changes to `this`.
+     *
+     * Safe to call from many threads at once, & while editing.
+     * Returns the character at the given index in the current version.
+     */
+    [[nodiscard]] char charAt(int) const;
+
+    /*
+     * Pre-Conditions:
+     *      `this` SharedBuilder instance is initialized.
+     *      begin & end are valid indices of the current version,
+     *      begin <= end.
+     *
+     * Post-Conditions:
+     *      A MyStringBuilder of the characters of the range is returned,
+     *      unaffected by later edits.
+     *      An invalid_argument exception is thrown if the range is invalid.
+     *      No changes to `this`.
+     *
+     * Safe to call from many threads at once, & while editing.
+     * Returns a new MyStringBuilder instance from the characters
+     * of the current version between begin (inclusive)
+     * & end (exclusive).
+     */
+    [[nodiscard]] MyStringBuilder substring(int /* begin */,
+                                            int /* end */) const;
+
+    /*
+     * Pre-Conditions:
+     *      `this` SharedBuilder instance is initialized.
+     *
+     * Post-Conditions:
+     *      A string of the characters of the current version is returned.
+     *      No changes to `this`.
+     *
+     * Safe to call from many threads at once, & while editing.
+     * Returns a string of the characters of the current version.
+     */
+    [[nodiscard]] std::string toString() const;
+
+    /*
+     * Pre-Conditions:
+     *      `this` SharedBuilder instance is initialized.
+     *      begin & end are valid indices of the current version,
+     *      begin <= end.
+     *
+     * Post-Conditions:
+     *      A string of the characters between begin (inclusive)
+     *      & end (exclusive) is returned.
+     *      An invalid_argument exception is thrown if the range is invalid.
+     *      No changes to `this`.
+     *
+     * Safe to call from many threads at once, & while editing.
+     * Returns a string of the characters of the current version
+     * between begin & end.
+     */
+    [[nodiscard]] std::string toString(int /* begin */,
+                                       int /* end */) const;
+
+    /*
+     * Pre-Conditions:
+     *      `this` SharedBuilder instance is initialized.
+     *
+     * Post-Conditions:
+     *      A MyStringBuilder holding the characters of the current version
+     *      is returned, unaffected by later edits.
+     *      No changes to `this`.
+     *
+     * Safe to call from many threads at once, & while editing.
+     * Iterating the returned MyStringBuilder reads one version throughout.
+     * Returns a MyStringBuilder sharing the characters of the
+     * current version.
+     */
+    [[nodiscard]] MyStringBuilder snapshot() const;
+
+private:
+    /*
+     * Epoch slot of a reading thread, 0 while it is not reading.
+     * Aligned to a cache line, so readers never write the same line.
+     */
+    struct alignas(64) Reader {
+        std::atomic<unsigned long long> epoch;
+    };
+
+    /* Version replaced by an edit, & the epoch it was retired in */
+    struct Retired {
+        const MyStringBuilder *version;
+        unsigned long long epoch;
+    };
+
+    /* Epoch slot of the builder the calling thread read last */
+    struct Binding {
+        unsigned long long builder;
+        Reader *reader;
+    };
+
+    /*
+     * Announces the epoch of the calling thread while it reads the
+     * current version, the version is not deleted before it is destroyed.
+     */
+    class Guard {
+    public:
+        explicit Guard(const SharedBuilder&);
+
+        Guard(const Guard&) = delete;
+
+        Guard& operator=(const Guard&) = delete;
+
+        ~Guard();
+
+        /* Version read by the calling thread */
+        const MyStringBuilder& version() const;
+
+    private:
+        Reader& reader;
+
+        const MyStringBuilder *current;
+    };
+
+    /*
+     * Pre-Conditions:
+     *      `this` SharedBuilder instance is initialized.
+     *
+     * Post-Conditions:
+     *      Reference to the epoch slot of the calling thread is returned,
+     *      created on its first read.
+     *
+     * Returns the epoch slot of the calling thread.
+     */
+    Reader& localReader() const;
+
+    /*
+     * Pre-Conditions:
+     *      `this` SharedBuilder instance is initialized.
+     *      The writer mutex is held.
+     *
+     * Post-Conditions:
+     *      A copy of the edited rope is the current version,
+     *      the previous one is retired.
+     *
+     * Makes the edited characters the current version.
+     */
+    void publish();
+
+    /*
+     * Pre-Conditions:
+     *      `this` SharedBuilder instance is initialized.
+     *      The writer mutex is held.
+     *
+     * Post-Conditions:
+     *      The retired versions older than the epoch of every reading
+     *      thread are deleted.
+     *
+     * Deletes the retired versions no reader may still see.
+     */
+    void reclaim();
+
+    /* Source of the identifiers of the builders, never reused */
+    static std::atomic<unsigned long long> nextId;
+
+    /* Epoch slot last used by the calling thread */
+    static thread_local Binding binding;
+
+    /* Identifier of `this`, unlike its address never reused */
+    const unsigned long long id;
+
+    /* Serializes the edits */
+    std::mutex writer;
+
+    /* Characters edited, only touched with the writer mutex held */
+    MyStringBuilder edited;
+
+    /* Version read by the readers */
+    std::atomic<const MyStringBuilder*> current;
+
+    /* Current epoch, advanced by each edit, starts at 1 */
+    std::atomic<unsigned long long> epoch;
+
+    /* Versions not yet deleted, by increasing epoch */
+    std::deque<Retired> retired;
+
+    /* Guards readers & owners */
+    mutable std::mutex registry;
+
+    /* Epoch slots of the threads that read `this` */
+    mutable std::vector<Reader*> readers;
+
+    /* Epoch slot of each thread */
+    mutable std::map<std::thread::id, Reader*> owners;
+};
+
+#endif /* MYSTRINGBUILDER_SHAREDBUILDER_H */
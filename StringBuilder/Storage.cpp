@@ -0,0 +1,161 @@
+/*
+ * StringBuilder Project
+ *
+ *
+ * Storage.cpp
+ *
+ * Date:        17/10/2026
+ *
+ * Author:      Mahmoud Yaman Seraj Alddin
+ *
+ * Purpose:     Implementation of the shared functions of the Storage class,
+ *              described in Storage.h
+ *
+ * List of public Functions:
+ *      ~Storage()
+ *          Virtual destructor of the Storage class.
+ *
+ *      void insert(int, const Storage&)
+ *          Inserts a copy of the characters of the given Storage at the
+ *          given position.
+ *
+ *      void splice(int, Storage&)
+ *          Moves the characters of the given Storage to the given position,
+ *          leaving the given Storage empty.
+ *
+ *      Chunk chunkAt(int) const
+ *          Returns the contiguous run of characters starting at the
+ *          given position.
+ *
+ *      char* reserveTail(int&)
+ *          Returns the free room after the last character, or nullptr.
+ *
+ *      void commitTail(int)
+ *          Appends the given count of characters written to the
+ *          reserved tail.
+ */
+
+#include "Storage.h"
+
+
+/*
+ * Pre-Conditions:
+ *      `this` Storage instance is not destroyed.
+ *
+ * Post-Conditions:
+ *      `this` Storage instance & its characters are destroyed.
+ *
+ * Virtual destructor of the Storage class.
+ * Derived classes release their own characters.
+ */
+Storage::~Storage() = default;
+
+/*
+ * Pre-Conditions:
+ *      `this` Storage instance is initialized.
+ *      Given int position is valid.
+ *      const reference to a Storage other than `this`.
+ *
+ * Post-Conditions:
+ *      The characters of the given Storage are inserted
+ *      at the given position.
+ *      No changes to the given Storage.
+ *
+ * Default implementation, inserts the chunks of the given Storage one
+ * after the other. Derived classes may override it to splice the copy
+ * in a single step.
+ * Inserts a copy of the characters of the given Storage at the
+ * given position.
+ */
+void Storage::insert(int position, const Storage& source) {
+    int offset = position;
+
+    source.forEachChunk(0, source.length(),
+                        [this, &offset](const char *data, int count) {
+        insert(offset, data, count);
+        offset += count;
+
+        return true;
+    });
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` Storage instance is initialized.
+ *      Given int position is valid.
+ *      Reference to a Storage other than `this`.
+ *
+ * Post-Conditions:
+ *      The characters of the given Storage are inserted
+ *      at the given position.
+ *      The given Storage is empty.
+ *
+ * Default implementation, copies the characters then erases them from
+ * the given Storage. Derived classes may override it to move their
+ * structure without copying characters.
+ * Moves the characters of the given Storage to the given position,
+ * leaving the given Storage empty.
+ */
+void Storage::splice(int position, Storage& source) {
+    insert(position, source);
+    source.erase(0, source.length());
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` Storage instance is initialized.
+ *      Given int position is valid, less than length().
+ *
+ * Post-Conditions:
+ *      The run of characters starting at the given position,
+ *      up to the end of its chunk, is returned.
+ *      No changes to `this`.
+ *
+ * The visit is stopped after its first chunk, so the cost is a single
+ * positional lookup of the Storage.
+ * Returns the contiguous run of characters starting at the
+ * given position.
+ */
+Storage::Chunk Storage::chunkAt(int position) const {
+    Chunk chunk{nullptr, 0};
+
+    forEachChunk(position, length(), [&chunk](const char *data, int count) {
+        chunk = {data, count};
+        return false;
+    });
+
+    return chunk;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` Storage instance is initialized.
+ *      Reference to the most characters wanted, at least 1,
+ *      at most INT_MAX - length().
+ *
+ * Post-Conditions:
+ *      nullptr is returned.
+ *      No changes to `this` or the given count.
+ *
+ * Default implementation, for the storages whose characters are not
+ * kept in a buffer with free room at the end, the callers fall back
+ * to inserting a copy.
+ * Returns the free room after the last character, or nullptr.
+ */
+char* Storage::reserveTail(int&) {
+    return nullptr;
+}
+
+/*
+ * Pre-Conditions:
+ *      `this` Storage instance is initialized.
+ *      reserveTail returned room for at least the given count.
+ *
+ * Post-Conditions:
+ *      No changes to `this`.
+ *
+ * Default implementation, reserveTail never returns any room.
+ * Appends the given count of characters written to the
+ * reserved tail.
+ */
+void Storage::commitTail(int) {}
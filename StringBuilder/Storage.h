@@ -0,0 +1,296 @@
+/*
+ * StringBuilder Project
+ *
+ *
+ * Storage.h
+ *
+ * Date:        17/10/2026
+ *
+ * Author:      Mahmoud Yaman Seraj Alddin
+ *
+ * Purpose:     Header file for the abstract Storage class,
+ *              the character storage engine behind MyStringBuilder.
+ *
+ * List of public Functions:
+ *      ~Storage()
+ *          Virtual destructor of the Storage class.
+ *
+ *      Storage* copy(int begin, int end) const
+ *          Returns a new Storage of the same kind holding a copy of the
+ *          characters between begin (inclusive) & end (exclusive).
+ *
+ *      int length() const
+ *          Returns the number of characters in the Storage.
+ *
+ *      char charAt(int) const
+ *          Returns the character at the given position.
+ *
+ *      void insert(int, const char*, int)
+ *          Inserts a copy of the given characters at the given position.
+ *
+ *      void insert(int, const Storage&)
+ *          Inserts a copy of the characters of the given Storage at the
+ *          given position.
+ *
+ *      void splice(int, Storage&)
+ *          Moves the characters of the given Storage to the given position,
+ *          leaving the given Storage empty.
+ *
+ *      void erase(int begin, int end)
+ *          Removes the characters between begin (inclusive)
+ *          & end (exclusive).
+ *
+ *      bool forEachChunk(int begin, int end, const ChunkVisitor&) const
+ *          Visits the characters between begin & end as contiguous chunks.
+ *
+ *      void forEachMutableChunk(int begin, int end,
+ *                               const MutableChunkVisitor&)
+ *          Visits the characters between begin & end as writable
+ *          contiguous chunks.
+ *
+ *      Chunk chunkAt(int) const
+ *          Returns the contiguous run of characters starting at the
+ *          given position.
+ *
+ *      char* reserveTail(int&)
+ *          Returns the free room after the last character, or nullptr.
+ *
+ *      void commitTail(int)
+ *          Appends the given count of characters written to the
+ *          reserved tail.
+ */
+
+#ifndef MYSTRINGBUILDER_STORAGE_H
+#define MYSTRINGBUILDER_STORAGE_H
+
+#include <functional>
+
+/*
+ * Storage is the interface every MyStringBuilder storage engine implements.
+ * All positions given to a Storage are assumed valid,
+ * index checking is the responsibility of MyStringBuilder.
+ */
+class Storage {
+public:
+    /*
+     * Type alias for the read-only chunk visitor.
+     * Called with a pointer to a run of characters & the run length.
+     * Returning false stops the visit.
+     */
+    typedef std::function<bool(const char*, int)> ChunkVisitor;
+
+    /*
+     * Type alias for the writable chunk visitor.
+     * Called with a pointer to a run of characters & the run length.
+     */
+    typedef std::function<void(char*, int)> MutableChunkVisitor;
+
+    /*
+     * Contiguous run of characters of a Storage.
+     * Valid until the Storage is changed.
+     */
+    struct Chunk {
+        /* First character of the run */
+        const char *data;
+
+        /* Number of characters in the run */
+        int count;
+    };
+
+    /*
+     * Pre-Conditions:
+     *      `this` Storage instance is not destroyed.
+     *
+     * Post-Conditions:
+     *      `this` Storage instance & its characters are destroyed.
+     *
+     * Virtual destructor of the Storage class.
+     */
+    virtual ~Storage();
+
+    /*
+     * Pre-Conditions:
+     *      `this` Storage instance is initialized.
+     *      begin & end are valid positions, begin <= end.
+     *
+     * Post-Conditions:
+     *      A heap allocated Storage of the same kind is returned.
+     *      No changes to `this`.
+     *
+     * Returns a new Storage of the same kind holding a copy of the
+     * characters between begin (inclusive) & end (exclusive).
+     */
+    [[nodiscard]] virtual Storage* copy(int /* begin */,
+                                       int /* end */) const = 0;
+
+    /*
+     * Pre-Conditions:
+     *      `this` Storage instance is initialized.
+     *
+     * Post-Conditions:
+     *      Number of characters in the Storage is returned.
+     *      No changes to `this`.
+     *
+     * Returns the number of characters in the Storage.
+     */
+    [[nodiscard]] virtual int length() const = 0;
+
+    /*
+     * Pre-Conditions:
+     *      `this` Storage instance is initialized.
+     *      Given int position is valid, less than length().
+     *
+     * Post-Conditions:
+     *      Character at the given position is returned.
+     *      No changes to `this`.
+     *
+     * Returns the character at the given position.
+     */
+    [[nodiscard]] virtual char charAt(int) const = 0;
+
+    /*
+     * Pre-Conditions:
+     *      `this` Storage instance is initialized.
+     *      Given int position is valid.
+     *      Pointer to the characters to insert & their count.
+     *
+     * Post-Conditions:
+     *      The given characters are inserted at the given position.
+     *
+     * Inserts a copy of the given characters at the given position.
+     */
+    virtual void insert(int, const char*, int) = 0;
+
+    /*
+     * Pre-Conditions:
+     *      `this` Storage instance is initialized.
+     *      Given int position is valid.
+     *      const reference to a Storage other than `this`.
+     *
+     * Post-Conditions:
+     *      The characters of the given Storage are inserted
+     *      at the given position.
+     *      No changes to the given Storage.
+     *
+     * Inserts a copy of the characters of the given Storage at the
+     * given position.
+     */
+    virtual void insert(int, const Storage&);
+
+    /*
+     * Pre-Conditions:
+     *      `this` Storage instance is initialized.
+     *      Given int position is valid.
+     *      Reference to a Storage other than `this`.
+     *
+     * Post-Conditions:
+     *      The characters of the given Storage are inserted
+     *      at the given position.
+     *      The given Storage is empty.
+     *
+     * Moves the characters of the given Storage to the given position,
+     * leaving the given Storage empty.
+     */
+    virtual void splice(int, Storage&);
+
+    /*
+     * Pre-Conditions:
+     *      `this` Storage instance is initialized.
+     *      begin & end are valid positions, begin <= end.
+     *
+     * Post-Conditions:
+     *      The characters between begin & end are removed.
+     *
+     * Removes the characters between begin (inclusive) & end (exclusive).
+     */
+    virtual void erase(int /* begin */, int /* end */) = 0;
+
+    /*
+     * Pre-Conditions:
+     *      `this` Storage instance is initialized.
+     *      begin & end are valid positions, begin <= end.
+     *      const reference to a ChunkVisitor.
+     *
+     * Post-Conditions:
+     *      The visitor is called, in order, for each contiguous run of
+     *      characters between begin & end, until it returns false.
+     *      Returns false if the visitor stopped the visit.
+     *      No changes to `this`.
+     *
+     * Visits the characters between begin & end as contiguous chunks.
+     */
+    virtual bool forEachChunk(int /* begin */, int /* end */,
+                              const ChunkVisitor&) const = 0;
+
+    /*
+     * Pre-Conditions:
+     *      `this` Storage instance is initialized.
+     *      begin & end are valid positions, begin <= end.
+     *      const reference to a MutableChunkVisitor.
+     *
+     * Post-Conditions:
+     *      The visitor is called, in order, for each contiguous run of
+     *      characters between begin & end.
+     *      Changes made by the visitor are stored in `this`.
+     *
+     * Visits the characters between begin & end as writable
+     * contiguous chunks.
+     */
+    virtual void forEachMutableChunk(int /* begin */, int /* end */,
+                                     const MutableChunkVisitor&) = 0;
+
+    /*
+     * Pre-Conditions:
+     *      `this` Storage instance is initialized.
+     *      Given int position is valid, less than length().
+     *
+     * Post-Conditions:
+     *      The run of characters starting at the given position,
+     *      up to the end of its chunk, is returned.
+     *      No changes to `this`.
+     *
+     * Returns the contiguous run of characters starting at the
+     * given position.
+     */
+    [[nodiscard]] Chunk chunkAt(int) const;
+
+    /*
+     * Pre-Conditions:
+     *      `this` Storage instance is initialized.
+     *      Reference to the most characters wanted, at least 1,
+     *      at most INT_MAX - length().
+     *
+     * Post-Conditions:
+     *      Pointer to the free room after the last character is returned,
+     *      the given count is lowered to its size.
+     *      nullptr is returned if `this` has no free room,
+     *      nothing is allocated.
+     *      length() is unchanged.
+     *
+     * Lets a reader write straight into `this`, the room is valid until
+     * the next call to a non-const function of `this`, which must be
+     * commitTail. Once the room is used up, the reader inserts a copy,
+     * which grows `this` as usual.
+     * Default implementation, returns nullptr.
+     * Returns the free room after the last character, or nullptr.
+     */
+    [[nodiscard]] virtual char* reserveTail(int&);
+
+    /*
+     * Pre-Conditions:
+     *      `this` Storage instance is initialized.
+     *      reserveTail returned room for at least the given count,
+     *      its first count characters are written.
+     *
+     * Post-Conditions:
+     *      The first count characters of the reserved room are appended,
+     *      the rest of the room is given back.
+     *
+     * Default implementation, does nothing as no room is ever reserved.
+     * Appends the given count of characters written to the
+     * reserved tail.
+     */
+    virtual void commitTail(int);
+};
+
+#endif /* MYSTRINGBUILDER_STORAGE_H */
@@ -0,0 +1,194 @@
+/*
+ * StringBuilder Project
+ *
+ *
+ * ConcurrentAppendBenchmark.cpp
+ *
+ * Date:        17/10/2026
+ *
+ * Author:      Mahmoud Yaman Seraj Alddin
+ *
+ * Purpose:     Measures the throughput of appends from 1 to 32 threads,
+ *              into a MyStringBuilder behind a mutex & into a
+ *              ConcurrentBuilder in both merge orders.
+ *              Usage: bench_concurrent_append [total appends]
+ *
+ * List of global Functions:
+ *      int main(int, char**)
+ *          Runs the benchmark & prints a table of the results.
+ *
+ * List of local Functions:
+ *      double elapsed(Clock::time_point)
+ *          Returns the milliseconds since the given time.
+ *
+ *      double runLocked(int, int)
+ *          Appends from the given number of threads into a shared
+ *          MyStringBuilder guarded by a mutex.
+ *
+ *      double runConcurrent(int, int, ConcurrentBuilder::Order, double&)
+ *          Appends from the given number of threads into a
+ *          ConcurrentBuilder, then merges it.
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ConcurrentBuilder.h"
+#include "MyStringBuilder.h"
+
+using namespace std;
+
+typedef chrono::steady_clock Clock;
+
+/* Fragment appended by every call, the size of a short log field */
+static const string kFragment = "worker appended a fragment\n";
+
+/*
+ * Pre-Conditions:
+ *      A time point of the steady clock.
+ *
+ * Post-Conditions:
+ *      Milliseconds since the given time are returned.
+ *
+ * Returns the milliseconds since the given time.
+ */
+static double elapsed(Clock::time_point start) {
+    return chrono::duration<double, milli>(Clock::now() - start).count();
+}
+
+/*
+ * Pre-Conditions:
+ *      int of the number of threads, at least 1.
+ *      int of the total number of appends, split between the threads.
+ *
+ * Post-Conditions:
+ *      Milliseconds taken by all the appends are returned.
+ *
+ * The baseline, every append takes the same global mutex.
+ * Appends from the given number of threads into a shared
+ * MyStringBuilder guarded by a mutex.
+ */
+static double runLocked(int threads, int appends) {
+    MyStringBuilder builder("");
+    mutex lock;
+    vector<thread> workers;
+    const auto start = Clock::now();
+
+    for (int t = 0; t < threads; t++) {
+        workers.emplace_back([&, t]() {
+            for (int i = t; i < appends; i += threads) {
+                lock_guard<mutex> guard(lock);
+
+                builder.append(string_view(kFragment));
+            }
+        });
+    }
+
+    for (auto& worker: workers) {
+        worker.join();
+    }
+
+    return elapsed(start);
+}
+
+/*
+ * Pre-Conditions:
+ *      int of the number of threads, at least 1.
+ *      int of the total number of appends, split between the threads.
+ *      Merge order of the ConcurrentBuilder.
+ *      Reference to the double receiving the milliseconds of the merge.
+ *
+ * Post-Conditions:
+ *      Milliseconds taken by all the appends are returned.
+ *      The milliseconds taken by flatten are stored in the given double.
+ *
+ * Appends from the given number of threads into a
+ * ConcurrentBuilder, then merges it.
+ */
+static double runConcurrent(int threads, int appends,
+                            ConcurrentBuilder::Order order, double& merge) {
+    ConcurrentBuilder builder(order);
+    vector<thread> workers;
+    const auto start = Clock::now();
+
+    for (int t = 0; t < threads; t++) {
+        workers.emplace_back([&, t]() {
+            for (int i = t; i < appends; i += threads) {
+                builder.append(kFragment);
+            }
+        });
+    }
+
+    for (auto& worker: workers) {
+        worker.join();
+    }
+
+    const double append = elapsed(start);
+    const auto flattenStart = Clock::now();
+
+    if (builder.flatten().length() != appends * (int) kFragment.size()) {
+        cerr << "Wrong length after the merge" << endl;
+        exit(1);
+    }
+
+    merge = elapsed(flattenStart);
+    return append;
+}
+
+/*
+ * Pre-Conditions:
+ *      Optional argument, the total number of appends.
+ *
+ * Post-Conditions:
+ *      A table of the millions of appends per second of each variant
+ *      & the merge times is printed, for 1 to 32 threads.
+ *      Returns 0.
+ *
+ * The total is split between the threads, so perfect scaling halves
+ * the time when the threads double, up to the number of cores.
+ * Runs the benchmark & prints a table of the results.
+ */
+int main(int argc, char **argv) {
+    const int appends = argc > 1 ? atoi(argv[1]) : 4000000;
+
+    cout << "appends: " << appends << " x " << kFragment.size()
+         << " characters, cores: " << thread::hardware_concurrency() << endl
+         << "threads  mutex Ma/s  per-thread Ma/s  ticket Ma/s"
+         << "  merge per-thread ms  merge ticket ms" << endl
+         << fixed << setprecision(1);
+
+    for (int threads = 1; threads <= 32; threads *= 2) {
+        double perThreadMerge = 0;
+        double ticketMerge = 0;
+
+        const double locked = runLocked(threads, appends);
+        const double perThread = runConcurrent(
+                threads, appends, ConcurrentBuilder::Order::kPerThread,
+                perThreadMerge
+        );
+        const double ticket = runConcurrent(
+                threads, appends, ConcurrentBuilder::Order::kTicket,
+                ticketMerge
+        );
+
+        /* Millions of appends per second, from milliseconds */
+        auto rate = [appends](double ms) {
+            return appends / ms / 1000;
+        };
+
+        cout << setw(7) << threads
+             << setw(13) << rate(locked)
+             << setw(17) << rate(perThread)
+             << setw(13) << rate(ticket)
+             << setw(21) << perThreadMerge
+             << setw(17) << ticketMerge << endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,719 @@
+/*
+ * StringBuilder Project
+ *
+ *
+ * StringBuilderBenchmark.cpp
+ *
+ * Date:        17/10/2026
+ *
+ * Author:      Mahmoud Yaman Seraj Alddin
+ *
+ * Purpose:     Measures the operations of MyStringBuilder in each storage
+ *              mode against std::string, for sizes from 1 KiB to 100 MiB,
+ *              & prints the nanoseconds, characters & heap allocations
+ *              per operation,
+ *              optionally as JSON to track regressions.
+ *              Usage: bench_stringbuilder [--max-size characters]
+ *                     [--repetitions n] [--warmup n] [--filter operation]
+ *                     [--json file, - for the standard output]
+ *
+ * List of global Functions:
+ *      int main(int, char**)
+ *          Runs the benchmark & prints the results.
+ *
+ *      void* operator new(std::size_t)
+ *          Allocates the given number of bytes & counts the allocation.
+ *
+ *      void operator delete(void*)
+ *          Frees memory from operator new.
+ *
+ * List of local Functions:
+ *      double elapsed(Clock::time_point)
+ *          Returns the nanoseconds since the given time.
+ *
+ *      std::string makeText(int)
+ *          Returns the given number of random lowercase letters.
+ *
+ *      void build(T&, const std::string&, Mode)
+ *          Fills the given subject with the given characters.
+ *
+ *      void perform(Operation, T&, long long, const std::string&, Mode)
+ *          Performs the given operation the given number of times.
+ *
+ *      Result measure(const Spec&, const Subject&, const std::string&,
+ *                     const Options&)
+ *          Times one operation on one subject at one size.
+ *
+ *      Result measureSubject(const Spec&, const Subject&,
+ *                            const std::string&, const Options&)
+ *          Times one operation on the type of the given subject.
+ *
+ *      void writeJson(std::ostream&, const std::vector<Result>&,
+ *                     const Options&)
+ *          Writes the results as a JSON document.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "MyStringBuilder.h"
+
+using namespace std;
+
+typedef chrono::steady_clock Clock;
+
+typedef MyStringBuilder::Mode Mode;
+
+/* Operations measured, in the order of the report */
+enum class Operation {
+    kConstruct,
+    kInsertHead,
+    kInsertMiddle,
+    kInsertTail,
+    kAppendInt,
+    kCharAtRandom,
+    kCharAtSequential,
+    kSubstring,
+    kReplace,
+    kClear,
+    kToUpperCase,
+    kToString,
+    kIndexOf,
+    kFlattenFind,
+};
+
+/*
+ * Description of an operation.
+ * chars is the number of characters an operation reads or writes,
+ * 0 for the size of the subject, -1 for half of it.
+ * A mutating operation rebuilds its subject, untimed, before it has run
+ * more than size / (2 * chars) times, so the size changes by at most half.
+ * builderOnly skips std::string, for which the operation is the same
+ * as another.
+ */
+struct Spec {
+    Operation operation;
+    const char *name;
+    int chars;
+    bool mutating;
+    bool builderOnly;
+};
+
+/* Type of storage measured, a MyStringBuilder mode or std::string */
+struct Subject {
+    const char *name;
+    bool builder;
+    Mode mode;
+};
+
+/* Options from the command line */
+struct Options {
+    int maxSize;
+    int repetitions;
+    int warmup;
+    string filter;
+    string json;
+};
+
+/*
+ * Times of one operation on one subject at one size.
+ * allocsPerOp & allocatedPerOp count the heap allocations made by the
+ * timed operations & the bytes they requested.
+ */
+struct Result {
+    string operation;
+    string subject;
+    int size;
+    double nsPerOp;
+    double minNsPerOp;
+    double charsPerOp;
+    double allocsPerOp;
+    double allocatedPerOp;
+    long long ops;
+};
+
+/* Characters inserted, replaced & cleared by one operation */
+static const string kFragment = "0123456789abcdef";
+
+/* Absent from the text, '#' is never generated, so every search scans it all */
+static const string kNeedle = "needle#";
+
+/* Shortest timed part of a sample, in nanoseconds */
+static const double kMinSampleNs = 5e6;
+
+/* Most rounds of a sample, bounds the rebuilds of small subjects */
+static const int kMaxRounds = 1000;
+
+/* Operations, see Spec */
+static const Spec kSpecs[] = {
+        {Operation::kConstruct, "constructor", 0, false, false},
+        {Operation::kInsertHead, "insert_head", 16, true, false},
+        {Operation::kInsertMiddle, "insert_middle", 16, true, false},
+        {Operation::kInsertTail, "insert_tail", 16, true, false},
+        {Operation::kAppendInt, "append_int", 7, true, false},
+        {Operation::kCharAtRandom, "charAt_random", 1, false, false},
+        {Operation::kCharAtSequential, "charAt_sequential", 1, false, false},
+        {Operation::kSubstring, "substring_half", -1, false, false},
+        {Operation::kReplace, "replace", 16, false, false},
+        {Operation::kClear, "clear", 16, true, false},
+        {Operation::kToUpperCase, "toUpperCase", 0, false, false},
+        {Operation::kToString, "toString", 0, false, false},
+        {Operation::kIndexOf, "indexOf", 0, false, false},
+        {Operation::kFlattenFind, "toString_find", 0, false, true},
+};
+
+/* Subjects, see Subject */
+static const Subject kSubjects[] = {
+        {"std::string", false, Mode::kRope},
+        {"rope", true, Mode::kRope},
+        {"chain", true, Mode::kChain},
+        {"gap", true, Mode::kGapBuffer},
+        {"piece", true, Mode::kPieceTable},
+};
+
+/* Receives the results of the reads, so they are not optimized away */
+static volatile long long sink = 0;
+
+/* Heap allocations made by the process, & the bytes they requested */
+static atomic<long long> allocations(0);
+static atomic<long long> allocated(0);
+
+/*
+ * Pre-Conditions:
+ *      Number of bytes to allocate.
+ *
+ * Post-Conditions:
+ *      Pointer to the allocated memory is returned.
+ *      A bad_alloc exception is thrown if none is left.
+ *
+ * Replaces the global operator new of the benchmark, every other form
+ * of new falls back to it, so the counters see all the allocations.
+ * Allocates the given number of bytes & counts the allocation.
+ */
+void* operator new(size_t size) {
+    allocations.fetch_add(1, memory_order_relaxed);
+    allocated.fetch_add((long long) size, memory_order_relaxed);
+
+    if (void *memory = malloc(size ? size : 1)) {
+        return memory;
+    }
+
+    throw bad_alloc();
+}
+
+/*
+ * Pre-Conditions:
+ *      Pointer from operator new, or nullptr.
+ *
+ * Post-Conditions:
+ *      The memory is freed.
+ *
+ * Frees memory from operator new.
+ */
+void operator delete(void *memory) noexcept {
+    free(memory);
+}
+
+/* Sized form, the size is not needed to free */
+void operator delete(void *memory, size_t) noexcept {
+    free(memory);
+}
+
+/*
+ * Pre-Conditions:
+ *      A time point of the steady clock.
+ *
+ * Post-Conditions:
+ *      Nanoseconds since the given time are returned.
+ *
+ * Returns the nanoseconds since the given time.
+ */
+static double elapsed(Clock::time_point start) {
+    return chrono::duration<double, nano>(Clock::now() - start).count();
+}
+
+/*
+ * Pre-Conditions:
+ *      int of the number of characters.
+ *
+ * Post-Conditions:
+ *      A string of the given number of letters from 'a' to 'y' is
+ *      returned, the same for the same size.
+ *
+ * Returns the given number of random lowercase letters.
+ */
+static string makeText(int size) {
+    mt19937 random(size);
+    string result(size, '\0');
+
+    for (char& c: result) {
+        c = (char) ('a' + random() % 25);
+    }
+
+    return result;
+}
+
+/*
+ * Pre-Conditions:
+ *      Reference to a std::string.
+ *      const reference to the characters.
+ *      Unused mode.
+ *
+ * Post-Conditions:
+ *      The string holds a copy of the characters.
+ *
+ * Fills the given subject with the given characters.
+ */
+static void build(string& subject, const string& text, Mode) {
+    subject = text;
+}
+
+/*
+ * Pre-Conditions:
+ *      Reference to a MyStringBuilder.
+ *      const reference to the characters.
+ *      Mode of the storage.
+ *
+ * Post-Conditions:
+ *      The MyStringBuilder holds a copy of the characters in the
+ *      given mode.
+ *
+ * Fills the given subject with the given characters.
+ */
+static void build(MyStringBuilder& subject, const string& text, Mode mode) {
+    subject = MyStringBuilder(text, mode);
+}
+
+/*
+ * Pre-Conditions:
+ *      The operation.
+ *      Reference to the std::string or MyStringBuilder subject,
+ *      built from the text.
+ *      long long of the number of times to perform it.
+ *      const reference to the text of the subject.
+ *      Mode of the subject, if a MyStringBuilder.
+ *
+ * Post-Conditions:
+ *      The operation is performed the given number of times.
+ *
+ * Both types are driven by the same calls, only the names of their
+ * methods differ, the std::string case conversion is a plain ASCII loop.
+ * Performs the given operation the given number of times.
+ */
+template<typename T>
+static void perform(Operation operation, T& subject, long long count,
+                    const string& text, Mode mode) {
+    constexpr bool builder = is_same<T, MyStringBuilder>::value;
+    const string_view fragment(kFragment);
+    const int size = (int) text.size();
+    long long read = 0;
+
+    switch (operation) {
+        case Operation::kConstruct:
+            for (long long i = 0; i < count; i++) {
+                T copy = T("");
+
+                build(copy, text, mode);
+                read += copy.length();
+            }
+            break;
+        case Operation::kInsertHead:
+        case Operation::kInsertMiddle:
+        case Operation::kInsertTail:
+            for (long long i = 0; i < count; i++) {
+                const int length = (int) subject.length();
+                const int position = operation == Operation::kInsertHead ? 0
+                        : operation == Operation::kInsertMiddle ? length / 2
+                        : length;
+
+                subject.insert(position, fragment);
+            }
+            break;
+        case Operation::kAppendInt:
+            for (long long i = 0; i < count; i++) {
+                /* Always 7 digits */
+                const int value = 1000000 + (int) (i & 0xFFFFF);
+
+                if constexpr (builder) {
+                    subject.append(value);
+                } else {
+                    char digits[16];
+                    const auto end = to_chars(digits, digits + 16, value).ptr;
+
+                    subject.append(digits, end - digits);
+                }
+            }
+            break;
+        case Operation::kCharAtRandom: {
+            unsigned long long state = 88172645463325252ULL;
+
+            for (long long i = 0; i < count; i++) {
+                state ^= state << 13;
+                state ^= state >> 7;
+                state ^= state << 17;
+
+                if constexpr (builder) {
+                    read += subject.charAt((int) (state % size));
+                } else {
+                    read += subject[state % size];
+                }
+            }
+            break;
+        }
+        case Operation::kCharAtSequential:
+            for (long long i = 0, position = 0; i < count; i++) {
+                if constexpr (builder) {
+                    read += subject.charAt((int) position);
+                } else {
+                    read += subject[position];
+                }
+
+                if (++position == size) {
+                    position = 0;
+                }
+            }
+            break;
+        case Operation::kSubstring:
+            for (long long i = 0; i < count; i++) {
+                if constexpr (builder) {
+                    read += subject.substring(size / 4, size / 4 + size / 2)
+                            .length();
+                } else {
+                    read += subject.substr(size / 4, size / 2).length();
+                }
+            }
+            break;
+        case Operation::kReplace:
+            for (long long i = 0; i < count; i++) {
+                const int position = (int) ((i * 7919) % (size - 16));
+
+                if constexpr (builder) {
+                    subject.replace(position, position + 16, fragment);
+                } else {
+                    subject.replace(position, 16, fragment);
+                }
+            }
+            break;
+        case Operation::kClear:
+            for (long long i = 0; i < count; i++) {
+                const int position = (int) subject.length() / 2;
+
+                if constexpr (builder) {
+                    subject.clear(position, position + 16);
+                } else {
+                    subject.erase(position, 16);
+                }
+            }
+            break;
+        case Operation::kToUpperCase:
+            for (long long i = 0; i < count; i++) {
+                if constexpr (builder) {
+                    subject.toUpperCase();
+                } else {
+                    for (char& c: subject) {
+                        c = 'a' <= c and c <= 'z' ? (char) (c - 32) : c;
+                    }
+                }
+            }
+            break;
+        case Operation::kToString:
+            for (long long i = 0; i < count; i++) {
+                if constexpr (builder) {
+                    read += (long long) subject.toString().size();
+                } else {
+                    read += (long long) string(subject).size();
+                }
+            }
+            break;
+        case Operation::kIndexOf:
+            for (long long i = 0; i < count; i++) {
+                if constexpr (builder) {
+                    read += subject.indexOf(kNeedle);
+                } else {
+                    read += (long long) subject.find(kNeedle);
+                }
+            }
+            break;
+        case Operation::kFlattenFind:
+            /* The search before indexOf, flattening the storage first */
+            for (long long i = 0; i < count; i++) {
+                if constexpr (builder) {
+                    read += (long long) subject.toString().find(kNeedle);
+                }
+            }
+            break;
+    }
+
+    sink += read;
+}
+
+/*
+ * Pre-Conditions:
+ *      const reference to the operation.
+ *      const reference to the subject, of type T.
+ *      const reference to the text of the subject.
+ *      const reference to the options.
+ *
+ * Post-Conditions:
+ *      The median & fastest nanoseconds per operation over the
+ *      repetitions are returned.
+ *
+ * The number of operations per round is doubled until a round takes
+ * kMinSampleNs, or the operation would change the size by more than half.
+ * Each sample then runs rounds until kMinSampleNs of them are timed.
+ * The rebuilds of the mutated subjects are untimed, the costs paid once
+ * per rebuild, such as moving the gap, are spread over the rounds.
+ * Times one operation on one subject at one size.
+ */
+template<typename T>
+static Result measure(const Spec& spec, const Subject& kind,
+                      const string& text, const Options& options) {
+    const int size = (int) text.size();
+    const int chars = spec.chars == 0 ? size
+            : spec.chars < 0 ? size / 2 : spec.chars;
+    const long long cap = spec.mutating ? max(1, size / (2 * chars))
+                                        : 1LL << 40;
+    T subject = T("");
+    long long batch = 1;
+    long long applied = 0;
+
+    /* Allocations of the timed operations, & the bytes they requested */
+    long long timedAllocations = 0;
+    long long timedAllocated = 0;
+
+    /* Runs batch operations, returns their nanoseconds */
+    auto round = [&]() {
+        if (spec.mutating and cap < applied + batch) {
+            build(subject, text, kind.mode);
+            applied = 0;
+        }
+
+        const long long allocationsBefore = allocations.load(memory_order_relaxed);
+        const long long allocatedBefore = allocated.load(memory_order_relaxed);
+        const auto start = Clock::now();
+
+        perform(spec.operation, subject, batch, text, kind.mode);
+
+        const double ns = elapsed(start);
+
+        timedAllocations += allocations.load(memory_order_relaxed) - allocationsBefore;
+        timedAllocated += allocated.load(memory_order_relaxed) - allocatedBefore;
+        applied += batch;
+
+        return ns;
+    };
+
+    /* Runs rounds until kMinSampleNs are timed, returns their nanoseconds */
+    auto sample = [&](long long& ops) {
+        double total = 0;
+
+        for (int i = 0; i < kMaxRounds and total < kMinSampleNs; i++) {
+            total += round();
+            ops += batch;
+        }
+
+        return total;
+    };
+
+    build(subject, text, kind.mode);
+
+    /* The first operation may move the gap or index the storage, untimed */
+    round();
+
+    /* Calibration, also the first warmup */
+    while (round() < kMinSampleNs and batch < cap) {
+        batch = min(cap, batch * 2);
+    }
+
+    for (int i = 0; i < options.warmup; i++) {
+        long long ignored = 0;
+
+        sample(ignored);
+    }
+
+    vector<double> samples;
+    long long ops = 0;
+
+    /* Only the allocations of the measured samples are reported */
+    timedAllocations = 0;
+    timedAllocated = 0;
+
+    for (int i = 0; i < options.repetitions; i++) {
+        long long sampleOps = 0;
+        const double ns = sample(sampleOps);
+
+        samples.push_back(ns / (double) sampleOps);
+        ops += sampleOps;
+    }
+
+    sort(samples.begin(), samples.end());
+
+    return Result{spec.name, kind.name, size, samples[samples.size() / 2],
+                  samples[0], (double) chars,
+                  (double) timedAllocations / (double) ops,
+                  (double) timedAllocated / (double) ops, ops};
+}
+
+/*
+ * Pre-Conditions:
+ *      const reference to the operation.
+ *      const reference to the subject.
+ *      const reference to the text of the subject.
+ *      const reference to the options.
+ *
+ * Post-Conditions:
+ *      The result of measure for the type of the subject is returned.
+ *
+ * Times one operation on the type of the given subject.
+ */
+static Result measureSubject(const Spec& spec, const Subject& kind,
+                             const string& text, const Options& options) {
+    return kind.builder ? measure<MyStringBuilder>(spec, kind, text, options)
+                        : measure<string>(spec, kind, text, options);
+}
+
+/*
+ * Pre-Conditions:
+ *      Reference to an output stream.
+ *      const reference to the results.
+ *      const reference to the options.
+ *
+ * Post-Conditions:
+ *      A JSON object with the settings & an array of the results
+ *      is written to the stream.
+ *
+ * Writes the results as a JSON document.
+ */
+static void writeJson(ostream& out, const vector<Result>& results,
+                      const Options& options) {
+    out << "{\n"
+        << "  \"benchmark\": \"bench_stringbuilder\",\n"
+        << "  \"repetitions\": " << options.repetitions << ",\n"
+        << "  \"warmup\": " << options.warmup << ",\n"
+        << "  \"min_sample_ns\": " << kMinSampleNs << ",\n"
+        << "  \"results\": [";
+
+    for (int i = 0; i < (int) results.size(); i++) {
+        const Result& result = results[i];
+
+        out << (i ? ",\n" : "\n")
+            << "    {\"operation\": \"" << result.operation << "\""
+            << ", \"subject\": \"" << result.subject << "\""
+            << ", \"size\": " << result.size
+            << ", \"ns_per_op\": " << result.nsPerOp
+            << ", \"min_ns_per_op\": " << result.minNsPerOp
+            << ", \"chars_per_op\": " << result.charsPerOp
+            << ", \"allocs_per_op\": " << result.allocsPerOp
+            << ", \"allocated_bytes_per_op\": " << result.allocatedPerOp
+            << ", \"ops\": " << result.ops << "}";
+    }
+
+    out << "\n  ]\n}\n";
+}
+
+/*
+ * Pre-Conditions:
+ *      Optional arguments, see the usage in the header.
+ *
+ * Post-Conditions:
+ *      A table of the nanoseconds, characters & allocations per operation
+ *      & the throughput of each operation, subject & size is printed,
+ *      the JSON document is written if requested.
+ *      Returns 0, or 1 for invalid arguments.
+ *
+ * The sizes grow tenfold from 1 KiB, up to the maximum size.
+ * Runs the benchmark & prints the results.
+ */
+int main(int argc, char **argv) {
+    Options options{100 << 20, 5, 1, "", ""};
+
+    for (int i = 1; i < argc; i++) {
+        const string argument = argv[i];
+
+        if (i + 1 == argc) {
+            cerr << "Missing value of " << argument << endl;
+            return 1;
+        } else if (argument == "--max-size") {
+            options.maxSize = atoi(argv[++i]);
+        } else if (argument == "--repetitions") {
+            options.repetitions = max(1, atoi(argv[++i]));
+        } else if (argument == "--warmup") {
+            options.warmup = max(0, atoi(argv[++i]));
+        } else if (argument == "--filter") {
+            options.filter = argv[++i];
+        } else if (argument == "--json") {
+            options.json = argv[++i];
+        } else {
+            cerr << "Unknown argument " << argument << endl;
+            return 1;
+        }
+    }
+
+    /* The table goes to the standard error when it holds the JSON */
+    ostream& table = options.json == "-" ? cerr : cout;
+    vector<Result> results;
+
+    table << left << setw(20) << "operation" << setw(13) << "subject"
+          << right << setw(11) << "size" << setw(15) << "ns/op"
+          << setw(15) << "min ns/op" << setw(12) << "chars/op"
+          << setw(11) << "MB/s" << setw(12) << "allocs/op"
+          << setw(15) << "alloc B/op" << endl
+          << fixed << setprecision(1);
+
+    for (const Spec& spec: kSpecs) {
+        if (string(spec.name).find(options.filter) == string::npos) {
+            continue;
+        }
+
+        for (long long size = 1 << 10; size <= options.maxSize; size *= 10) {
+            const string text = makeText((int) size);
+
+            for (const Subject& kind: kSubjects) {
+                if (spec.builderOnly and not kind.builder) {
+                    continue;
+                }
+
+                const Result result = measureSubject(spec, kind, text, options);
+
+                results.push_back(result);
+                table << left << setw(20) << result.operation
+                      << setw(13) << result.subject
+                      << right << setw(11) << result.size
+                      << setw(15) << result.nsPerOp
+                      << setw(15) << result.minNsPerOp
+                      << setw(12) << result.charsPerOp
+                      << setw(11) << result.charsPerOp * 1000 / result.nsPerOp
+                      << setw(12) << result.allocsPerOp
+                      << setw(15) << result.allocatedPerOp
+                      << endl;
+            }
+        }
+    }
+
+    if (options.json == "-") {
+        writeJson(cout, results, options);
+    } else if (not options.json.empty()) {
+        ofstream out(options.json);
+
+        writeJson(out, results, options);
+
+        if (not out) {
+            cerr << "Cannot write " << options.json << endl;
+            return 1;
+        }
+    }
+
+    return 0;
+}
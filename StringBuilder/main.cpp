@@ -102,19 +102,27 @@
  *
  *    void displayStringBuilder(const MyStringBuilder&, ostream& out = cout)
  *          Displays the current StringBuilder.
+ *
+ *    void searchKeywords(const StringBuilders&,
+ *                        ostream& out = cout, istream& in = cin)
+ *          Performs all the necessary input & output to search all the
+ *          StringBuilders for a list of keywords.
  */
 
 #include <iostream>
 #include <map>
+#include <sstream>
 #include <string>
+#include <vector>
 
 #include "MyStringBuilder.h"
+#include "PatternMatcher.h"
 
 
 using namespace std;
 
 /* Type alias, shortens typing */
-typedef map<string, MyStringBuilder> StringBuilders;
+typedef PatternMatcher::Builders StringBuilders;
 
 /*
  * Pre-Conditions:
@@ -140,7 +148,7 @@ void displaySeparator(ostream& out = cout) {
  * Displays the options menu.
  */
 int displayMenu(ostream& out = cout) {
-    static const int kNumberOfOptions = 12;
+    static const int kNumberOfOptions = 13;
 
     displaySeparator(out);
 
@@ -156,6 +164,7 @@ int displayMenu(ostream& out = cout) {
             "Replace a section from the StringBuilder",
             "Set the StringBuilder to upper case",
             "Display current StringBuilder",
+            "Search all StringBuilders for keywords",
             "Exit",
     };
 
@@ -373,7 +382,7 @@ int getUserChoice(const string& current_key,
  *
  * Post-Conditions:
  *      Inserts the identifier into StringBuilders, with an
- *      empty StringBuilder.
+ *      empty StringBuilder of the chosen storage mode.
  *      Informs user with success.
  *
  * Performs all necessary input & output to create a new
@@ -382,8 +391,17 @@ int getUserChoice(const string& current_key,
 void createStringBuilder(StringBuilders& values,
                          ostream& out = cout, istream& in = cin) {
     string name = get("Enter an identifier name", out, in);
-    MyStringBuilder temp = MyStringBuilder("");
-    values.insert_or_assign(name, temp);
+    const MyStringBuilder::Mode modes[] = {
+            MyStringBuilder::Mode::kRope,
+            MyStringBuilder::Mode::kChain,
+            MyStringBuilder::Mode::kGapBuffer,
+            MyStringBuilder::Mode::kPieceTable,
+    };
+
+    int mode = getInt("0 for rope, 1 for Node chain, 2 for gap buffer, "
+                      "3 for piece table storage", out, in, 0, 3, 0);
+
+    values.insert_or_assign(name, MyStringBuilder("", modes[mode]));
 
     displayDataMessage("Builder created successfully.", out);
 }
@@ -476,7 +494,8 @@ void insertString(StringBuilders& values,
     int mode = getInt("0 to insert string, 1 to insert existing StringBuilder",
                       out, in, 0, 1, 0);
 
-    MyStringBuilder *to_be_inserted;
+    MyStringBuilder typed("");
+    MyStringBuilder *to_be_inserted = &typed;
 
     if (mode) {
         /* Take string */
@@ -489,8 +508,7 @@ void insertString(StringBuilders& values,
         }
     } else {
         /* Take a string builder identifier */
-        to_be_inserted = new MyStringBuilder(get("Enter a string",
-                                                 out, in));
+        typed = MyStringBuilder(get("Enter a string", out, in));
     }
 
     int position = getInt("Enter insertion position", out, in,
@@ -520,7 +538,8 @@ void appendString(StringBuilders& values,
     int mode = getInt("0 to append string, 1 to append existing StringBuilder",
                       out, in, 0, 1, 0);
 
-    MyStringBuilder *to_be_inserted;
+    MyStringBuilder typed("");
+    MyStringBuilder *to_be_inserted = &typed;
 
     if (mode) {
         /* Take string */
@@ -533,8 +552,7 @@ void appendString(StringBuilders& values,
         }
     } else {
         /* Get identifier */
-        to_be_inserted = new MyStringBuilder(get("Enter a string",
-                                                 out, in));
+        typed = MyStringBuilder(get("Enter a string", out, in));
     }
 
     current.append(*to_be_inserted);
@@ -596,7 +614,7 @@ void displayBuilderChar(MyStringBuilder& current,
     }
 
     int position = getInt("Enter a position", out, in,
-                          0, current.length());
+                          0, current.length() - 1);
 
     displayDataMessage(
             "'" + string{current.charAt(position)}
@@ -673,7 +691,8 @@ void replaceBuilder(StringBuilders& values,
     int mode = getInt("0 to replace with string, 1 to replace with existing StringBuilder",
                       out, in, 0, 1, 0);
 
-    MyStringBuilder *to_replace;
+    MyStringBuilder typed("");
+    MyStringBuilder *to_replace = &typed;
 
     if (mode) {
         /* Get string */
@@ -685,7 +704,7 @@ void replaceBuilder(StringBuilders& values,
         }
     } else {
         /* Use existing */
-        to_replace = new MyStringBuilder(get("Enter a string", out, in));
+        typed = MyStringBuilder(get("Enter a string", out, in));
     }
 
     int begin = getInt("Enter the begin index", out, in,
@@ -714,6 +733,54 @@ void displayStringBuilder(const MyStringBuilder& current,
     displayDataMessage(current.toString(), out);
 }
 
+/*
+ * Pre-Conditions:
+ *      const reference to StringBuilders.
+ *      ostream reference (optional), default is cout.
+ *      istream reference (optional), default is cin.
+ *
+ * Post-Conditions:
+ *      Displays each occurrence of the keywords, with the identifier
+ *      of its StringBuilder & its position.
+ *
+ * Performs all the necessary input & output to search all the
+ * StringBuilders for a list of keywords.
+ */
+void searchKeywords(const StringBuilders& values,
+                    ostream& out = cout, istream& in = cin) {
+    istringstream line(get("Enter the keywords, separated by spaces",
+                           out, in));
+    vector<string> keywords;
+    string keyword;
+
+    while (line >> keyword) {
+        keywords.push_back(keyword);
+    }
+
+    if (keywords.empty()) {
+        displayInvalidMessage("No keywords given!", out);
+        return;
+    }
+
+    int parallel = getInt("0 to search on one thread, 1 to use all cores",
+                          out, in, 0, 1, 1);
+
+    const PatternMatcher matcher(keywords);
+    const auto matches = matcher.scanAll(values, parallel);
+
+    for (const auto& match: matches) {
+        displayDataMessage(
+                "'" + keywords[match.pattern] + "' in "
+                + match.builder + " at position "
+                + to_string(match.offset),
+                out
+        );
+    }
+
+    displayDataMessage(to_string(matches.size()) + " occurrences found.",
+                       out);
+}
+
 /*
  * Pre-Conditions:
  *      No preconditions.
@@ -770,12 +837,15 @@ int main() {
                 displayStringBuilder(*currentBuilder);
                 break;
             case 12:
+                searchKeywords(string_builders);
+                break;
+            case 13:
                 break;
             default:
                 displayInvalidMessage("Invalid Option!");
                 break;
         }
-    } while (userChoice != 12);
+    } while (userChoice != 13);
 
     displaySeparator();
     return 0;
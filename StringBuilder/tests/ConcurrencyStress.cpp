@@ -0,0 +1,535 @@
+/*
+ * StringBuilder Project
+ *
+ *
+ * ConcurrencyStress.cpp
+ *
+ * Date:        17/10/2026
+ *
+ * Author:      Mahmoud Yaman Seraj Alddin
+ *
+ * Purpose:     Drives the thread-safe classes from many threads at once &
+ *              checks their results, meant to run under ThreadSanitizer or
+ *              AddressSanitizer (see MYSTRINGBUILDER_SANITIZER).
+ *              Usage: stress_concurrency [rounds]
+ *
+ * List of global Functions:
+ *      int main(int, char**)
+ *          Runs every stress & exits with 1 on a failure.
+ *
+ * List of local Functions:
+ *      void check(bool, const char*)
+ *          Reports a failure & exits, if the condition is false.
+ *
+ *      void stressPatternMatcher(int)
+ *          Compares the parallel & serial scans of a registry.
+ *
+ *      void stressConcurrentBuilder(int)
+ *          Appends numbered records from many threads into
+ *          ConcurrentBuilders, then checks every record arrived in order.
+ *
+ *      void stressLogBuilder(int)
+ *          Appends numbered records from many producers while a consumer
+ *          drains, then checks the drained file.
+ *
+ *      void stressSharedBuilder(int)
+ *          Reads a SharedBuilder from many threads while it is edited,
+ *          checking no read mixes two versions.
+ *
+ *      void stressParallelExecutor(int)
+ *          Compares the ParallelExecutor with std::string, for several
+ *          thread counts, serial lengths & storage modes.
+ *
+ *      void stressConstReads(int)
+ *          Reads an edited MyStringBuilder of every storage mode from
+ *          many threads at once, comparing with std::string.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ConcurrentBuilder.h"
+#include "LogBuilder.h"
+#include "MyStringBuilder.h"
+#include "ParallelExecutor.h"
+#include "PatternMatcher.h"
+#include "SharedBuilder.h"
+
+using namespace std;
+
+typedef MyStringBuilder::Mode Mode;
+
+/* Storage modes stressed, in order */
+static const Mode kModes[] = {
+        Mode::kRope, Mode::kChain, Mode::kGapBuffer, Mode::kPieceTable,
+};
+
+/* Number of threads writing or reading at once */
+static const int kThreads = 6;
+
+/*
+ * Pre-Conditions:
+ *      bool of the checked condition.
+ *      C string describing the check.
+ *
+ * Post-Conditions:
+ *      The process exits with 1 if the condition is false.
+ *
+ * Reports a failure & exits, if the condition is false.
+ */
+static void check(bool condition, const char *description) {
+    if (not condition) {
+        cerr << "Failed: " << description << endl;
+        exit(1);
+    }
+}
+
+/*
+ * Pre-Conditions:
+ *      int of the number of rounds, at least 1.
+ *
+ * Post-Conditions:
+ *      The parallel scan of a registry of every storage mode returns
+ *      the matches of the serial scan.
+ *
+ * Compares the parallel & serial scans of a registry.
+ */
+static void stressPatternMatcher(int rounds) {
+    mt19937 generator(11);
+    const PatternMatcher matcher({"ab", "abc", "ca", "", "b", "ab", "cab"});
+
+    for (int round = 0; round < 5 * rounds; round++) {
+        PatternMatcher::Builders builders;
+
+        for (int i = 0; i < 2 * kThreads; i++) {
+            string text;
+
+            for (int k = (int) (generator() % 20000); 0 < k; k--) {
+                text += (char) ('a' + generator() % 3);
+            }
+
+            builders.emplace(to_string(i), MyStringBuilder(text, kModes[i % 4]));
+        }
+
+        const auto serial = matcher.scanAll(builders);
+        const auto parallel = matcher.scanAll(builders, true);
+
+        check(serial.size() == parallel.size() and
+              equal(serial.begin(), serial.end(), parallel.begin(),
+                    [](const PatternMatcher::BuilderMatch& a,
+                       const PatternMatcher::BuilderMatch& b) {
+                        return a.builder == b.builder and
+                               a.offset == b.offset and a.pattern == b.pattern;
+                    }), "PatternMatcher::scanAll in parallel");
+    }
+}
+
+/*
+ * Pre-Conditions:
+ *      int of the number of rounds, at least 1.
+ *
+ * Post-Conditions:
+ *      The records of each thread are found in the merged characters,
+ *      each exactly once & in the order the thread appended them.
+ *
+ * Every round appends concurrently, then merges while no thread appends.
+ * Appends numbered records from many threads into
+ * ConcurrentBuilders, then checks every record arrived in order.
+ */
+static void stressConcurrentBuilder(int rounds) {
+    const int appends = 3000;
+
+    for (auto order: {ConcurrentBuilder::Order::kPerThread,
+                      ConcurrentBuilder::Order::kTicket}) {
+        ConcurrentBuilder builder(order);
+
+        for (int round = 0; round < rounds; round++) {
+            vector<thread> workers;
+
+            for (int t = 0; t < kThreads; t++) {
+                workers.emplace_back([&, t]() {
+                    for (int i = 0; i < appends; i++) {
+                        builder.append("<" + to_string(t) + ":" +
+                                       to_string(round * appends + i) + ">");
+                    }
+                });
+            }
+
+            for (auto& worker: workers) {
+                worker.join();
+            }
+
+            /* Merging between the rounds, the later appends follow */
+            (void) builder.flatten();
+        }
+
+        const string merged = builder.toString();
+        vector<int> next(kThreads, 0);
+        size_t position = 0;
+        int records = 0;
+
+        while ((position = merged.find('<', position)) != string::npos) {
+            int t = -1;
+            int i = -1;
+
+            check(sscanf(merged.c_str() + position, "<%d:%d>", &t, &i) == 2 and
+                  0 <= t and t < kThreads and next[t] == i,
+                  "ConcurrentBuilder keeps the records of a thread in order");
+
+            next[t]++;
+            records++;
+            position++;
+        }
+
+        check(records == kThreads * appends * rounds,
+              "ConcurrentBuilder keeps every record");
+    }
+}
+
+/*
+ * Pre-Conditions:
+ *      int of the number of rounds, at least 1.
+ *
+ * Post-Conditions:
+ *      The drained records are whole, each producer's in order, & as many
+ *      as the appends accepted; none is dropped when blocking.
+ *
+ * Appends numbered records from many producers while a consumer
+ * drains, then checks the drained file.
+ */
+static void stressLogBuilder(int rounds) {
+    const int appends = 2000 * rounds;
+
+    for (auto overflow: {LogBuilder::Overflow::kBlock,
+                         LogBuilder::Overflow::kDrop}) {
+        for (int capacity: {64, 4096}) {
+            LogBuilder log(3, capacity, overflow);
+            FILE *file = tmpfile();
+            atomic<bool> done(false);
+            atomic<long long> accepted(0);
+            vector<thread> producers;
+
+            check(file != nullptr, "A temporary file is created");
+
+            thread consumer([&]() {
+                while (not done.load()) {
+                    log.drain(fileno(file));
+                    this_thread::yield();
+                }
+
+                log.flush(fileno(file));
+            });
+
+            for (int t = 0; t < kThreads; t++) {
+                producers.emplace_back([&, t]() {
+                    for (int i = 0; i < appends; i++) {
+                        const string record = "[" + to_string(t) + " " +
+                                              to_string(i) + string(i % 13, '.') +
+                                              "]\n";
+
+                        /* Alternates the two append overloads */
+                        if (i % 5 == 0 ? log.append(MyStringBuilder(record))
+                                       : log.append(record)) {
+                            accepted++;
+                        }
+                    }
+                });
+            }
+
+            for (auto& producer: producers) {
+                producer.join();
+            }
+
+            done = true;
+            consumer.join();
+            rewind(file);
+
+            vector<int> last(kThreads, -1);
+            long long records = 0;
+            char line[64];
+
+            while (fgets(line, sizeof(line), file) != nullptr) {
+                int t = -1;
+                int i = -1;
+                const string record = line;
+
+                check(sscanf(line, "[%d %d", &t, &i) == 2 and
+                      0 <= t and t < kThreads and last[t] < i and
+                      record == "[" + to_string(t) + " " + to_string(i) +
+                                string(i % 13, '.') + "]\n",
+                      "LogBuilder drains whole records, in order");
+
+                last[t] = i;
+                records++;
+            }
+
+            fclose(file);
+
+            check(records == accepted.load(),
+                  "LogBuilder drains every accepted record");
+            check(records + log.droppedCount() == (long long) kThreads * appends,
+                  "LogBuilder accepts or drops each record");
+            check(overflow == LogBuilder::Overflow::kDrop or
+                  log.droppedCount() == 0, "LogBuilder blocks instead of dropping");
+        }
+    }
+}
+
+/*
+ * Pre-Conditions:
+ *      int of the number of rounds, at least 1.
+ *
+ * Post-Conditions:
+ *      Every version read, whole or as a snapshot, holds a single
+ *      repeated character, as every version written does.
+ *
+ * A reader mixing two versions would see two different characters.
+ * Reads a SharedBuilder from many threads while it is edited,
+ * checking no read mixes two versions.
+ */
+static void stressSharedBuilder(int rounds) {
+    SharedBuilder builder(string(1000, 'a'));
+    atomic<bool> done(false);
+    vector<thread> readers;
+
+    for (int t = 0; t < kThreads - 2; t++) {
+        readers.emplace_back([&]() {
+            while (not done.load()) {
+                const string version = builder.toString();
+
+                check(count(version.begin(), version.end(), version[0]) ==
+                      (long) version.size(), "SharedBuilder reads one version");
+
+                const MyStringBuilder snapshot = builder.snapshot();
+                const char first = snapshot.length() ? snapshot.charAt(0) : 0;
+
+                for (char c: snapshot) {
+                    check(c == first, "SharedBuilder snapshots one version");
+                }
+
+                /* The version may change between length & the read */
+                try {
+                    (void) builder.substring(0, 1);
+                    (void) builder.charAt(builder.length() - 1);
+                } catch (const invalid_argument&) {
+                }
+            }
+        });
+    }
+
+    for (int i = 0; i < 1000 * rounds; i++) {
+        const char c = (char) ('a' + i % 26);
+
+        builder.replace(0, builder.length(), string(500 + i * 37 % 1500, c));
+
+        for (int k = 0; k < 20; k++) {
+            builder.insert(k * 7 % builder.length(), string(1, c));
+            builder.insert(builder.length() / 2, string(3, c));
+        }
+
+        if (i % 7 == 0) {
+            builder.clear(0, builder.length());
+            builder.append(string(800, c));
+        }
+    }
+
+    done = true;
+
+    for (auto& reader: readers) {
+        reader.join();
+    }
+}
+
+/*
+ * Pre-Conditions:
+ *      int of the number of rounds, at least 1.
+ *
+ * Post-Conditions:
+ *      Every result of the ParallelExecutor equals the one computed on a
+ *      std::string, & copies sharing the characters are unaffected.
+ *
+ * Compares the ParallelExecutor with std::string, for several
+ * thread counts, serial lengths & storage modes.
+ */
+static void stressParallelExecutor(int rounds) {
+    mt19937 generator(7);
+
+    for (int threads: {1, 3, 4, 7}) {
+        for (int serialLength: {1, 64, 1 << 20}) {
+            ParallelExecutor executor(threads, serialLength);
+
+            for (int round = 0; round < 10 * rounds; round++) {
+                string text;
+
+                for (int i = (int) (generator() % 5000); 0 < i; i--) {
+                    text += "abcAB xyz"[generator() % 9];
+                }
+
+                for (Mode mode: kModes) {
+                    MyStringBuilder builder(text, mode);
+                    string reference = text;
+
+                    /* Splits the storage into several chunks */
+                    for (int k = 0; k < 10 and 2 < reference.size(); k++) {
+                        const int position = (int) (generator() % reference.size());
+                        const string inserted(generator() % 50, 'q');
+
+                        builder.insert(position, string_view(inserted));
+                        reference.insert(position, inserted);
+                    }
+
+                    const MyStringBuilder copy = builder;
+                    const string edited = reference;
+                    unsigned long long hash = 0;
+
+                    for (unsigned char c: reference) {
+                        hash = hash * ParallelExecutor::kHashBase + c;
+                    }
+
+                    check(executor.toString(builder) == reference,
+                          "ParallelExecutor::toString");
+                    check(executor.count(builder, 'a') ==
+                          count(reference.begin(), reference.end(), 'a'),
+                          "ParallelExecutor::count");
+                    check(executor.hash(builder) == hash,
+                          "ParallelExecutor::hash");
+
+                    for (int q = 0; q < 5; q++) {
+                        const string target = reference.substr(
+                                generator() % (reference.size() + 1),
+                                generator() % 6);
+
+                        const size_t found = reference.find(target);
+
+                        check(executor.indexOf(builder, target) ==
+                              (found == string::npos ? -1 : (int) found),
+                              "ParallelExecutor::indexOf");
+                    }
+
+                    executor.toUpperCase(builder);
+
+                    for (char& c: reference) {
+                        c = (char) toupper(c);
+                    }
+
+                    check(builder.toString() == reference,
+                          "ParallelExecutor::toUpperCase");
+                    check(copy.toString() == edited,
+                          "ParallelExecutor leaves the copies unchanged");
+
+                    executor.swapCase(builder);
+
+                    for (char& c: reference) {
+                        c = (char) tolower(c);
+                    }
+
+                    check(builder.toString() == reference,
+                          "ParallelExecutor::swapCase");
+                }
+            }
+        }
+    }
+}
+
+/*
+ * Pre-Conditions:
+ *      int of the number of rounds, at least 1.
+ *
+ * Post-Conditions:
+ *      Every concurrent read of a MyStringBuilder returns the characters
+ *      of the std::string edited alike.
+ *
+ * The MyStringBuilders are edited at random positions first,
+ * so their const functions search many Nodes & pieces.
+ * Reads an edited MyStringBuilder of every storage mode from
+ * many threads at once, comparing with std::string.
+ */
+static void stressConstReads(int rounds) {
+    mt19937 generator(17);
+
+    for (int round = 0; round < rounds; round++) {
+        for (Mode mode: kModes) {
+            MyStringBuilder builder("", mode);
+            string expected;
+
+            for (int i = 0; i < 4000; i++) {
+                const int position = (int) (generator() % (expected.size() + 1));
+                const string text(1 + generator() % 40, (char) ('a' + generator() % 3));
+
+                builder.insert(position, text);
+                expected.insert(position, text);
+            }
+
+            const MyStringBuilder& reader = builder;
+            const int size = (int) expected.size();
+            atomic<bool> failed{false};
+            vector<thread> threads;
+
+            for (int t = 0; t < kThreads; t++) {
+                threads.emplace_back([&, t]() {
+                    mt19937 local(t);
+
+                    for (int k = 0; k < 2000 and not failed; k++) {
+                        const int begin = (int) (local() % size);
+                        const int end = begin + (int) (local() % min(64, size - begin + 1));
+
+                        if (reader.charAt(begin) != expected[begin] or
+                            reader.toString(begin, end) != expected.substr(begin, end - begin) or
+                            reader.indexOf("ab", begin) != (int) expected.find("ab", begin)) {
+                            failed = true;
+                        }
+                    }
+                });
+            }
+
+            for (thread& thread: threads) {
+                thread.join();
+            }
+
+            check(not failed and reader.toString() == expected,
+                  "MyStringBuilder const functions from many threads");
+        }
+    }
+}
+
+/*
+ * Pre-Conditions:
+ *      Optional number of rounds, default is 3.
+ *
+ * Post-Conditions:
+ *      0 is returned if every stress passed,
+ *      the process exits with 1 otherwise.
+ *
+ * Runs every stress & exits with 1 on a failure.
+ */
+int main(int argc, char **argv) {
+    const int rounds = max(1, 1 < argc ? atoi(argv[1]) : 3);
+
+    stressPatternMatcher(rounds);
+    cout << "PatternMatcher passed" << endl;
+
+    stressConcurrentBuilder(rounds);
+    cout << "ConcurrentBuilder passed" << endl;
+
+    stressLogBuilder(rounds);
+    cout << "LogBuilder passed" << endl;
+
+    stressSharedBuilder(rounds);
+    cout << "SharedBuilder passed" << endl;
+
+    stressParallelExecutor(rounds);
+    cout << "ParallelExecutor passed" << endl;
+
+    stressConstReads(rounds);
+    cout << "MyStringBuilder const functions passed" << endl;
+
+    return 0;
+}
@@ -0,0 +1,901 @@
+/*
+ * StringBuilder Project
+ *
+ *
+ * DifferentialFuzzer.cpp
+ *
+ * Date:        17/10/2026
+ *
+ * Author:      Mahmoud Yaman Seraj Alddin
+ *
+ * Purpose:     Applies the same random operations to a MyStringBuilder of
+ *              each storage mode & to a std::string, & stops at the first
+ *              difference.
+ *              Usage: fuzz_stringbuilder [operations per mode] [seed]
+ *
+ * List of global Functions:
+ *      int main(int, char**)
+ *          Fuzzes every storage mode & exits with 1 on a difference.
+ *
+ * List of local Functions:
+ *      int pick(int, int)
+ *          Returns a random int between the given bounds, inclusive.
+ *
+ *      std::string randomText(int)
+ *          Returns a random string over a small alphabet.
+ *
+ *      Mode randomMode()
+ *          Returns one of the fuzzed storage modes.
+ *
+ *      void fail(Mode, int, const char*)
+ *          Reports a difference & exits.
+ *
+ *      void replaceReference(std::string&, const std::string&,
+ *                            const std::string&, int)
+ *          Replaces the first occurrences of a string in the reference.
+ *
+ *      bool <operation>(State&)
+ *          The operations of kOperations, see Operation.
+ */
+
+#include <algorithm>
+#include <cctype>
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "EditBatch.h"
+#include "MyStringBuilder.h"
+#include "Node.h"
+#include "PatternMatcher.h"
+
+using namespace std;
+
+typedef MyStringBuilder::Mode Mode;
+
+/* Substrings taken earlier, with the characters they must keep */
+typedef vector<pair<string, MyStringBuilder>> Kept;
+
+/* Builder fuzzed & the std::string it must equal */
+struct State {
+    MyStringBuilder builder;
+    string reference;
+    Kept kept = {};
+};
+
+/*
+ * Random operation applied to the builder & the reference of a State,
+ * both equal before.
+ * apply returns false if a query of the builder differed from the one
+ * of the reference, the builder & the reference are compared after.
+ */
+struct Operation {
+    const char *name;
+    bool (*apply)(State&);
+};
+
+/* Storage modes fuzzed, in order */
+static const Mode kModes[] = {
+        Mode::kRope,
+        Mode::kChain,
+        Mode::kGapBuffer,
+        Mode::kPieceTable,
+};
+
+/* Reference length above which the front is cleared, keeps runs fast */
+static const int kMaxLength = 200000;
+
+/* Substrings checked after every operation */
+static const int kMaxKept = 5;
+
+/* Source of the random operations, seeded by main */
+static mt19937 generator;
+
+/* File saved & mapped by saveAndMap, next to the temporary files */
+static string scratchPath;
+
+/*
+ * Pre-Conditions:
+ *      low <= high.
+ *
+ * Post-Conditions:
+ *      An int in [low, high] is returned.
+ *
+ * Returns a random int between the given bounds, inclusive.
+ */
+static int pick(int low, int high) {
+    return uniform_int_distribution<int>(low, high)(generator);
+}
+
+/*
+ * Pre-Conditions:
+ *      int of the length, at least 0.
+ *
+ * Post-Conditions:
+ *      A string of the given length over "abcd" is returned.
+ *
+ * The small alphabet makes the searches & replacements match often.
+ * Returns a random string over a small alphabet.
+ */
+static string randomText(int length) {
+    string result;
+
+    for (int i = 0; i < length; i++) {
+        result += (char) ('a' + pick(0, 3));
+    }
+
+    return result;
+}
+
+/*
+ * Pre-Conditions:
+ *      No preconditions.
+ *
+ * Post-Conditions:
+ *      One of kModes is returned.
+ *
+ * Returns one of the fuzzed storage modes.
+ */
+static Mode randomMode() {
+    return kModes[pick(0, (int) size(kModes) - 1)];
+}
+
+/*
+ * Pre-Conditions:
+ *      Mode of the builder, index & name of the failing operation.
+ *
+ * Post-Conditions:
+ *      The difference is printed, the process exits with 1.
+ *
+ * Reports a difference & exits.
+ */
+[[noreturn]] static void fail(Mode mode, int index, const char *operation) {
+    cerr << "Mode " << (int) mode << " differs from std::string after "
+         << "operation " << index << " (" << operation << ")" << endl;
+    exit(1);
+}
+
+/*
+ * Pre-Conditions:
+ *      Reference to the reference string.
+ *      const references to the target & the replacement.
+ *      int of the maximum number of replacements.
+ *
+ * Post-Conditions:
+ *      Up to count occurrences of target are replaced, left to right,
+ *      like replaceFirst. An empty target matches before every character
+ *      & at the end.
+ *
+ * Replaces the first occurrences of a string in the reference.
+ */
+static void replaceReference(string& reference, const string& target,
+                             const string& replacement, int count) {
+    string result;
+    size_t position = 0;
+
+    if (target.empty()) {
+        for (; position <= reference.size() and 0 < count; count--) {
+            result += replacement;
+
+            if (position < reference.size()) {
+                result += reference[position];
+            }
+
+            position++;
+        }
+    } else {
+        for (; 0 < count; count--) {
+            const size_t found = reference.find(target, position);
+
+            if (found == string::npos) {
+                break;
+            }
+
+            result.append(reference, position, found - position);
+            result += replacement;
+            position = found + target.size();
+        }
+    }
+
+    if (position < reference.size()) {
+        result.append(reference, position);
+    }
+
+    reference = result;
+}
+
+/* Inserts a builder of another mode at a random position */
+static bool insertBuilder(State& state) {
+    const int position = pick(0, (int) state.reference.size());
+    const string text = randomText(pick(0, 700));
+
+    state.builder.insert(position, MyStringBuilder(text, randomMode()));
+    state.reference.insert(position, text);
+
+    return true;
+}
+
+/* Appends a builder of another mode */
+static bool appendBuilder(State& state) {
+    const string text = randomText(pick(0, 300));
+
+    state.builder.append(MyStringBuilder(text, randomMode()));
+    state.reference += text;
+
+    return true;
+}
+
+/* Appends the decimal form of an int */
+static bool appendInt(State& state) {
+    const int value = pick(INT_MIN, INT_MAX);
+
+    state.builder.append(value);
+    state.reference += to_string(value);
+
+    return true;
+}
+
+/* Clears a random range of up to 600 characters */
+static bool clearRange(State& state) {
+    const int begin = pick(0, (int) state.reference.size());
+    const int end = pick(begin, min((int) state.reference.size(), begin + 600));
+
+    state.builder.clear(begin, end);
+    state.reference.erase(begin, end - begin);
+
+    return true;
+}
+
+/* Replaces a random range by a builder of another mode */
+static bool replaceBuilder(State& state) {
+    const int begin = pick(0, (int) state.reference.size());
+    const int end = pick(begin, min((int) state.reference.size(), begin + 300));
+    const string text = randomText(pick(0, 300));
+
+    state.builder.replace(begin, end, MyStringBuilder(text, randomMode()));
+
+    /* Like Java, an empty range replaces nothing */
+    if (begin != end) {
+        state.reference.replace(begin, end - begin, text);
+    }
+
+    return true;
+}
+
+/* Takes the substring of a random range */
+static bool takeSubstring(State& state) {
+    const int begin = pick(0, (int) state.reference.size());
+    const int end = pick(begin, (int) state.reference.size());
+    const MyStringBuilder part = state.builder.substring(begin, end);
+    const string text = state.reference.substr(begin, end - begin);
+
+    if (part.toString() != text) {
+        return false;
+    }
+
+    /* The substring must keep its characters through the later edits */
+    state.kept.emplace_back(text, part);
+
+    if (kMaxKept < (int) state.kept.size()) {
+        state.kept.erase(state.kept.begin());
+    }
+
+    return true;
+}
+
+/* Reads the character at a random index */
+static bool readCharAt(State& state) {
+    if (state.reference.empty()) {
+        return true;
+    }
+
+    const int index = pick(0, (int) state.reference.size() - 1);
+
+    return state.builder.charAt(index) == state.reference[index];
+}
+
+/* Converts the characters to upper case */
+static bool upperCase(State& state) {
+    state.builder.toUpperCase();
+
+    for (char& c: state.reference) {
+        c = (char) toupper(c);
+    }
+
+    return true;
+}
+
+/*
+ * Inserts a whole number of Node blocks, give or take one character,
+ * then reads the characters around both ends of the insertion.
+ */
+static bool insertBlocks(State& state) {
+    const int position = pick(0, (int) state.reference.size());
+    const string text = randomText(pick(1, 8) * Node::kCapacity + pick(-1, 1));
+
+    state.builder.insert(position, MyStringBuilder(text, randomMode()));
+    state.reference.insert(position, text);
+
+    for (int edge: {position, position + (int) text.size()}) {
+        for (int index = max(0, edge - 2);
+             index < min((int) state.reference.size(), edge + 2); index++) {
+            if (state.builder.charAt(index) != state.reference[index]) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+/* Edits around a cursor, moving it a few characters at a time */
+static bool editNearCursor(State& state) {
+    int cursor = pick(0, (int) state.reference.size());
+
+    for (int i = 0; i < 16; i++) {
+        const int length = (int) state.reference.size();
+
+        cursor = max(0, min(length, cursor + pick(-8, 8)));
+
+        if (pick(0, 2) == 0) {
+            const int end = min(length, cursor + pick(0, 4));
+
+            state.builder.clear(cursor, end);
+            state.reference.erase(cursor, end - cursor);
+        } else {
+            const string text = randomText(pick(1, 6));
+
+            state.builder.insert(cursor, MyStringBuilder(text));
+            state.reference.insert(cursor, text);
+            cursor += (int) text.size();
+        }
+    }
+
+    return true;
+}
+
+/* Inserts single characters at scattered positions, splitting the pieces */
+static bool scatterInserts(State& state) {
+    for (int i = 0; i < 20; i++) {
+        const int position = pick(0, (int) state.reference.size());
+        const string text = randomText(1);
+
+        state.builder.insert(position, MyStringBuilder(text));
+        state.reference.insert(position, text);
+    }
+
+    return true;
+}
+
+/* Checks the arena counters of a chain builder, & that others have none */
+static bool checkArena(State& state) {
+    if (state.builder.getMode() != Mode::kChain) {
+        try {
+            (void) state.builder.arenaCounters();
+        } catch (const logic_error&) {
+            return true;
+        }
+
+        return false;
+    }
+
+    const NodeArena::Counters counters = state.builder.arenaCounters();
+
+    return 0 <= counters.reused and counters.reused <= counters.released and
+           counters.released <= counters.nodes and
+           (counters.nodes == 0 or 0 < counters.pages);
+}
+
+/* Appends many short builders one after the other */
+static bool appendFragments(State& state) {
+    for (int i = pick(1, 64); 0 < i; i--) {
+        const string text = randomText(pick(0, 12));
+
+        state.builder.append(MyStringBuilder(text));
+        state.reference += text;
+    }
+
+    return true;
+}
+
+/* Inserts a builder moved in, which must be left empty & usable */
+static bool insertMoved(State& state) {
+    MyStringBuilder other(randomText(pick(0, 400)), randomMode());
+    const string text = other.toString();
+    const int position = pick(0, (int) state.reference.size());
+
+    state.builder.insert(position, std::move(other));
+    state.reference.insert(position, text);
+
+    return other.length() == 0 and
+           other.append(MyStringBuilder("q")).toString() == "q";
+}
+
+/* Appends a builder moved in */
+static bool appendMoved(State& state) {
+    MyStringBuilder other(randomText(pick(0, 300)), randomMode());
+
+    state.reference += other.toString();
+    state.builder.append(std::move(other));
+
+    return true;
+}
+
+/* Moves the builder through a growing vector & back */
+static bool moveThroughVector(State& state) {
+    vector<MyStringBuilder> builders;
+
+    builders.push_back(std::move(state.builder));
+
+    for (int i = 0; i < 8; i++) {
+        builders.emplace_back(randomText(pick(0, 20)), randomMode());
+    }
+
+    state.builder = std::move(builders.front());
+
+    return builders.front().length() == 0;
+}
+
+/* Inserts the builder into itself */
+static bool insertItself(State& state) {
+    if (state.reference.size() < 5000) {
+        const int position = pick(0, (int) state.reference.size());
+
+        state.reference.insert(position, state.reference);
+        state.builder.insert(position, state.builder);
+    }
+
+    return true;
+}
+
+/* Appends the builder to itself */
+static bool appendItself(State& state) {
+    if (state.reference.size() < 5000) {
+        state.reference += state.reference;
+        state.builder.append(state.builder);
+    }
+
+    return true;
+}
+
+/* Edits a copy, which must not change the original, then keeps it */
+static bool copyThenEdit(State& state) {
+    MyStringBuilder copy = state.builder;
+
+    copy.append(MyStringBuilder("zz"));
+
+    if (state.builder.toString() != state.reference) {
+        return false;
+    }
+
+    state.builder = copy;
+    state.reference += "zz";
+
+    return true;
+}
+
+/* Reads the characters at many random indices */
+static bool readCharAts(State& state) {
+    for (int i = 0; i < 64 and not state.reference.empty(); i++) {
+        const int index = pick(0, (int) state.reference.size() - 1);
+
+        if (state.builder.charAt(index) != state.reference[index]) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/* Reads all the characters through the iterators */
+static bool iterate(State& state) {
+    return string(state.builder.begin(), state.builder.end()) ==
+           state.reference and
+           count(state.builder.begin(), state.builder.end(), 'a') ==
+           count(state.reference.begin(), state.reference.end(), 'a');
+}
+
+/* Reads a run of characters by increasing index, following the finger */
+static bool readRun(State& state) {
+    const int begin = pick(0, (int) state.reference.size());
+    const int end = min((int) state.reference.size(), begin + pick(0, 300));
+
+    for (int index = begin; index < end; index++) {
+        if (state.builder.charAt(index) != state.reference[index]) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/* Converts the characters to lower case */
+static bool lowerCase(State& state) {
+    state.builder.toLowerCase();
+
+    for (char& c: state.reference) {
+        c = (char) tolower(c);
+    }
+
+    return true;
+}
+
+/* Swaps the case of the characters */
+static bool swapCase(State& state) {
+    state.builder.swapCase();
+
+    for (char& c: state.reference) {
+        c = (char) (islower(c) ? toupper(c) : tolower(c));
+    }
+
+    return true;
+}
+
+/* Maps the characters through a table rotating "abcd" */
+static bool transformTable(State& state) {
+    ByteTable table = identityTable();
+
+    for (char c = 'a'; c <= 'd'; c++) {
+        table[(unsigned char) c] = (char) ('a' + (c - 'a' + 1) % 4);
+    }
+
+    state.builder.transform(table);
+
+    for (char& c: state.reference) {
+        c = table[(unsigned char) c];
+    }
+
+    return true;
+}
+
+/* Streams the builder to an ostream */
+static bool streamOut(State& state) {
+    ostringstream stream;
+
+    stream << state.builder;
+
+    return stream.str() == state.reference;
+}
+
+/* Finds a random target from a random index */
+static bool findForward(State& state) {
+    const int length = (int) state.reference.size();
+    const string target = randomText(pick(0, 5));
+    const int from = pick(-3, length + 3);
+    const size_t found = state.reference.find(target, min(max(from, 0), length));
+
+    return state.builder.indexOf(target, from) ==
+           (found == string::npos ? -1 : (int) found);
+}
+
+/* Finds a random target backwards, from the end & from a random index */
+static bool findBackward(State& state) {
+    const int length = (int) state.reference.size();
+    const string target = randomText(pick(0, 5));
+    const int from = pick(-3, length + 3);
+    const size_t found = state.reference.rfind(target, max(from, 0));
+    const size_t last = state.reference.rfind(target);
+
+    return state.builder.lastIndexOf(target, from) ==
+           (from < 0 or found == string::npos ? -1 : (int) found) and
+           state.builder.lastIndexOf(target) ==
+           (last == string::npos ? -1 : (int) last);
+}
+
+/* Tests a random target against the ends & the whole of the builder */
+static bool matchEnds(State& state) {
+    const string& reference = state.reference;
+    const string target = randomText(pick(0, 4));
+    const bool fits = target.size() <= reference.size();
+
+    return state.builder.startsWith(target) ==
+           (fits and reference.compare(0, target.size(), target) == 0) and
+           state.builder.endsWith(target) ==
+           (fits and reference.compare(reference.size() - target.size(),
+                                       target.size(), target) == 0) and
+           state.builder.contains(target) ==
+           (reference.find(target) != string::npos);
+}
+
+/* Scans for a small dictionary, compared with a search per pattern */
+static bool scanPatterns(State& state) {
+    const vector<string> patterns = {"ab", "abc", "ca", "", "b", "ab", "dd"};
+    const auto matches = PatternMatcher(patterns).scan(state.builder);
+    vector<pair<int, int>> found;
+    vector<pair<int, int>> expected;
+
+    for (const auto& match: matches) {
+        found.emplace_back(match.offset, match.pattern);
+    }
+
+    /* Empty patterns never match */
+    for (int p = 0; p < (int) patterns.size(); p++) {
+        for (size_t offset = state.reference.find(patterns[p]);
+             not patterns[p].empty() and offset != string::npos;
+             offset = state.reference.find(patterns[p], offset + 1)) {
+            expected.emplace_back((int) offset, p);
+        }
+    }
+
+    sort(found.begin(), found.end());
+    sort(expected.begin(), expected.end());
+
+    return found == expected;
+}
+
+/* Replaces all or the first occurrences of a random target */
+static bool replaceMatches(State& state) {
+    const string target = randomText(pick(0, 3));
+    const string replacement = randomText(pick(0, 4));
+
+    /* An empty target doubles the length, kept for short ones */
+    if (target.empty() and 3000 < state.reference.size()) {
+        return true;
+    }
+
+    if (pick(0, 1)) {
+        state.builder.replaceAll(target, replacement);
+        replaceReference(state.reference, target, replacement, INT_MAX);
+    } else {
+        const int count = pick(0, 3);
+
+        state.builder.replaceFirst(target, replacement, count);
+        replaceReference(state.reference, target, replacement, count);
+    }
+
+    return true;
+}
+
+/*
+ * Applies up to 20 disjoint edits in one EditBatch, added in a shuffled
+ * order, & applies them back to front to the reference.
+ */
+static bool applyBatch(State& state) {
+    const int length = (int) state.reference.size();
+    vector<tuple<int, int, string>> edits;
+
+    for (int position = 0; position < length and edits.size() < 20;) {
+        const int begin = pick(position, min(length, position + 200));
+        const int end = pick(begin, min(length, begin + pick(0, 50)));
+
+        edits.emplace_back(begin, end, pick(0, 1) ? randomText(pick(0, 10)) : "");
+        position = end + pick(1, 30);
+    }
+
+    vector<tuple<int, int, string>> shuffled = edits;
+    EditBatch batch;
+
+    shuffle(shuffled.begin(), shuffled.end(), generator);
+
+    for (const auto& [begin, end, text]: shuffled) {
+        if (begin == end) {
+            batch.insert(begin, text);
+        } else if (text.empty() and pick(0, 1)) {
+            batch.clear(begin, end);
+        } else {
+            batch.replace(begin, end, text);
+        }
+    }
+
+    state.builder.apply(batch);
+
+    for (auto edit = edits.rbegin(); edit != edits.rend(); ++edit) {
+        const auto& [begin, end, text] = *edit;
+
+        state.reference.replace(begin, end - begin, text);
+    }
+
+    return true;
+}
+
+/* Appends a value of each appendable type */
+static bool appendValues(State& state) {
+    state.builder.append(1.5).append(-0.25f).append('x').append(true)
+            .append((const char*) nullptr).append("text")
+            .append(18446744073709551615ULL).append(-9223372036854775807LL)
+            .append(4294967295U).append(string_view("view"));
+    state.reference += "1.5-0.25xtruenulltext18446744073709551615"
+                       "-92233720368547758074294967295view";
+
+    return true;
+}
+
+/* Inserts a string_view at a random position */
+static bool insertView(State& state) {
+    const int position = pick(0, (int) state.reference.size());
+    const string text = randomText(pick(0, 300));
+
+    state.builder.insert(position, string_view(text));
+    state.reference.insert(position, text);
+
+    return true;
+}
+
+/* Replaces a random range by a string_view */
+static bool replaceView(State& state) {
+    const int begin = pick(0, (int) state.reference.size());
+    const int end = pick(begin, (int) state.reference.size());
+    const string text = randomText(pick(0, 30));
+
+    state.builder.replace(begin, end, string_view(text));
+
+    if (begin != end) {
+        state.reference.replace(begin, end - begin, text);
+    }
+
+    return true;
+}
+
+/* Rebuilds the builder from a string moved in */
+static bool adoptString(State& state) {
+    string text = state.reference;
+
+    state.builder = MyStringBuilder(std::move(text), state.builder.getMode());
+
+    return true;
+}
+
+/* Converts a random range to a string */
+static bool rangeToString(State& state) {
+    const int begin = pick(0, (int) state.reference.size());
+    const int end = pick(begin, (int) state.reference.size());
+
+    return state.builder.toString(begin, end) ==
+           state.reference.substr(begin, end - begin);
+}
+
+/*
+ * Saves the builder over the scratch file & maps it back, whole & a
+ * window of it, a piece table builder continues from the mapped file.
+ */
+static bool saveAndMap(State& state) {
+    state.builder.saveTo(scratchPath);
+
+    MyStringBuilder mapped = MyStringBuilder::fromFile(scratchPath);
+    const int offset = pick(0, (int) state.reference.size());
+    const int length = pick(0, 10000);
+
+    if (mapped.toString() != state.reference or
+        MyStringBuilder::fromFile(scratchPath, offset, length).toString() !=
+        state.reference.substr(offset, length)) {
+        return false;
+    }
+
+    if (state.builder.getMode() == Mode::kPieceTable) {
+        state.builder = std::move(mapped);
+    }
+
+    return true;
+}
+
+/* Writes the builder to a file descriptor, then appends it read back */
+static bool writeThenRead(State& state) {
+    if (100000 < state.reference.size()) {
+        return true;
+    }
+
+    FILE *file = tmpfile();
+
+    if (file == nullptr) {
+        return false;
+    }
+
+    state.builder.writeTo(fileno(file));
+    rewind(file);
+    state.builder.readFrom(fileno(file));
+    state.reference += state.reference;
+    fclose(file);
+
+    return true;
+}
+
+/* Operations drawn by the fuzzer, see Operation */
+static const Operation kOperations[] = {
+        {"insert MyStringBuilder", insertBuilder},
+        {"append MyStringBuilder", appendBuilder},
+        {"append int", appendInt},
+        {"clear", clearRange},
+        {"replace MyStringBuilder", replaceBuilder},
+        {"substring", takeSubstring},
+        {"charAt", readCharAt},
+        {"toUpperCase", upperCase},
+        {"insert whole blocks", insertBlocks},
+        {"edits near a cursor", editNearCursor},
+        {"scattered inserts", scatterInserts},
+        {"arenaCounters", checkArena},
+        {"append fragments", appendFragments},
+        {"insert moved MyStringBuilder", insertMoved},
+        {"append moved MyStringBuilder", appendMoved},
+        {"move through a vector", moveThroughVector},
+        {"insert itself", insertItself},
+        {"append itself", appendItself},
+        {"copy", copyThenEdit},
+        {"charAt many", readCharAts},
+        {"iterators", iterate},
+        {"charAt run", readRun},
+        {"toLowerCase", lowerCase},
+        {"swapCase", swapCase},
+        {"transform", transformTable},
+        {"operator<<", streamOut},
+        {"indexOf", findForward},
+        {"lastIndexOf", findBackward},
+        {"startsWith, endsWith & contains", matchEnds},
+        {"PatternMatcher::scan", scanPatterns},
+        {"replaceAll & replaceFirst", replaceMatches},
+        {"apply", applyBatch},
+        {"append values", appendValues},
+        {"insert string_view", insertView},
+        {"replace string_view", replaceView},
+        {"adopt a moved string", adoptString},
+        {"toString range", rangeToString},
+        {"saveTo & fromFile", saveAndMap},
+        {"writeTo & readFrom", writeThenRead},
+};
+
+/*
+ * Pre-Conditions:
+ *      Optional number of operations per mode, default is 3000.
+ *      Optional seed, default is 12345.
+ *
+ * Post-Conditions:
+ *      0 is returned if every mode matched std::string throughout,
+ *      the process exits with 1 otherwise.
+ *
+ * Fuzzes every storage mode & exits with 1 on a difference.
+ */
+int main(int argc, char **argv) {
+    const int operations = 1 < argc ? atoi(argv[1]) : 3000;
+    const unsigned seed = 2 < argc ? (unsigned) strtoul(argv[2], nullptr, 10)
+                                   : 12345;
+
+    generator.seed(seed);
+    scratchPath = (filesystem::temp_directory_path() /
+                   ("fuzz_stringbuilder." + to_string(seed))).string();
+
+    for (Mode mode: kModes) {
+        const string initial = randomText(pick(0, 2000));
+        State state{MyStringBuilder(initial, mode), initial};
+
+        for (int i = 0; i < operations; i++) {
+            const Operation& operation =
+                    kOperations[pick(0, (int) size(kOperations) - 1)];
+
+            if (not operation.apply(state)) {
+                fail(mode, i, operation.name);
+            }
+
+            if (state.builder.length() != (int) state.reference.size() or
+                state.builder.toString() != state.reference) {
+                fail(mode, i, operation.name);
+            }
+
+            for (const auto& [text, part]: state.kept) {
+                if (part.toString() != text) {
+                    fail(mode, i, "kept substring");
+                }
+            }
+
+            if (kMaxLength < (int) state.reference.size()) {
+                state.builder.clear(0, kMaxLength / 2);
+                state.reference.erase(0, kMaxLength / 2);
+            }
+        }
+
+        cout << "Mode " << (int) mode << ": " << operations
+             << " operations match std::string" << endl;
+    }
+
+    remove(scratchPath.c_str());
+
+    return 0;
+}